@@ -0,0 +1,106 @@
+#include <server/http/http_request_parser_benchmark.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::bench::CreateBenchmarkParser;
+using server::http::bench::kHttpRequestDataHeaderHeavy;
+using server::http::bench::kHttpRequestDataMiddle;
+using server::http::bench::kHttpRequestDataSmall;
+
+// Counts the allocations of the current thread, see the operator new below
+thread_local std::size_t allocations_count = 0;
+
+}  // namespace
+
+void http_request_parser_allocations(benchmark::State& state, const std::vector<std::string_view>& pieces) {
+    std::size_t requests_count = 0;
+    auto parser = CreateBenchmarkParser(
+        [&requests_count](std::shared_ptr<server::request::RequestBase>&& request) {
+            ++requests_count;
+            // destroy the request within the measured scope
+            request.reset();
+        },
+        state.range(0)
+    );
+
+    const auto allocations_before = allocations_count;
+    for ([[maybe_unused]] auto _ : state) {
+        for (const auto piece : pieces) {
+            parser.Parse(piece);
+        }
+    }
+
+    state.counters["allocations_per_request"] = benchmark::Counter(
+        static_cast<double>(allocations_count - allocations_before) / std::max<std::size_t>(requests_count, 1)
+    );
+}
+
+void http_request_parser_allocations_small(benchmark::State& state) {
+    http_request_parser_allocations(state, {kHttpRequestDataSmall});
+}
+
+void http_request_parser_allocations_middle(benchmark::State& state) {
+    http_request_parser_allocations(state, {kHttpRequestDataMiddle});
+}
+
+void http_request_parser_allocations_header_heavy(benchmark::State& state) {
+    http_request_parser_allocations(state, {kHttpRequestDataHeaderHeavy});
+}
+
+// The body arrives in several reads, as it does for the bodies bigger than
+// the connection input buffer
+void http_request_parser_allocations_split_body(benchmark::State& state) {
+    constexpr std::size_t kBodySize = 256 * 1024;
+    constexpr std::size_t kReadSize = 32 * 1024;
+    const std::string http_request_data = fmt::format(
+        "POST / HTTP/1.1\r\n"
+        "Content-Length: {}\r\n\r\n{}",
+        kBodySize,
+        std::string(kBodySize, 'x')
+    );
+
+    std::vector<std::string_view> pieces;
+    for (std::size_t pos = 0; pos < http_request_data.size(); pos += kReadSize) {
+        pieces.push_back(std::string_view{http_request_data}.substr(pos, kReadSize));
+    }
+    http_request_parser_allocations(state, pieces);
+}
+
+// The argument is whether the fast parser is used
+BENCHMARK(http_request_parser_allocations_small)->Arg(false)->Arg(true);
+BENCHMARK(http_request_parser_allocations_middle)->Arg(false)->Arg(true);
+BENCHMARK(http_request_parser_allocations_header_heavy)->Arg(false)->Arg(true);
+BENCHMARK(http_request_parser_allocations_split_body)->Arg(false)->Arg(true);
+
+USERVER_NAMESPACE_END
+
+// Replaces the global allocation functions to count the allocations per
+// request. That is why the benchmarks live in a separate binary.
+void* operator new(std::size_t size) {
+    ++USERVER_NAMESPACE::allocations_count;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) { return ::operator new(size); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
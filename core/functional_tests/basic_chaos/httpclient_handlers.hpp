@@ -1,6 +1,7 @@
 #pragma once
 
 #include <userver/clients/http/component.hpp>
+#include <userver/clients/http/hedged_request.hpp>
 #include <userver/clients/http/streamed_response.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/concurrent/queue.hpp>
@@ -49,6 +50,23 @@ public:
             return response->body();
         }
 
+        if (type == "hedged") {
+            auto url = fmt::format("http://localhost:{}/test", port);
+            clients::http::AdaptiveHedgingSettings settings;
+            settings.timeout_all = timeout;
+            const auto& max_delay_string = request.GetArg("max_hedging_delay");
+            if (!max_delay_string.empty()) {
+                settings.max_delay =
+                    std::chrono::milliseconds{utils::FromString<std::chrono::milliseconds::rep>(max_delay_string)};
+            }
+            auto response = clients::http::PerformHedgedRequest(
+                [&] { return client_.CreateRequest().get(url).timeout(timeout).retry(1, retry_network_errors); },
+                settings
+            );
+            response->raise_for_status();
+            return response->body();
+        }
+
         UINVARIANT(false, "Unexpected request type");
     }
 
@@ -0,0 +1,70 @@
+import asyncio
+import time
+
+import pytest
+
+# Every SLOW_EVERY-th response of the mockserver is delayed by SLOW_DELAY
+SLOW_EVERY = 5
+SLOW_DELAY = 1.0
+REQUESTS_COUNT = 20
+
+
+@pytest.fixture(name='call')
+def _call(service_client, for_client_gate_port, gate):
+    async def _call(htype, **args):
+        return await service_client.get(
+            '/chaos/httpclient',
+            params={'type': htype, 'port': str(for_client_gate_port), **args},
+        )
+
+    return _call
+
+
+@pytest.fixture(name='slow_mock')
+def _slow_mock(mockserver):
+    requests_count = 0
+
+    @mockserver.handler('/test')
+    async def mock(_request):
+        nonlocal requests_count
+        requests_count += 1
+        if requests_count % SLOW_EVERY == 0:
+            await asyncio.sleep(SLOW_DELAY)
+        return mockserver.make_response('OK!')
+
+    return mock
+
+
+async def _max_latency(call, htype, **args):
+    max_latency = 0.0
+    for _ in range(REQUESTS_COUNT):
+        start = time.monotonic()
+        response = await call(htype, **args)
+        max_latency = max(max_latency, time.monotonic() - start)
+        assert response.status == 200
+        assert response.text == 'OK!'
+    return max_latency
+
+
+async def test_hedging_cuts_tail_latency(call, slow_mock):
+    common_latency = await _max_latency(call, 'common')
+    assert common_latency >= SLOW_DELAY
+
+    hedged_latency = await _max_latency(
+        call, 'hedged', max_hedging_delay='100',
+    )
+    assert hedged_latency < SLOW_DELAY
+    # The slow responses were hedged
+    assert slow_mock.times_called > 2 * REQUESTS_COUNT
+
+
+async def test_hedging_all_slow(call, mockserver):
+    @mockserver.handler('/test')
+    async def _mock(_request):
+        await asyncio.sleep(0.2)
+        return mockserver.make_response('OK!')
+
+    response = await call('hedged', max_hedging_delay='50')
+    assert response.status == 200
+    assert response.text == 'OK!'
+    assert _mock.times_called == 2
@@ -8,6 +8,7 @@
 #endif
 
 #include <memory>
+#include <string_view>
 
 #include <userver/moodycamel/concurrentqueue_fwd.h>
 
@@ -32,6 +33,7 @@ class TracingManagerBase;
 namespace curl {
 class easy;
 class multi;
+class share;
 class ConnectRateLimiter;
 }  // namespace curl
 
@@ -131,6 +133,10 @@ private:
 
     size_t FindMultiIndex(const curl::multi*) const;
 
+    // Returns the index of the multi that performs all the requests to
+    // `destination` if destination affinity is enabled
+    size_t GetDestinationMultiIndex(std::string_view destination) const;
+
     // Functions for EasyWrapper that must be noexcept, as they are called from
     // the EasyWrapper destructor.
     friend class impl::EasyWrapper;
@@ -149,6 +155,8 @@ private:
     std::unique_ptr<engine::ev::ThreadPool> thread_pool_;
     std::vector<Statistics> statistics_;
     std::vector<std::unique_ptr<curl::multi>> multis_;
+    const bool destination_affinity_enabled_;
+    std::shared_ptr<curl::share> ssl_session_share_;
 
     static constexpr size_t kIdleQueueSize = 616;
     static constexpr size_t kIdleQueueAlignment = 8;
@@ -27,6 +27,7 @@ namespace components {
 /// component and are safe for concurrent use.
 ///
 /// ## Dynamic options:
+/// * @ref HTTP_CLIENT_CIRCUIT_BREAKER
 /// * @ref HTTP_CLIENT_CONNECT_THROTTLE
 /// * @ref HTTP_CLIENT_CONNECTION_POOL_SIZE
 /// * @ref USERVER_HTTP_PROXY
@@ -48,6 +49,11 @@ namespace components {
 /// set-deadline-propagation-header | whether to set http::common::kXYaTaxiClientTimeoutMs request header, see @ref scripts/docs/en/userver/deadline_propagation.md | true
 /// plugins | Plugin names to apply. A plugin component is called "http-client-plugin-" plus the plugin name. | []
 /// cancellation-policy | Cancellation policy for new requests. | cancel
+/// destination-affinity-enabled | perform all the requests to the same scheme, host and port on the same IO thread, so that the connections and HTTP/2 sessions to a destination are not duplicated in each of the threads | false
+/// ssl-session-sharing-enabled | share the TLS session cache between the IO threads, so that a new connection may resume the session of a connection from another thread | false
+/// retry-budget.enabled | limit the retries and hedges of each destination with a utils::RetryBudget | false
+/// retry-budget.max-tokens | maximum number of tokens in a budget, each failed attempt takes one, retries and hedges are allowed while more than a half are left | 100
+/// retry-budget.token-ratio | number of tokens returned by each successful attempt | 0.1
 ///
 /// ## Static configuration example:
 ///
@@ -5,6 +5,7 @@
 
 #include <userver/dynamic_config/fwd.hpp>
 #include <userver/formats/json_fwd.hpp>
+#include <userver/utils/retry_budget.hpp>
 #include <userver/yaml_config/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -33,6 +34,9 @@ struct ClientSettings final {
     DeadlinePropagationConfig deadline_propagation{};
     const tracing::TracingManagerBase* tracing_manager{nullptr};
     CancellationPolicy cancellation_policy{CancellationPolicy::kCancel};
+    bool destination_affinity_enabled{false};
+    bool ssl_session_sharing_enabled{false};
+    utils::RetryBudgetSettings retry_budget{/*max_tokens=*/100.0f, /*token_ratio=*/0.1f, /*enabled=*/false};
 };
 
 ClientSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientSettings>);
@@ -54,6 +58,21 @@ struct ThrottleConfig final {
 
 ThrottleConfig Parse(const formats::json::Value& value, formats::parse::To<ThrottleConfig>);
 
+struct CircuitBreakerConfig final {
+    bool enabled{false};
+    // The share of failed requests in a window that opens the breaker
+    double failure_rate_threshold{0.5};
+    // Windows with fewer requests never open the breaker
+    std::size_t min_requests{20};
+    std::chrono::milliseconds window{10000};
+    // Time to fail requests fast before probing the destination again
+    std::chrono::milliseconds open_duration{5000};
+    // Successful probes required to close the breaker
+    std::size_t half_open_probes{3};
+};
+
+CircuitBreakerConfig Parse(const formats::json::Value& value, formats::parse::To<CircuitBreakerConfig>);
+
 // Dynamic config
 struct Config final {
     static constexpr std::size_t kDefaultConnectionPoolSize = 10000;
@@ -61,6 +80,7 @@ struct Config final {
     std::size_t connection_pool_size{kDefaultConnectionPoolSize};
     std::string proxy;
     ThrottleConfig throttle;
+    CircuitBreakerConfig circuit_breaker;
 };
 
 Config ParseConfig(const dynamic_config::DocsMap& docs_map);
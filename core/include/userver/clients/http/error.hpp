@@ -55,6 +55,14 @@ public:
     ~CancelException() override = default;
 };
 
+/// Thrown without sending the request while the circuit breaker of the
+/// destination is open, see @ref HTTP_CLIENT_CIRCUIT_BREAKER
+class CircuitBreakerOpenException : public BaseException {
+public:
+    CircuitBreakerOpenException(std::string_view url, const LocalStats& stats);
+    ~CircuitBreakerOpenException() override = default;
+};
+
 class SSLException : public BaseCodeException {
 public:
     using BaseCodeException::BaseCodeException;
@@ -0,0 +1,56 @@
+#pragma once
+
+/// @file userver/clients/http/hedged_request.hpp
+/// @brief Adaptive hedged HTTP requests
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// @brief Settings of PerformHedgedRequest
+struct AdaptiveHedgingSettings {
+    /// Maximum requests to do, including the first one
+    std::size_t max_attempts{2};
+    /// The percentile of the recent destination timings to wait for
+    /// before sending the next attempt
+    double delay_percentile{95};
+    /// The lower bound of the delay between the attempts
+    std::chrono::milliseconds min_delay{1};
+    /// The upper bound of the delay between the attempts, also used while the
+    /// destination has too few recent timings
+    std::chrono::milliseconds max_delay{200};
+    /// Max time to wait for all requests
+    std::chrono::milliseconds timeout_all{1000};
+};
+
+/// @brief Performs a hedged request: if there is no response after the
+/// `delay_percentile` of the recent timings of the destination, sends the same
+/// request once more and returns the first successful response.
+///
+/// Failed attempts (network errors and 5xx responses) are retried without a
+/// delay. Each extra attempt is accounted in the `hedges` metric of the
+/// destination and is only sent while the retry budget of the destination
+/// (see `retry-budget` in components::HttpClient) allows it, so that hedging
+/// does not overload a degraded destination.
+///
+/// `make_request` is called for each attempt and must return a fully set up
+/// request, usually with `retry(1)`. Requests should be idempotent.
+///
+/// @returns the first successful response, or the response of the last failed
+/// attempt
+/// @throws the exception of the last failed attempt if there is no response,
+/// clients::http::TimeoutException if no attempt finished within `timeout_all`
+std::shared_ptr<Response>
+PerformHedgedRequest(const std::function<Request()>& make_request, const AdaptiveHedgingSettings& settings);
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -3,7 +3,9 @@
 /// @file userver/clients/http/request.hpp
 /// @brief @copybrief clients::http::Request
 
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <vector>
 
@@ -24,6 +26,10 @@ namespace tracing {
 class TracingManagerBase;
 }  // namespace tracing
 
+namespace fs::blocking {
+class FileDescriptor;
+}  // namespace fs::blocking
+
 /// HTTP client helpers
 namespace clients::http {
 
@@ -33,6 +39,7 @@ class ConnectTo;
 class Form;
 struct DeadlinePropagationConfig;
 class RequestStats;
+class Statistics;
 class DestinationStatistics;
 struct TestsuiteConfig;
 
@@ -151,6 +158,30 @@ public:
     /// form for POST request
     Request& form(Form&& form) &;
     Request form(Form&& form) &&;
+
+    /// Fills the buffer with the next part of the request body and returns the
+    /// count of written bytes, 0 means the end of the body
+    using BodySource = std::function<std::size_t(char* buffer, std::size_t size)>;
+
+    /// @brief Body for POST request that is sent part by part as it is read
+    /// from `body_source`, without keeping the whole body in memory.
+    ///
+    /// `body_source` is called from the HTTP client IO thread, it must not
+    /// block for long or wait for coroutines. An exception from it fails the
+    /// request. If `content_length` is not set, chunked transfer encoding is
+    /// used.
+    ///
+    /// @note The body can not be read twice, so such requests are not retried.
+    Request& upload_body(BodySource body_source, std::optional<std::size_t> content_length = std::nullopt) &;
+    Request upload_body(BodySource body_source, std::optional<std::size_t> content_length = std::nullopt) &&;
+
+    /// @brief Body for POST request that is read from the file as it is sent,
+    /// see upload_body().
+    ///
+    /// The file is read from the HTTP client IO thread, so it should be fast to
+    /// read, e.g. a local file that is likely in the page cache.
+    Request& upload_file(fs::blocking::FileDescriptor&& file) &;
+    Request upload_file(fs::blocking::FileDescriptor&& file) &&;
     /// Headers for request as map
     Request& headers(const Headers& headers) &;
     Request headers(const Headers& headers) &&;
@@ -264,6 +295,10 @@ public:
 
     // Set deadline propagation settings. For internal use only.
     void SetDeadlinePropagationConfig(const DeadlinePropagationConfig& deadline_propagation_config) &;
+
+    // Returns the statistics of the request destination or nullptr if the
+    // destination has none. For internal use only.
+    Statistics* GetDestinationStatistics();
     /// @endcond
 
     /// Disable auto-decoding of received replies.
@@ -295,6 +330,11 @@ public:
     ///
     /// The HTTP client uses queue producer.
     /// StreamedResponse uses queue consumer.
+    ///
+    /// If the queue is created with a max size (in bytes), the transfer is
+    /// paused while the queue is full, so that a slow consumer does not make
+    /// the whole body buffered in memory. The max size should be at least the
+    /// cURL buffer size of 16KiB, larger chunks fail the request.
     [[nodiscard]] StreamedResponse async_perform_stream_body(
         const std::shared_ptr<concurrent::StringStreamQueue>& queue,
         utils::impl::SourceLocation location = utils::impl::SourceLocation::Current()
@@ -46,7 +46,9 @@ public:
     using Queue = concurrent::StringStreamQueue;
 
     /// Read another HTTP response body part into 'output'.
-    /// Any previous data in 'output' is dropped.
+    /// Any previous data in 'output' is dropped, the memory of 'output' is
+    /// reused for the next chunks. Pass the same 'output' to each call to
+    /// avoid allocations.
     /// @note The chunk size is not guaranteed to be exactly
     /// multipart/form-data chunk size or any other HTTP-related size
     /// @note may block if the chunk is not obtained yet.
@@ -104,6 +104,10 @@ public:
     /// @note Can return less than len if socket is closed by peer.
     [[nodiscard]] size_t SendAll(const IoData* list, std::size_t list_size, Deadline deadline);
 
+    [[nodiscard]] size_t WriteAll(const IoData* list, std::size_t list_size, Deadline deadline) override {
+        return SendAll(list, list_size, deadline);
+    }
+
     /// @brief Sends exactly list_size iovec to the socket.
     /// @note Can return less than len if socket is closed by peer.
     [[nodiscard]] size_t SendAll(const struct iovec* list, std::size_t list_size, Deadline deadline);
@@ -20,6 +20,8 @@ struct TaskProcessorPoolsConfig final {
     std::size_t ev_threads_num = 1;
     std::string ev_thread_name = "ev";
     bool ev_default_loop_disabled = false;
+    /// libev backend: "default", "epoll" or "io_uring"
+    std::string ev_backend = "default";
 };
 
 /// @brief Runs a payload in a temporary coroutine engine instance.
@@ -43,10 +43,14 @@ namespace components {
 /// ---- | ----------- | -------------
 /// file_path | path to the log file | -
 /// level | log verbosity | info
-/// format | log output format, either `tskv` or `ltsv` | tskv
+/// format | log output format, one of `tskv`, `ltsv`, `raw` or `json` (JSON lines) | tskv
 /// flush_level | messages of this and higher levels get flushed to the file immediately | warning
 /// message_queue_size | the size of internal message queue, must be a power of 2 | 65536
 /// overflow_behavior | message handling policy while the queue is full: `discard` drops messages, `block` waits until message gets into the queue | discard
+/// deferred_formatting | pass the log records to the logger task unformatted, the timestamp formatting and escaping are done by the logger task | false
+/// file_batch_size | if not 0, the log file is written in batches of this size in bytes with a single write per batch | 0
+/// fsync_policy | when the log file written in batches is synced to the disk: `none`, `periodic` (on flush, at most once per `fsync_interval`) or `every-flush` | none
+/// fsync_interval | the minimal interval between syncs for the `periodic` fsync_policy | 1s
 /// testsuite-capture | if exists, setups additional TCP log sink for testing purposes | {}
 /// fs-task-processor | task processor for disk I/O operations for this logger | fs-task-processor of the loggers component
 ///
@@ -2,8 +2,10 @@
 
 #include <array>
 #include <atomic>
+#include <memory>
 
 #include <userver/logging/level.hpp>
+#include <userver/utils/statistics/histogram.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
 #include <userver/utils/statistics/writer.hpp>
 
@@ -13,13 +15,28 @@ namespace logging::impl {
 
 using Counter = utils::statistics::RateCounter;
 
+/// Statistics of the file sinks that write in batches
+struct FileBatchStatistics final {
+    FileBatchStatistics();
+
+    Counter writes{};
+    Counter fsyncs{};
+    utils::statistics::Histogram write_latency_us;
+    utils::statistics::Histogram batch_size_bytes;
+};
+
 struct LogStatistics final {
     Counter dropped{};
 
     std::array<Counter, kLevelMax + 1> by_level{};
     std::atomic<bool> has_reopening_error{false};
+
+    /// Set up before the logger is started if it has a batched file sink
+    std::unique_ptr<FileBatchStatistics> file_batches;
 };
 
+void DumpMetric(utils::statistics::Writer& writer, const FileBatchStatistics& stats);
+
 void DumpMetric(utils::statistics::Writer& writer, const LogStatistics& stats);
 
 }  // namespace logging::impl
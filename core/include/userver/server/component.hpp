@@ -78,10 +78,16 @@ namespace components {
 /// connection.keepalive_timeout | timeout in seconds to drop connection if there's not data received from it | 600
 /// connection.stream_close_check_delay | delay in microseconds of the start of stream close check routine; do not set if not sure what it is doing | 20ms
 /// connection.http-version | the HTTP protocol version | '1.1'
+/// connection.http1-fast-parser | parse the complete HTTP/1.x requests with a vectorized parser, leaving the partial and uncommon requests to llhttp | false
 /// connection.http2-session.max_concurrent_streams | max number of concurrent open streams | 100
 /// connection.http2-session.max_frame_size | max size of the HTTP/2.0 frame | 16384
 /// connection.http2-session.initial_window_size | the initial window size of the server | 65536
+/// connection.http2-session.connection_window_size | the initial receive window size of the whole connection | 65536
+/// connection.http2-session.window_auto_tuning | grow the connection receive window up to the estimated bandwidth-delay product | false
+/// connection.http2-session.max_connection_window_size | max size of the connection receive window for window_auto_tuning | 16777216
+/// connection.http2-session.rfc9218_priorities | schedule the streams by the RFC 9218 priorities instead of the RFC 7540 ones | false
 /// shards | how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing | -
+/// reuseport-steering | how the kernel distributes new connections between the shards, each shard has its own SO_REUSEPORT socket: `hash` of the connection addresses or the `cpu` that received the connection | hash
 /// middleware-pipeline-builder | name of a component to build a server-wide middleware pipeline | default-server-middleware-pipeline-builder
 ///
 /// @see @ref scripts/docs/en/userver/http_server.md
@@ -28,9 +28,10 @@ namespace server::handlers {
 /// Inherits all the options from server::handlers::HttpHandlerBase and adds the
 /// following ones:
 ///
-/// Name               | Description                   | Default value
-/// ------------------ | ----------------------------- | -------------
-/// fs-cache-component | Name of the FsCache component | fs-cache-component
+/// Name                | Description                   | Default value
+/// ------------------- | ----------------------------- | -------------
+/// fs-cache-component  | Name of the FsCache component | fs-cache-component
+/// serve-precompressed | Send `<file>.zst` or `<file>.gz` instead of `<file>` if the client accepts the content coding | false
 ///
 /// ## Example usage:
 ///
@@ -55,6 +56,7 @@ public:
 private:
     dynamic_config::Source config_;
     const fs::FsCacheClient& storage_;
+    const bool serve_precompressed_{false};
 };
 
 }  // namespace server::handlers
@@ -3,6 +3,8 @@
 /// @file userver/server/handlers/server_monitor.hpp
 /// @brief @copybrief server::handlers::ServerMonitor
 
+#include <memory>
+
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 
@@ -30,6 +32,12 @@ enum class StatsFormat;
 ///   utils::statistics::ToPrometheusFormatUntyped, utils::statistics::ToGraphiteFormat, utils::statistics::ToJsonFormat,
 ///   utils::statistics::ToSolomonFormat, utils::statistics::ToPrettyFormat.
 ///
+/// With the 'prometheus-cache-enabled' option the text of each metric is kept between the requests in "prometheus"
+///   and "prometheus-untyped" formats, and only the metrics that have changed are formatted again, see
+///   utils::statistics::PrometheusFormatCache. The concurrent requests are served without the cache.
+///
+/// With the 'response-body-stream' option the response is sent in chunks, the cached text is not copied as a whole.
+///
 /// ## Static configuration example:
 ///
 /// @snippet components/common_server_component_list_test.cpp  Sample handler server monitor component config
@@ -48,6 +56,7 @@ enum class StatsFormat;
 class ServerMonitor final : public HttpHandlerBase {
 public:
     ServerMonitor(const components::ComponentConfig& config, const components::ComponentContext& component_context);
+    ~ServerMonitor() override;
 
     /// @ingroup userver_component_names
     /// @brief The default name of server::handlers::ServerMonitor
@@ -55,6 +64,12 @@ public:
 
     std::string HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const override;
 
+    void HandleStreamRequest(
+        const http::HttpRequest& request,
+        request::RequestContext&,
+        http::ResponseBodyStream& stream
+    ) const override;
+
     static yaml_config::Schema GetStaticConfigSchema();
 
 private:
@@ -64,11 +79,17 @@ private:
         const std::string& response_data
     ) const override;
 
+    struct PrometheusCaches;
+
+    template <typename Consumer>
+    void FormatMetrics(const http::HttpRequest& request, Consumer&& consumer) const;
+
     utils::statistics::Storage& statistics_storage_;
 
     using CommonLabels = std::unordered_map<std::string, std::string>;
     const CommonLabels common_labels_;
     const std::optional<impl::StatsFormat> default_format_;
+    const std::unique_ptr<PrometheusCaches> prometheus_caches_;
 };
 
 }  // namespace server::handlers
@@ -4,6 +4,7 @@
 /// @brief @copybrief server::http::HttpResponse
 
 #include <chrono>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <variant>
@@ -84,6 +85,20 @@ public:
     /// @brief Add or rewrite the Content-Encoding header.
     void SetContentEncoding(std::string encoding);
 
+    /// @brief Set the response body that is owned elsewhere, e.g. by a cache,
+    /// to send it without copying.
+    /// @note Replaces the data set by SetData(), a later SetData() call
+    /// discards the shared data.
+    void SetSharedData(std::shared_ptr<const std::string> data);
+
+    /// @return true if the body was set by SetSharedData() and was not
+    /// replaced by SetData() afterwards
+    bool HasSharedData() const noexcept;
+
+    /// @return The response body to send: the data set by the last call of
+    /// SetSharedData() or SetData()
+    const std::string& GetBodyData() const;
+
     /// @brief Set the HTTP response status code.
     /// @returns true if the status was set. Returns false if headers
     /// were already sent for stream'ed response and the new status was not set.
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include <userver/server/http/http_response.hpp>
@@ -13,9 +14,13 @@ class HttpHandlerBase;
 
 namespace server::http {
 
+namespace impl {
+class BodyStreamCompressor;
+}  // namespace impl
+
 class ResponseBodyStream final {
 public:
-    ResponseBodyStream(ResponseBodyStream&&) = default;
+    ResponseBodyStream(ResponseBodyStream&&) noexcept;
     ~ResponseBodyStream();
 
     // Send a chunk of response data. It may NOT generate
@@ -35,11 +40,21 @@ public:
 private:
     friend class server::handlers::HttpHandlerBase;
 
-    ResponseBodyStream(HttpResponse::Producer&& queue_producer, HttpResponse& http_response);
+    ResponseBodyStream(
+        HttpResponse::Producer&& queue_producer,
+        HttpResponse& http_response,
+        std::unique_ptr<impl::BodyStreamCompressor> compressor
+    );
+
+    // Returns false if the chunk was not pushed before the deadline
+    bool PushChunk(std::string&& chunk, engine::Deadline deadline);
 
     bool headers_ended_{false};
+    // The deadline of the last PushBodyChunk(), bounds the push of the compressed tail
+    engine::Deadline last_deadline_;
     HttpResponse::Producer queue_producer_;
     HttpResponse& http_response_;
+    std::unique_ptr<impl::BodyStreamCompressor> compressor_;
 };
 
 }  // namespace server::http
@@ -4,6 +4,7 @@
 #include <chrono>
 #include <functional>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -80,6 +81,8 @@ public:
     ResponseBase(ResponseBase&&) = delete;
     virtual ~ResponseBase() noexcept;
 
+    /// @brief Set the response body, the body set by
+    /// http::HttpResponse::SetSharedData() is discarded
     void SetData(std::string data);
     const std::string& GetData() const { return data_; }
     std::string&& ExtractData() { return std::move(data_); }
@@ -118,6 +121,10 @@ protected:
 
     void SetSent(std::size_t bytes_sent, std::chrono::steady_clock::time_point sent_time);
 
+    // The body that is owned elsewhere, it is reset by SetData()
+    void SetSharedBody(std::shared_ptr<const std::string> data);
+    const std::shared_ptr<const std::string>& GetSharedBody() const { return shared_body_; }
+
 private:
     class Guard final {
     public:
@@ -137,6 +144,7 @@ private:
     ResponseDataAccounter& accounter_;
     std::optional<Guard> guard_;
     std::string data_;
+    std::shared_ptr<const std::string> shared_body_;
     std::chrono::steady_clock::time_point create_time_;
     std::chrono::steady_clock::time_point ready_time_;
     std::chrono::steady_clock::time_point sent_time_;
@@ -0,0 +1,51 @@
+#pragma once
+
+/// @file userver/tracing/sampling_policy.hpp
+/// @brief @copybrief tracing::SamplingPolicy
+
+#include <chrono>
+#include <cstddef>
+
+#include <userver/formats/json_fwd.hpp>
+#include <userver/formats/parse/to.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+/// @brief Decides which traces are logged, set from @ref USERVER_TRACE_SAMPLING
+/// via tracing::Tracer::SetSamplingPolicy.
+///
+/// Head sampling is decided once per trace by its root tracing::Span. The
+/// decision is inherited by the child spans and is propagated to other
+/// services in the B3 and OpenTelemetry tracing headers. A decision received
+/// in the headers of an incoming request takes precedence over the local one
+/// only with `use_inbound_decision`, so that clients do not disable the logs of
+/// a service that has not configured the sampling.
+///
+/// Tail sampling applies to the traces that were not head sampled. The spans
+/// of such a trace are kept in memory and are logged when the root span
+/// finishes, but only if the root span took at least `tail_latency_threshold`
+/// or any span of the trace got the tracing::kErrorFlag tag.
+struct SamplingPolicy final {
+    /// Probability for a new trace to be logged, from 0 to 1
+    double head_probability{1.0};
+
+    /// Use the head sampling decision from the incoming request headers
+    bool use_inbound_decision{false};
+
+    /// Buffer the spans of the traces that were not head sampled
+    bool tail_sampling_enabled{false};
+
+    /// Traces with a root span at least that long are logged by tail sampling
+    std::chrono::milliseconds tail_latency_threshold{1000};
+
+    /// Limit of the spans kept in memory per trace, the rest are dropped
+    std::size_t tail_max_spans{1000};
+};
+
+SamplingPolicy Parse(const formats::json::Value& value, formats::parse::To<SamplingPolicy>);
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
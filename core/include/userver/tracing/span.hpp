@@ -196,6 +196,11 @@ public:
     /// global log levels to the default logger.
     bool ShouldLogDefault() const noexcept;
 
+    /// @returns false if the trace of this span was not chosen by the head
+    /// sampling, see tracing::SamplingPolicy. Such spans are not logged, unless
+    /// the tail sampling keeps the trace.
+    bool IsSampled() const noexcept;
+
     /// Detach the Span from current engine::Task so it is not
     /// returned by CurrentSpan() any more.
     void DetachFromCoroStack();
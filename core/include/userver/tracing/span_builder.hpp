@@ -27,6 +27,12 @@ public:
     void SetParentLink(std::string parent_link);
     void AddTagFrozen(std::string key, logging::LogExtra::Value value);
     void AddNonInheritableTag(std::string key, logging::LogExtra::Value value);
+
+    /// Overrides the head sampling decision, e.g. with the one received from
+    /// the client, see tracing::SamplingPolicy. Does nothing if there is a
+    /// parent span, as the decision is made once per trace.
+    void SetSampled(bool is_sampled);
+
     Span Build() &&;
 
 private:
@@ -3,6 +3,7 @@
 #include <memory>
 #include <unordered_set>
 
+#include <userver/tracing/sampling_policy.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tracer_fwd.hpp>
 
@@ -22,6 +23,9 @@ public:
     static void SetNoLogSpans(NoLogSpans&& spans);
     static bool IsNoLogSpan(const std::string& name);
 
+    static void SetSamplingPolicy(SamplingPolicy&& policy);
+    static SamplingPolicy GetSamplingPolicy();
+
     static void SetTracer(TracerPtr tracer);
 
     static TracerPtr GetTracer();
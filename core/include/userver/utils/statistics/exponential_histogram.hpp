@@ -0,0 +1,127 @@
+#pragma once
+
+/// @file userver/utils/statistics/exponential_histogram.hpp
+/// @brief @copybrief utils::statistics::ExponentialHistogram
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @brief The contents of an ExponentialHistogram, compatible with the
+/// OpenTelemetry exponential histogram data point.
+///
+/// The bucket with index `i` contains the values in `(base^i, base^(i+1)]`,
+/// where `base = 2^(2^-scale)`.
+struct ExponentialHistogramData final {
+    int scale{0};
+
+    /// The index of the first bucket in `bucket_counts`
+    std::int32_t offset{0};
+
+    std::vector<std::uint64_t> bucket_counts;
+
+    /// The count of zero, negative and too small values
+    std::uint64_t zero_count{0};
+
+    /// The count of values that are too large for the buckets
+    std::uint64_t overflow_count{0};
+
+    /// Returns the upper bound of the bucket at `bucket_counts[position]`
+    double GetUpperBoundAt(std::size_t position) const;
+
+    std::uint64_t GetTotalCount() const noexcept;
+
+    /// Lowers the scale by `scale_reduction`, merging every
+    /// `2^scale_reduction` adjacent buckets, as an OpenTelemetry SDK does.
+    void Downscale(int scale_reduction);
+
+    /// Adds the counts of `other`, downscaling to the lower scale if needed.
+    void Merge(ExponentialHistogramData other);
+};
+
+/// @brief A histogram with exponential buckets that does not require
+/// choosing the bounds, for latency-like metrics with a wide range of values.
+///
+/// Bucket bounds are the powers of `base = 2^(2^-scale)`, so there are
+/// `2^scale` buckets per each power of 2, and the relative error of a value
+/// estimated from its bucket is at most `(base - 1) / 2`, about 9% for the
+/// default scale 2. Values in `[2^min_exponent, 2^max_exponent)` get their own
+/// buckets. Smaller values are counted together with the zeros and larger ones
+/// as the overflow.
+///
+/// Account is lock-free and mostly contention-free: the counters are sharded
+/// by threads, with up to one shard per CPU. The shards are summed up when the
+/// metric is written.
+///
+/// The histogram is written as a utils::statistics::HistogramView with all
+/// the buckets of `[2^min_exponent, 2^max_exponent)`, every `2^k` adjacent
+/// buckets are merged to have at most 50 of them. The exported bounds depend
+/// only on the constructor arguments and do not change between the dumps.
+/// Zeros and too small values go into the first bucket, overflow goes into the
+/// "infinity" bucket.
+///
+/// Usage example:
+/// @snippet utils/statistics/exponential_histogram_test.cpp  sample
+class ExponentialHistogram final {
+public:
+    static constexpr int kDefaultScale = 2;
+    static constexpr int kMaxScale = 6;
+
+    /// @param scale `2^scale` buckets per each power of 2, from 0 to kMaxScale
+    /// @param min_exponent values starting from `2^min_exponent` get buckets
+    /// @param max_exponent values below `2^max_exponent` get buckets
+    explicit ExponentialHistogram(int scale = kDefaultScale, int min_exponent = -10, int max_exponent = 30);
+
+    ExponentialHistogram(const ExponentialHistogram&) = delete;
+    ExponentialHistogram& operator=(const ExponentialHistogram&) = delete;
+    ~ExponentialHistogram();
+
+    /// Atomically increments the bucket corresponding to the given value.
+    void Account(double value, std::uint64_t count = 1) noexcept;
+
+    /// Sums up the shards. Only the populated range of buckets is returned.
+    ExponentialHistogramData GetData() const;
+
+    /// Resets all counters to zero. Not atomic with respect to Account.
+    friend void ResetMetric(ExponentialHistogram& histogram) noexcept;
+
+    friend void DumpMetric(Writer& writer, const ExponentialHistogram& histogram);
+
+private:
+    struct alignas(64) CounterBlock final {
+        std::array<std::atomic<std::uint64_t>, 8> counters{};
+    };
+
+    std::atomic<std::uint64_t>& GetCounter(std::size_t shard, std::size_t slot) noexcept;
+    const std::atomic<std::uint64_t>& GetCounter(std::size_t shard, std::size_t slot) const noexcept;
+
+    const int scale_;
+    const std::int32_t min_index_;
+    // Slot 0 is for the zeros, the last slot is for the overflow
+    const std::size_t slot_count_;
+    // Each shard occupies whole CounterBlocks, so that the shards do not share
+    // cache lines
+    const std::size_t blocks_per_shard_;
+    const std::size_t shard_count_;
+    // 2^(i / 2^scale) for i in [0, 2^scale], the bounds within a power of 2
+    std::array<double, (1 << kMaxScale) + 1> subbucket_bounds_{};
+    // The mantissa is split into 2^(scale + 1) ranges, each has at most one
+    // subbucket bound. Contains the count of the bounds below each range.
+    std::array<std::uint8_t, (2 << kMaxScale)> subbuckets_below_{};
+    std::unique_ptr<CounterBlock[]> blocks_;
+};
+
+/// Metric serialization support for ExponentialHistogram.
+void DumpMetric(Writer& writer, const ExponentialHistogram& histogram);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -31,6 +31,9 @@ struct BoundsBlock;
 /// * Each individual counter has the semantics of utils::statistics::Rate
 /// * For best portability, there should be no more than 50 buckets
 ///
+/// @see utils::statistics::ExponentialHistogram for a histogram that does
+/// not require choosing the bounds
+///
 /// ## Histograms vs utils::statistics::Percentile
 ///
 /// @see utils::statistics::Percentile is a related metric type
@@ -3,7 +3,9 @@
 /// @file userver/utils/statistics/prometheus.hpp
 /// @brief Statistics output in Prometheus format.
 
+#include <memory>
 #include <string>
+#include <string_view>
 
 #include <userver/utils/statistics/storage.hpp>
 
@@ -34,6 +36,35 @@ ToPrometheusFormat(const utils::statistics::Storage& statistics, const utils::st
 std::string
 ToPrometheusFormatUntyped(const utils::statistics::Storage& statistics, const utils::statistics::Request& request = {});
 
+/// @brief Outputs `statistics` in Prometheus format the same way as
+/// ToPrometheusFormat or ToPrometheusFormatUntyped, but keeps the text of each
+/// metric between the calls and only re-renders the metrics whose labels or
+/// values have changed.
+///
+/// The metrics are still written on each call, the cache only saves on the
+/// formatting. It is most useful for big storages that are scraped often,
+/// where most of the metrics do not change between the scrapes. The text of
+/// the previous call is kept, so the cache takes about the size of the output.
+///
+/// The calls must be serialized, the cache is not thread-safe.
+class PrometheusFormatCache final {
+public:
+    /// @param typed whether to output the metric types, as ToPrometheusFormat does
+    explicit PrometheusFormatCache(bool typed = true);
+
+    PrometheusFormatCache(const PrometheusFormatCache&) = delete;
+    PrometheusFormatCache& operator=(const PrometheusFormatCache&) = delete;
+    ~PrometheusFormatCache();
+
+    /// Returns the text of the metrics, which is valid until the next call.
+    std::string_view
+    Format(const utils::statistics::Storage& statistics, const utils::statistics::Request& request = {});
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace utils::statistics
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,173 @@
+#include <clients/http/circuit_breaker.hpp>
+
+#include <algorithm>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+std::chrono::steady_clock::rep Now() noexcept { return utils::datetime::SteadyNow().time_since_epoch().count(); }
+
+template <typename Duration>
+std::chrono::steady_clock::rep ToRep(Duration duration) noexcept {
+    return std::chrono::duration_cast<std::chrono::steady_clock::duration>(duration).count();
+}
+
+}  // namespace
+
+CircuitBreakerStatistics& CircuitBreakerStatistics::operator+=(const CircuitBreakerStatistics& other) {
+    opened += other.opened;
+    half_opened += other.half_opened;
+    closed += other.closed;
+    rejected += other.rejected;
+    return *this;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const CircuitBreakerStatistics& stats) {
+    writer["opened"] = stats.opened;
+    writer["half-opened"] = stats.half_opened;
+    writer["closed"] = stats.closed;
+    writer["rejected"] = stats.rejected;
+}
+
+bool CircuitBreaker::TryAcquire() noexcept {
+    if (!enabled_.load(std::memory_order_relaxed)) return true;
+
+    switch (state_.load()) {
+        case State::kClosed:
+            return true;
+        case State::kOpen:
+            if (TryHalfOpen(Now())) return true;
+            break;
+        case State::kHalfOpen:
+            if (TryAcquireProbe(Now())) return true;
+            break;
+    }
+
+    ++rejected_;
+    return false;
+}
+
+void CircuitBreaker::AccountOk() noexcept { AccountResult(/*failed=*/false); }
+
+void CircuitBreaker::AccountFail() noexcept { AccountResult(/*failed=*/true); }
+
+CircuitBreaker::State CircuitBreaker::GetState() const noexcept { return state_.load(); }
+
+CircuitBreakerStatistics CircuitBreaker::GetStatistics() const noexcept {
+    return {opened_.Load(), half_opened_.Load(), closed_.Load(), rejected_.Load()};
+}
+
+void CircuitBreaker::SetConfig(const impl::CircuitBreakerConfig& config) noexcept {
+    failure_rate_threshold_.store(config.failure_rate_threshold, std::memory_order_relaxed);
+    min_requests_.store(std::max<std::uint64_t>(config.min_requests, 1), std::memory_order_relaxed);
+    window_.store(ToRep(config.window), std::memory_order_relaxed);
+    open_duration_.store(ToRep(config.open_duration), std::memory_order_relaxed);
+    half_open_probes_.store(std::max<std::uint64_t>(config.half_open_probes, 1), std::memory_order_relaxed);
+
+    if (!config.enabled && enabled_.exchange(false)) {
+        // Do not keep failing the requests after the breaker is re-enabled
+        const auto now = Now();
+        if (!Close(State::kHalfOpen, now)) Close(State::kOpen, now);
+    }
+    enabled_.store(config.enabled);
+}
+
+void CircuitBreaker::AccountResult(bool failed) noexcept {
+    if (!enabled_.load(std::memory_order_relaxed)) return;
+
+    const auto now = Now();
+    switch (state_.load()) {
+        case State::kClosed:
+            AccountInWindow(failed, now);
+            break;
+        case State::kOpen:
+            // Results of the requests sent before the breaker opened
+            break;
+        case State::kHalfOpen:
+            if (failed) {
+                Open(State::kHalfOpen, now);
+            } else if (probes_succeeded_.fetch_add(1) + 1 >= half_open_probes_.load(std::memory_order_relaxed)) {
+                Close(State::kHalfOpen, now);
+            }
+            break;
+    }
+}
+
+void CircuitBreaker::AccountInWindow(bool failed, Clock::rep now) noexcept {
+    auto window_start = window_start_.load();
+    if (now - window_start >= window_.load(std::memory_order_relaxed) &&
+        window_start_.compare_exchange_strong(window_start, now)) {
+        window_requests_ = 0;
+        window_failures_ = 0;
+    }
+
+    const auto requests = window_requests_.fetch_add(1) + 1;
+    const auto failures = failed ? window_failures_.fetch_add(1) + 1 : window_failures_.load();
+    if (!failed || requests < min_requests_.load(std::memory_order_relaxed)) return;
+
+    if (static_cast<double>(failures) >=
+        failure_rate_threshold_.load(std::memory_order_relaxed) * static_cast<double>(requests)) {
+        Open(State::kClosed, now);
+    }
+}
+
+void CircuitBreaker::Open(State from, Clock::rep now) noexcept {
+    // Nobody uses the probes while the breaker is open
+    probes_started_ = 0;
+    probes_succeeded_ = 0;
+    state_since_ = now;
+    if (state_.compare_exchange_strong(from, State::kOpen)) {
+        ++opened_;
+        if (from == State::kClosed) {
+            LOG_LIMITED_WARNING() << "HTTP client circuit breaker is open, the requests to the destination fail "
+                                     "fast, see HTTP_CLIENT_CIRCUIT_BREAKER";
+        }
+    }
+}
+
+bool CircuitBreaker::TryHalfOpen(Clock::rep now) noexcept {
+    if (now - state_since_.load() < open_duration_.load(std::memory_order_relaxed)) return false;
+
+    auto expected = State::kOpen;
+    if (state_.compare_exchange_strong(expected, State::kHalfOpen)) {
+        state_since_ = now;
+        ++half_opened_;
+    }
+    return TryAcquireProbe(now);
+}
+
+bool CircuitBreaker::TryAcquireProbe(Clock::rep now) noexcept {
+    if (probes_started_.fetch_add(1) < half_open_probes_.load(std::memory_order_relaxed)) return true;
+
+    // The results of cancelled probes are never accounted, so let new probes
+    // through if the previous ones did not decide for too long
+    auto since = state_since_.load();
+    if (now - since >= open_duration_.load(std::memory_order_relaxed) &&
+        state_since_.compare_exchange_strong(since, now)) {
+        probes_started_ = 1;
+        probes_succeeded_ = 0;
+        return true;
+    }
+    return false;
+}
+
+bool CircuitBreaker::Close(State from, Clock::rep now) noexcept {
+    window_start_ = now;
+    window_requests_ = 0;
+    window_failures_ = 0;
+    state_since_ = now;
+
+    if (!state_.compare_exchange_strong(from, State::kClosed)) return false;
+    ++closed_;
+    return true;
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <userver/clients/http/config.hpp>
+#include <userver/utils/statistics/rate.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+struct CircuitBreakerStatistics {
+    utils::statistics::Rate opened;
+    utils::statistics::Rate half_opened;
+    utils::statistics::Rate closed;
+    utils::statistics::Rate rejected;
+
+    CircuitBreakerStatistics& operator+=(const CircuitBreakerStatistics& other);
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const CircuitBreakerStatistics& stats);
+
+/// Fails the requests to a destination fast while the destination fails too
+/// many of them, see HTTP_CLIENT_CIRCUIT_BREAKER for the details.
+///
+/// The state is kept in atomics without locks, so the failure rate is
+/// approximate under concurrent updates. Disabled by default.
+class CircuitBreaker final {
+public:
+    enum class State : std::uint8_t {
+        kClosed,
+        kOpen,
+        kHalfOpen,
+    };
+
+    CircuitBreaker() = default;
+
+    CircuitBreaker(const CircuitBreaker&) = delete;
+    CircuitBreaker& operator=(const CircuitBreaker&) = delete;
+
+    /// Call before sending a request, returns false if the request must fail
+    /// without being sent. Each allowed request must be accounted.
+    bool TryAcquire() noexcept;
+
+    /// Call after a request succeeds.
+    void AccountOk() noexcept;
+
+    /// Call after a request fails.
+    void AccountFail() noexcept;
+
+    State GetState() const noexcept;
+
+    CircuitBreakerStatistics GetStatistics() const noexcept;
+
+    /// Thread-safe relative to other methods.
+    void SetConfig(const impl::CircuitBreakerConfig& config) noexcept;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void AccountResult(bool failed) noexcept;
+    void AccountInWindow(bool failed, Clock::rep now) noexcept;
+    void Open(State from, Clock::rep now) noexcept;
+    bool TryHalfOpen(Clock::rep now) noexcept;
+    bool TryAcquireProbe(Clock::rep now) noexcept;
+    bool Close(State from, Clock::rep now) noexcept;
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<double> failure_rate_threshold_{0.5};
+    std::atomic<std::uint64_t> min_requests_{20};
+    std::atomic<Clock::rep> window_{0};
+    std::atomic<Clock::rep> open_duration_{0};
+    std::atomic<std::uint64_t> half_open_probes_{3};
+
+    std::atomic<State> state_{State::kClosed};
+    // When the current state was entered
+    std::atomic<Clock::rep> state_since_{0};
+
+    std::atomic<Clock::rep> window_start_{0};
+    std::atomic<std::uint64_t> window_requests_{0};
+    std::atomic<std::uint64_t> window_failures_{0};
+
+    std::atomic<std::uint64_t> probes_started_{0};
+    std::atomic<std::uint64_t> probes_succeeded_{0};
+
+    utils::statistics::RateCounter opened_;
+    utils::statistics::RateCounter half_opened_;
+    utils::statistics::RateCounter closed_;
+    utils::statistics::RateCounter rejected_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,209 @@
+#include <clients/http/circuit_breaker.hpp>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/clients/http/error.hpp>
+#include <userver/utest/http_client.hpp>
+#include <userver/utest/simple_server.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/mock_now.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using State = clients::http::CircuitBreaker::State;
+using HttpResponse = utest::SimpleServer::Response;
+using HttpRequest = utest::SimpleServer::Request;
+
+constexpr std::chrono::milliseconds kOpenDuration{5000};
+
+clients::http::impl::CircuitBreakerConfig MakeConfig() {
+    clients::http::impl::CircuitBreakerConfig config;
+    config.enabled = true;
+    config.failure_rate_threshold = 0.5;
+    config.min_requests = 4;
+    config.window = std::chrono::seconds{10};
+    config.open_duration = kOpenDuration;
+    config.half_open_probes = 2;
+    return config;
+}
+
+void Open(clients::http::CircuitBreaker& breaker) {
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(breaker.TryAcquire());
+        breaker.AccountFail();
+    }
+    ASSERT_EQ(breaker.GetState(), State::kOpen);
+}
+
+HttpResponse ServerErrorCallback(const HttpRequest&) {
+    return {"HTTP/1.1 500 Internal Server Error\r\nContent-Length: 0\r\n\r\n", HttpResponse::kWriteAndContinue};
+}
+
+}  // namespace
+
+TEST(HttpClientCircuitBreaker, DisabledByDefault) {
+    clients::http::CircuitBreaker breaker;
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(breaker.TryAcquire());
+        breaker.AccountFail();
+    }
+    EXPECT_EQ(breaker.GetState(), State::kClosed);
+}
+
+TEST(HttpClientCircuitBreaker, OpensOnFailureRate) {
+    utils::datetime::MockNowSet(utils::datetime::Now());
+    clients::http::CircuitBreaker breaker;
+    breaker.SetConfig(MakeConfig());
+
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(breaker.TryAcquire());
+        breaker.AccountOk();
+    }
+    // Too few failures
+    for (int i = 0; i < 2; ++i) {
+        EXPECT_TRUE(breaker.TryAcquire());
+        breaker.AccountFail();
+    }
+    EXPECT_EQ(breaker.GetState(), State::kClosed);
+
+    EXPECT_TRUE(breaker.TryAcquire());
+    breaker.AccountFail();
+    EXPECT_EQ(breaker.GetState(), State::kOpen);
+
+    EXPECT_FALSE(breaker.TryAcquire());
+    EXPECT_FALSE(breaker.TryAcquire());
+
+    const auto stats = breaker.GetStatistics();
+    EXPECT_EQ(stats.opened.value, 1);
+    EXPECT_EQ(stats.rejected.value, 2);
+    utils::datetime::MockNowUnset();
+}
+
+TEST(HttpClientCircuitBreaker, WindowExpires) {
+    utils::datetime::MockNowSet(utils::datetime::Now());
+    clients::http::CircuitBreaker breaker;
+    breaker.SetConfig(MakeConfig());
+
+    for (int i = 0; i < 3; ++i) breaker.AccountFail();
+    utils::datetime::MockSleep(std::chrono::seconds{11});
+
+    breaker.AccountFail();
+    EXPECT_EQ(breaker.GetState(), State::kClosed);
+    utils::datetime::MockNowUnset();
+}
+
+TEST(HttpClientCircuitBreaker, HalfOpenCloses) {
+    utils::datetime::MockNowSet(utils::datetime::Now());
+    clients::http::CircuitBreaker breaker;
+    breaker.SetConfig(MakeConfig());
+    Open(breaker);
+
+    utils::datetime::MockSleep(kOpenDuration);
+    EXPECT_TRUE(breaker.TryAcquire());
+    EXPECT_EQ(breaker.GetState(), State::kHalfOpen);
+    EXPECT_TRUE(breaker.TryAcquire());
+    // Only half_open_probes requests are let through
+    EXPECT_FALSE(breaker.TryAcquire());
+
+    breaker.AccountOk();
+    EXPECT_EQ(breaker.GetState(), State::kHalfOpen);
+    breaker.AccountOk();
+    EXPECT_EQ(breaker.GetState(), State::kClosed);
+    EXPECT_TRUE(breaker.TryAcquire());
+
+    const auto stats = breaker.GetStatistics();
+    EXPECT_EQ(stats.opened.value, 1);
+    EXPECT_EQ(stats.half_opened.value, 1);
+    EXPECT_EQ(stats.closed.value, 1);
+    utils::datetime::MockNowUnset();
+}
+
+TEST(HttpClientCircuitBreaker, HalfOpenReopens) {
+    utils::datetime::MockNowSet(utils::datetime::Now());
+    clients::http::CircuitBreaker breaker;
+    breaker.SetConfig(MakeConfig());
+    Open(breaker);
+
+    utils::datetime::MockSleep(kOpenDuration);
+    EXPECT_TRUE(breaker.TryAcquire());
+    breaker.AccountFail();
+    EXPECT_EQ(breaker.GetState(), State::kOpen);
+    EXPECT_FALSE(breaker.TryAcquire());
+
+    utils::datetime::MockSleep(kOpenDuration);
+    EXPECT_TRUE(breaker.TryAcquire());
+    EXPECT_EQ(breaker.GetStatistics().opened.value, 2);
+    utils::datetime::MockNowUnset();
+}
+
+TEST(HttpClientCircuitBreaker, LostProbes) {
+    utils::datetime::MockNowSet(utils::datetime::Now());
+    clients::http::CircuitBreaker breaker;
+    breaker.SetConfig(MakeConfig());
+    Open(breaker);
+
+    utils::datetime::MockSleep(kOpenDuration);
+    // The results of the probes are never accounted, e.g. they were cancelled
+    EXPECT_TRUE(breaker.TryAcquire());
+    EXPECT_TRUE(breaker.TryAcquire());
+    EXPECT_FALSE(breaker.TryAcquire());
+
+    utils::datetime::MockSleep(kOpenDuration);
+    EXPECT_TRUE(breaker.TryAcquire());
+    utils::datetime::MockNowUnset();
+}
+
+TEST(HttpClientCircuitBreaker, DisablingCloses) {
+    utils::datetime::MockNowSet(utils::datetime::Now());
+    clients::http::CircuitBreaker breaker;
+    auto config = MakeConfig();
+    breaker.SetConfig(config);
+    Open(breaker);
+
+    config.enabled = false;
+    breaker.SetConfig(config);
+    EXPECT_TRUE(breaker.TryAcquire());
+
+    config.enabled = true;
+    breaker.SetConfig(config);
+    EXPECT_EQ(breaker.GetState(), State::kClosed);
+    EXPECT_TRUE(breaker.TryAcquire());
+    utils::datetime::MockNowUnset();
+}
+
+UTEST(HttpClientCircuitBreaker, FailsFast) {
+    const utest::SimpleServer http_server{&ServerErrorCallback};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    clients::http::impl::Config config;
+    config.circuit_breaker = MakeConfig();
+    http_client_ptr->SetConfig(config);
+
+    const auto make_request = [&] {
+        return http_client_ptr->CreateRequest()
+            .get(http_server.GetBaseUrl())
+            .retry(1)
+            .timeout(utest::kMaxTestWaitTime)
+            .SetDestinationMetricName("circuit-breaker-test");
+    };
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(make_request().perform()->status_code(), 500);
+    }
+    UEXPECT_THROW((void)make_request().perform(), clients::http::CircuitBreakerOpenException);
+
+    // Other destinations are not affected
+    EXPECT_EQ(
+        http_client_ptr->CreateRequest()
+            .get(http_server.GetBaseUrl())
+            .retry(1)
+            .timeout(utest::kMaxTestWaitTime)
+            .perform()
+            ->status_code(),
+        500
+    );
+}
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <cstdlib>
+#include <functional>
 #include <limits>
 
 #include <moodycamel/concurrentqueue.h>
@@ -19,6 +20,7 @@
 #include <clients/http/testsuite.hpp>
 #include <curl-ev/multi.hpp>
 #include <curl-ev/ratelimit.hpp>
+#include <curl-ev/share.hpp>
 #include <engine/ev/thread_pool.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -47,8 +49,9 @@ Client::Client(
 )
     : deadline_propagation_config_(settings.deadline_propagation),
       cancellation_policy_(settings.cancellation_policy),
-      destination_statistics_(std::make_shared<DestinationStatistics>()),
+      destination_statistics_(std::make_shared<DestinationStatistics>(settings.retry_budget)),
       statistics_(settings.io_threads),
+      destination_affinity_enabled_(settings.destination_affinity_enabled),
       fs_task_processor_(fs_task_processor),
       user_agent_(utils::GetUserverIdentifier()),
       connect_rate_limiter_(std::make_shared<curl::ConnectRateLimiter>()),
@@ -75,6 +78,13 @@ Client::Client(
         }
     }).Get();
 
+    if (settings.ssl_session_sharing_enabled) {
+        // Unlike the connection cache, the TLS session cache of a share is safe
+        // to use from several threads, the share serializes the access to it
+        ssl_session_share_ = std::make_shared<curl::share>();
+        ssl_session_share_->set_share_ssl_session(true);
+    }
+
     easy_reinit_task_.Start("http_easy_reinit", utils::PeriodicTask::Settings(kEasyReinitPeriod), [this] {
         ReinitEasy();
     });
@@ -208,6 +218,11 @@ size_t Client::FindMultiIndex(const curl::multi* multi) const {
     throw std::logic_error("Unknown multi");
 }
 
+size_t Client::GetDestinationMultiIndex(std::string_view destination) const {
+    UASSERT(destination_affinity_enabled_);
+    return std::hash<std::string_view>{}(destination) % multis_.size();
+}
+
 PoolStatistics Client::GetPoolStatistics() const {
     PoolStatistics stats;
     stats.multi.reserve(multis_.size());
@@ -266,6 +281,8 @@ void Client::SetConfig(const impl::Config& config) {
     );
 
     proxy_.Assign(config.proxy);
+
+    destination_statistics_->SetCircuitBreakerConfig(config.circuit_breaker);
 }
 
 void Client::ResetUserAgent(std::optional<std::string> user_agent) { user_agent_ = std::move(user_agent); }
@@ -7,6 +7,7 @@
 #include <boost/algorithm/string/trim.hpp>
 
 #include <clients/http/client_utils_test.hpp>
+#include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
 #include <engine/task/task_processor.hpp>
 #include <userver/clients/dns/resolver.hpp>
@@ -18,11 +19,13 @@
 #include <userver/engine/async.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/blocking/temp_file.hpp>
 #include <userver/fs/blocking/write.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/http/http_version.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/tracing/manager.hpp>
 #include <userver/tracing/tracing.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/userver_info.hpp>
@@ -245,6 +248,60 @@ struct AuthCallback {
     }
 };
 
+// Echoes the request body, either chunked or with Content-Length
+HttpResponse upload_echo_callback(const HttpRequest& request) {
+    const auto headers_end = request.find("\r\n\r\n");
+    if (headers_end == std::string::npos) {
+        return {{}, HttpResponse::kTryReadMore};
+    }
+    const std::string_view headers{request.data(), headers_end};
+    std::string_view body{request};
+    body.remove_prefix(headers_end + 4);
+
+    std::string payload;
+    if (headers.find("Transfer-Encoding: chunked") != std::string_view::npos) {
+        while (true) {
+            const auto size_end = body.find("\r\n");
+            if (size_end == std::string_view::npos) {
+                return {{}, HttpResponse::kTryReadMore};
+            }
+            const auto chunk_size = std::stoul(std::string{body.substr(0, size_end)}, nullptr, 16);
+            if (body.size() < size_end + chunk_size + 4) {
+                return {{}, HttpResponse::kTryReadMore};
+            }
+            if (chunk_size == 0) break;
+            payload += body.substr(size_end + 2, chunk_size);
+            body.remove_prefix(size_end + chunk_size + 4);
+        }
+    } else {
+        constexpr std::string_view kContentLength = "Content-Length: ";
+        const auto length_pos = headers.find(kContentLength);
+        EXPECT_NE(length_pos, std::string_view::npos) << "No body size in request: " << request;
+        const auto length = std::stoul(std::string{headers.substr(length_pos + kContentLength.size())});
+        if (body.size() < length) {
+            return {{}, HttpResponse::kTryReadMore};
+        }
+        payload = body;
+    }
+
+    return {
+        fmt::format("HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: {}\r\n\r\n{}", payload.size(), payload),
+        HttpResponse::kWriteAndClose};
+}
+
+// Returns the body of the given size in a single response
+struct LargeBodyCallback {
+    std::size_t body_size;
+
+    HttpResponse operator()(const HttpRequest& request) const {
+        LOG_INFO() << "HTTP Server receive: " << request;
+        return {
+            fmt::format("HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: {}\r\n\r\n", body_size) +
+                std::string(body_size, 'x'),
+            HttpResponse::kWriteAndClose};
+    }
+};
+
 HttpResponse put_validate_callback(const HttpRequest& request) {
     LOG_INFO() << "HTTP Server receive: " << request;
 
@@ -1551,4 +1608,142 @@ UTEST(HttpClient, DigestAuth) {
     }
 }
 
+UTEST(HttpClient, DestinationAffinity) {
+    static const tracing::GenericTracingManager kTracingManager{
+        tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+
+    clients::http::ClientSettings settings;
+    settings.io_threads = 4;
+    settings.destination_affinity_enabled = true;
+    settings.tracing_manager = &kTracingManager;
+    clients::http::Client http_client{
+        std::move(settings),
+        engine::current_task::GetTaskProcessor(),
+        std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+    const utest::SimpleServer http_server{[](const HttpRequest& request) {
+        LOG_INFO() << "HTTP Server receive: " << request;
+        return HttpResponse{"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n", HttpResponse::kWriteAndContinue};
+    }};
+
+    // Each of the requests gets its own easy handle bound to a random IO thread
+    constexpr std::size_t kRequests = 16;
+    std::vector<clients::http::Request> requests;
+    for (std::size_t i = 0; i < kRequests; ++i) {
+        requests.push_back(http_client.CreateRequest().get(http_server.GetBaseUrl()).retry(1).timeout(kTimeout));
+    }
+    for (auto& request : requests) {
+        EXPECT_EQ(request.perform()->status_code(), 200);
+    }
+
+    // All the requests are performed by the same IO thread over a single connection
+    EXPECT_EQ(http_server.GetConnectionsOpenedCount(), 1);
+
+    // ...and are accounted in the statistics of that IO thread
+    utils::statistics::Rate reused;
+    std::size_t threads_with_reused = 0;
+    for (const auto& stats : http_client.GetPoolStatistics().multi) {
+        reused += stats.connections_reused;
+        if (stats.connections_reused) ++threads_with_reused;
+    }
+    EXPECT_EQ(reused, utils::statistics::Rate{kRequests - 1});
+    EXPECT_EQ(threads_with_reused, 1);
+}
+
+UTEST(HttpClient, UploadBodyChunked) {
+    const utest::SimpleServer http_server{&upload_echo_callback};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    constexpr std::size_t kParts = 1000;
+    std::size_t parts_sent = 0;
+    auto body_source = [&parts_sent](char* buffer, std::size_t size) -> std::size_t {
+        if (parts_sent == kParts) return 0;
+        const auto part = fmt::format("{:04};", parts_sent++);
+        EXPECT_GE(size, part.size());
+        part.copy(buffer, part.size());
+        return part.size();
+    };
+
+    const auto response = http_client_ptr->CreateRequest()
+                              .url(http_server.GetBaseUrl())
+                              .upload_body(body_source)
+                              .post()
+                              .http_version(USERVER_NAMESPACE::http::HttpVersion::k11)
+                              .retry(1)
+                              .timeout(kTimeout)
+                              .perform();
+
+    EXPECT_EQ(response->status_code(), 200);
+    ASSERT_EQ(response->body().size(), kParts * 5);
+    EXPECT_EQ(response->body().substr(0, 10), "0000;0001;");
+    EXPECT_EQ(parts_sent, kParts);
+}
+
+UTEST(HttpClient, UploadFile) {
+    const utest::SimpleServer http_server{&upload_echo_callback};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    const auto file = fs::blocking::TempFile::Create();
+    const std::string contents(100 * 1024, 'f');
+    fs::blocking::RewriteFileContents(file.GetPath(), contents);
+    auto fd = fs::blocking::FileDescriptor::Open(file.GetPath(), fs::blocking::OpenFlag::kRead);
+
+    const auto response = http_client_ptr->CreateRequest()
+                              .url(http_server.GetBaseUrl())
+                              .upload_file(std::move(fd))
+                              .put()
+                              .retry(1)
+                              .timeout(kTimeout)
+                              .perform();
+
+    EXPECT_EQ(response->status_code(), 200);
+    EXPECT_EQ(response->body(), contents);
+}
+
+UTEST(HttpClient, HeadWithLargeContentLength) {
+    const utest::SimpleServer http_server{[](const HttpRequest&) {
+        return HttpResponse{"HTTP/1.1 200 OK\r\nContent-Length: 1000000000\r\n\r\n", HttpResponse::kWriteAndClose};
+    }};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    // No memory is reserved for a body that never comes
+    auto response =
+        http_client_ptr->CreateRequest().head(http_server.GetBaseUrl()).retry(1).timeout(kTimeout).perform();
+    EXPECT_EQ(response->status_code(), 200);
+    const auto body = std::move(*response).body();
+    EXPECT_TRUE(body.empty());
+    EXPECT_LT(body.capacity(), 1024 * 1024);
+}
+
+UTEST(HttpClient, StreamBodyBackpressure) {
+    constexpr std::size_t kBodySize = 4 * 1024 * 1024;
+    constexpr std::size_t kQueueSize = 64 * 1024;
+    const utest::SimpleServer http_server{LargeBodyCallback{kBodySize}};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    // The queue is much smaller than the body, the transfer pauses until the
+    // chunks are read
+    auto queue = concurrent::StringStreamQueue::Create(kQueueSize);
+    auto stream_response = http_client_ptr->CreateRequest()
+                               .get(http_server.GetBaseUrl())
+                               .retry(1)
+                               .timeout(kTimeout)
+                               .async_perform_stream_body(queue);
+    EXPECT_EQ(stream_response.StatusCode(), 200);
+
+    std::string body_part;
+    std::size_t total_size = 0;
+    std::size_t chunks = 0;
+    const auto deadline = engine::Deadline::FromDuration(kTimeout);
+    while (stream_response.ReadChunk(body_part, deadline)) {
+        EXPECT_LE(queue->GetSizeApproximate(), kQueueSize);
+        total_size += body_part.size();
+        if (++chunks % 16 == 0) {
+            // A slow consumer
+            engine::Yield();
+        }
+    }
+    EXPECT_EQ(total_size, kBodySize);
+}
+
 USERVER_NAMESPACE_END
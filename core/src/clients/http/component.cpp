@@ -63,12 +63,24 @@ constexpr dynamic_config::DefaultAsJsonString kThrottleDefaults{R"(
 }
 )"};
 
+constexpr dynamic_config::DefaultAsJsonString kCircuitBreakerDefaults{R"(
+{
+  "enabled": false,
+  "failure-rate-threshold": 0.5,
+  "min-requests": 20,
+  "window-ms": 10000,
+  "open-duration-ms": 5000,
+  "half-open-probes": 3
+}
+)"};
+
 const dynamic_config::Key kClientConfig{
     clients::http::impl::ParseConfig,
     {
         {"HTTP_CLIENT_CONNECTION_POOL_SIZE", 1000},
         {"USERVER_HTTP_PROXY", ""},
         {"HTTP_CLIENT_CONNECT_THROTTLE", kThrottleDefaults},
+        {"HTTP_CLIENT_CIRCUIT_BREAKER", kCircuitBreakerDefaults},
     },
 };
 /// [docs map config sample]
@@ -231,6 +243,39 @@ properties:
         enum:
           - cancel
           - ignore
+    destination-affinity-enabled:
+        type: boolean
+        description: |
+            Perform all the requests to the same scheme, host and port on the same IO thread,
+            so that the connections and HTTP/2 sessions to a destination are not duplicated
+            in each of the threads
+        defaultDescription: false
+    ssl-session-sharing-enabled:
+        type: boolean
+        description: |
+            Share the TLS session cache between the IO threads, so that a new connection
+            may resume the session of a connection from another thread
+        defaultDescription: false
+    retry-budget:
+        type: object
+        description: |
+            Per destination budget for the retries and hedges, see utils::RetryBudget.
+            Retries and hedges are allowed while the failed attempts have not
+            exhausted a half of the tokens.
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: whether to limit the retries and hedges
+                defaultDescription: false
+            max-tokens:
+                type: number
+                description: maximum number of tokens, each failed attempt takes one
+                defaultDescription: 100
+            token-ratio:
+                type: number
+                description: number of tokens returned by each successful attempt
+                defaultDescription: 0.1
 )");
 }
 
@@ -1,5 +1,6 @@
 #include <userver/clients/http/config.hpp>
 
+#include <cstdint>
 #include <string_view>
 
 #include <userver/dynamic_config/value.hpp>
@@ -38,6 +39,14 @@ DeadlinePropagationConfig ParseDeadlinePropagationConfig(const yaml_config::Yaml
     return result;
 }
 
+utils::RetryBudgetSettings
+ParseRetryBudgetSettings(const yaml_config::YamlConfig& value, utils::RetryBudgetSettings result) {
+    result.enabled = value["enabled"].As<bool>(result.enabled);
+    result.max_tokens = value["max-tokens"].As<float>(result.max_tokens);
+    result.token_ratio = value["token-ratio"].As<float>(result.token_ratio);
+    return result;
+}
+
 }  // namespace
 
 CancellationPolicy Parse(yaml_config::YamlConfig value, formats::parse::To<CancellationPolicy>) {
@@ -52,6 +61,11 @@ ClientSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<Cl
     result.thread_name_prefix = value["thread-name-prefix"].As<std::string>(result.thread_name_prefix);
     result.io_threads = value["threads"].As<size_t>(result.io_threads);
     result.deadline_propagation = ParseDeadlinePropagationConfig(value);
+    result.destination_affinity_enabled =
+        value["destination-affinity-enabled"].As<bool>(result.destination_affinity_enabled);
+    result.ssl_session_sharing_enabled =
+        value["ssl-session-sharing-enabled"].As<bool>(result.ssl_session_sharing_enabled);
+    result.retry_budget = ParseRetryBudgetSettings(value["retry-budget"], result.retry_budget);
     return result;
 }
 
@@ -73,11 +87,24 @@ ThrottleConfig Parse(const formats::json::Value& value, formats::parse::To<Throt
     return result;
 }
 
+CircuitBreakerConfig Parse(const formats::json::Value& value, formats::parse::To<CircuitBreakerConfig>) {
+    CircuitBreakerConfig result;
+    result.enabled = value["enabled"].As<bool>(result.enabled);
+    result.failure_rate_threshold = value["failure-rate-threshold"].As<double>(result.failure_rate_threshold);
+    result.min_requests = value["min-requests"].As<std::size_t>(result.min_requests);
+    result.window = std::chrono::milliseconds{value["window-ms"].As<std::int64_t>(result.window.count())};
+    result.open_duration =
+        std::chrono::milliseconds{value["open-duration-ms"].As<std::int64_t>(result.open_duration.count())};
+    result.half_open_probes = value["half-open-probes"].As<std::size_t>(result.half_open_probes);
+    return result;
+}
+
 Config ParseConfig(const dynamic_config::DocsMap& docs_map) {
     Config result;
     result.connection_pool_size = docs_map.Get("HTTP_CLIENT_CONNECTION_POOL_SIZE").As<std::size_t>();
     result.proxy = docs_map.Get("USERVER_HTTP_PROXY").As<std::string>();
     result.throttle = docs_map.Get("HTTP_CLIENT_CONNECT_THROTTLE").As<ThrottleConfig>();
+    result.circuit_breaker = docs_map.Get("HTTP_CLIENT_CIRCUIT_BREAKER").As<CircuitBreakerConfig>();
     return result;
 }
 
@@ -7,6 +7,9 @@ USERVER_NAMESPACE_BEGIN
 
 namespace clients::http {
 
+DestinationStatistics::DestinationStatistics(const utils::RetryBudgetSettings& retry_budget_settings)
+    : retry_budget_settings_(retry_budget_settings) {}
+
 std::shared_ptr<RequestStats> DestinationStatistics::GetStatisticsForDestination(const std::string& destination) {
     auto ptr = GetExistingStatisticsForDestination(destination);
     if (ptr) return ptr;
@@ -15,7 +18,9 @@ std::shared_ptr<RequestStats> DestinationStatistics::GetStatisticsForDestination
 }
 
 std::shared_ptr<RequestStats> DestinationStatistics::CreateStatisticsForDestination(const std::string& destination) {
-    return std::make_shared<RequestStats>(*rcu_map_[destination]);
+    auto [stats, inserted] = rcu_map_.TryEmplace(destination, retry_budget_settings_);
+    if (inserted) stats->GetCircuitBreaker().SetConfig(circuit_breaker_config_.ReadCopy());
+    return std::make_shared<RequestStats>(*stats);
 }
 
 std::shared_ptr<RequestStats> DestinationStatistics::GetExistingStatisticsForDestination(const std::string& destination
@@ -59,6 +64,15 @@ void DestinationStatistics::SetAutoMaxSize(size_t max_auto_destinations) {
     max_auto_destinations_ = max_auto_destinations;
 }
 
+void DestinationStatistics::SetCircuitBreakerConfig(const impl::CircuitBreakerConfig& config) {
+    // Destinations created concurrently read either the new config or are
+    // already visible to the loop below
+    circuit_breaker_config_.Assign(config);
+    for (const auto& [destination, stats] : rcu_map_) {
+        stats->GetCircuitBreaker().SetConfig(config);
+    }
+}
+
 DestinationStatistics::DestinationsMap::ConstIterator DestinationStatistics::begin() const { return rcu_map_.begin(); }
 
 DestinationStatistics::DestinationsMap::ConstIterator DestinationStatistics::end() const { return rcu_map_.end(); }
@@ -3,6 +3,8 @@
 #include <memory>
 #include <unordered_map>
 
+#include <userver/clients/http/config.hpp>
+#include <userver/rcu/rcu.hpp>
 #include <userver/rcu/rcu_map.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 
@@ -14,6 +16,11 @@ namespace clients::http {
 
 class DestinationStatistics final {
 public:
+    DestinationStatistics() = default;
+
+    // The retry budget settings for the Statistics of each destination
+    explicit DestinationStatistics(const utils::RetryBudgetSettings& retry_budget_settings);
+
     // Return pointer to related RequestStats
     std::shared_ptr<RequestStats> GetStatisticsForDestination(const std::string& destination);
 
@@ -23,6 +30,9 @@ public:
 
     void SetAutoMaxSize(size_t max_auto_destinations);
 
+    // Applies to the circuit breakers of the existing and new destinations
+    void SetCircuitBreakerConfig(const impl::CircuitBreakerConfig& config);
+
     using DestinationsMap = rcu::RcuMap<std::string, Statistics>;
 
     DestinationsMap::ConstIterator begin() const;
@@ -34,6 +44,8 @@ private:
     std::shared_ptr<RequestStats> CreateStatisticsForDestination(const std::string& destination);
 
     rcu::RcuMap<std::string, Statistics> rcu_map_;
+    const utils::RetryBudgetSettings retry_budget_settings_{kDisabledRetryBudget};
+    rcu::Variable<impl::CircuitBreakerConfig> circuit_breaker_config_;
     size_t max_auto_destinations_{0};
     std::atomic<size_t> current_auto_destinations_{0};
 };
@@ -1,14 +1,23 @@
 #include <clients/http/easy_wrapper.hpp>
 
+#include <fmt/format.h>
+
 #include <userver/clients/http/client.hpp>
 #include <userver/clients/http/response_future.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <clients/http/statistics.hpp>
+#include <curl-ev/url.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace clients::http::impl {
 
 EasyWrapper::EasyWrapper(std::shared_ptr<curl::easy>&& easy, Client& client) : easy_(std::move(easy)), client_(client) {
+    // The share is dropped by easy reset in Client::PushIdleEasy
+    if (client_.ssl_session_share_) {
+        easy_->set_share(client_.ssl_session_share_);
+    }
     client_.IncPending();
 }
 
@@ -24,6 +33,26 @@ curl::easy& EasyWrapper::Easy() { return *easy_; }
 
 const curl::easy& EasyWrapper::Easy() const { return *easy_; }
 
+bool EasyWrapper::IsDestinationAffinityEnabled() const noexcept { return client_.destination_affinity_enabled_; }
+
+Statistics* EasyWrapper::BindToDestination(const curl::url& target) {
+    std::error_code ec;
+    const auto scheme = target.GetSchemePtr(ec);
+    if (ec) return nullptr;
+    const auto host = target.GetHostPtr(ec);
+    if (ec) return nullptr;
+    const auto port = target.GetPortPtr(ec);
+    if (ec) return nullptr;
+
+    const auto index =
+        client_.GetDestinationMultiIndex(fmt::format("{}://{}:{}", scheme.get(), host.get(), port.get()));
+    auto& multi = *client_.multis_[index];
+    if (easy_->GetMulti() == &multi) return nullptr;
+
+    easy_->Rebind(multi);
+    return &client_.statistics_[index];
+}
+
 }  // namespace clients::http::impl
 
 USERVER_NAMESPACE_END
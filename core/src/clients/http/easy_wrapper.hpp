@@ -8,6 +8,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace clients::http {
 class Client;
+class Statistics;
 }  // namespace clients::http
 
 namespace clients::http::impl {
@@ -26,6 +27,14 @@ public:
     curl::easy& Easy();
     const curl::easy& Easy() const;
 
+    bool IsDestinationAffinityEnabled() const noexcept;
+
+    // Moves the easy to the IO thread that serves the scheme, host and port of
+    // `target`. Must not be called while the request is being performed.
+    // Returns the statistics of the new IO thread, nullptr if the easy was not
+    // moved.
+    Statistics* BindToDestination(const curl::url& target);
+
 private:
     std::shared_ptr<curl::easy> easy_;
     Client& client_;
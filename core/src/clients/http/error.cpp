@@ -61,6 +61,9 @@ std::exception_ptr PrepareRateLimitException(std::error_code ec, std::string_vie
 TimeoutException::TimeoutException(std::string_view message, const LocalStats& stats)
     : BaseException(std::string(message), stats, ErrorKind::kTimeout) {}
 
+CircuitBreakerOpenException::CircuitBreakerOpenException(std::string_view url, const LocalStats& stats)
+    : BaseException(fmt::format("Circuit breaker is open, url: {}", url), stats, ErrorKind::kNetwork) {}
+
 BaseCodeException::BaseCodeException(
     std::error_code ec,
     std::string_view message,
@@ -0,0 +1,119 @@
+#include <userver/clients/http/hedged_request.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <optional>
+
+#include <clients/http/statistics.hpp>
+#include <userver/clients/http/error.hpp>
+#include <userver/clients/http/response_future.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/hedged_request.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+// What the failed attempts left, to report if no attempt succeeds
+struct FailedAttempts final {
+    std::shared_ptr<Response> last_response;
+    std::exception_ptr last_exception;
+};
+
+class HttpRequestStrategy final {
+public:
+    using RequestType = ResponseFuture;
+    using ReplyType = std::shared_ptr<Response>;
+
+    HttpRequestStrategy(
+        Request&& first_request,
+        const std::function<Request()>& make_request,
+        Statistics* stats,
+        std::shared_ptr<FailedAttempts> failed
+    )
+        : first_request_(std::move(first_request)),
+          make_request_(make_request),
+          stats_(stats),
+          failed_(std::move(failed)) {}
+
+    std::optional<RequestType> Create(std::size_t attempt) {
+        if (attempt == 0) {
+            UASSERT(first_request_);
+            auto request = std::move(*first_request_);
+            first_request_.reset();
+            return request.async_perform();
+        }
+
+        if (stats_) {
+            if (!stats_->GetRetryBudget().CanRetry()) return std::nullopt;
+            stats_->AccountHedge();
+        }
+        return make_request_().async_perform();
+    }
+
+    std::optional<std::chrono::milliseconds> ProcessReply(RequestType&& future) {
+        try {
+            auto response = future.Get();
+            if (response->status_code() >= 500) {
+                failed_->last_response = std::move(response);
+                failed_->last_exception = nullptr;
+                return std::chrono::milliseconds{0};
+            }
+            reply_ = std::move(response);
+            return std::nullopt;
+        } catch (const CancelException&) {
+            throw;
+        } catch (const BaseException&) {
+            failed_->last_response.reset();
+            failed_->last_exception = std::current_exception();
+            return std::chrono::milliseconds{0};
+        }
+    }
+
+    std::optional<ReplyType> ExtractReply() { return std::move(reply_); }
+
+    void Finish(RequestType&& future) { future.Cancel(); }
+
+private:
+    std::optional<Request> first_request_;
+    const std::function<Request()>& make_request_;
+    Statistics* stats_;
+    std::shared_ptr<FailedAttempts> failed_;
+    std::optional<ReplyType> reply_;
+};
+
+std::chrono::milliseconds GetHedgingDelay(Statistics* stats, const AdaptiveHedgingSettings& settings) {
+    if (!stats) return settings.max_delay;
+    const auto percentile = stats->GetRecentTimingsPercentile(settings.delay_percentile);
+    if (!percentile) return settings.max_delay;
+    return std::clamp(*percentile, settings.min_delay, settings.max_delay);
+}
+
+}  // namespace
+
+std::shared_ptr<Response>
+PerformHedgedRequest(const std::function<Request()>& make_request, const AdaptiveHedgingSettings& settings) {
+    auto first_request = make_request();
+    auto* stats = first_request.GetDestinationStatistics();
+
+    const utils::hedging::HedgingSettings hedging_settings{
+        settings.max_attempts,
+        GetHedgingDelay(stats, settings),
+        settings.timeout_all,
+    };
+    auto failed = std::make_shared<FailedAttempts>();
+    auto reply = utils::hedging::HedgeRequest(
+        HttpRequestStrategy{std::move(first_request), make_request, stats, failed}, hedging_settings
+    );
+
+    if (reply) return std::move(*reply);
+    if (failed->last_response) return std::move(failed->last_response);
+    if (failed->last_exception) std::rethrow_exception(failed->last_exception);
+    throw TimeoutException("Hedged request timed out", LocalStats{});
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
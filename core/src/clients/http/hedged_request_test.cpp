@@ -0,0 +1,116 @@
+#include <userver/clients/http/hedged_request.hpp>
+
+#include <atomic>
+
+#include <fmt/format.h>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/http_client.hpp>
+#include <userver/utest/simple_server.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using HttpResponse = utest::SimpleServer::Response;
+using HttpRequest = utest::SimpleServer::Request;
+
+constexpr std::chrono::milliseconds kHedgingDelay{10};
+
+HttpResponse MakeResponse(std::string_view status, std::string_view body) {
+    return {
+        fmt::format("HTTP/1.1 {}\r\nContent-Length: {}\r\n\r\n{}", status, body.size(), body),
+        HttpResponse::kWriteAndContinue};
+}
+
+// Only the first request is slow
+struct SlowFirstCallback {
+    std::shared_ptr<std::atomic<std::size_t>> requests = std::make_shared<std::atomic<std::size_t>>(0);
+
+    HttpResponse operator()(const HttpRequest&) const {
+        if (requests->fetch_add(1) == 0) {
+            engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+            return MakeResponse("200 OK", "slow");
+        }
+        return MakeResponse("200 OK", "fast");
+    }
+};
+
+// Only the first request fails
+struct FailFirstCallback {
+    std::shared_ptr<std::atomic<std::size_t>> requests = std::make_shared<std::atomic<std::size_t>>(0);
+
+    HttpResponse operator()(const HttpRequest&) const {
+        if (requests->fetch_add(1) == 0) {
+            return MakeResponse("500 Internal Server Error", "failed");
+        }
+        return MakeResponse("200 OK", "ok");
+    }
+};
+
+clients::http::AdaptiveHedgingSettings MakeSettings() {
+    clients::http::AdaptiveHedgingSettings settings;
+    settings.max_attempts = 2;
+    settings.min_delay = kHedgingDelay;
+    settings.max_delay = kHedgingDelay;
+    settings.timeout_all = utest::kMaxTestWaitTime;
+    return settings;
+}
+
+}  // namespace
+
+UTEST(HttpClientHedging, SlowFirstAttempt) {
+    const SlowFirstCallback callback;
+    const utest::SimpleServer http_server{callback};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    const auto response = clients::http::PerformHedgedRequest(
+        [&] {
+            return http_client_ptr->CreateRequest().get(http_server.GetBaseUrl()).retry(1).timeout(
+                utest::kMaxTestWaitTime
+            );
+        },
+        MakeSettings()
+    );
+
+    EXPECT_EQ(response->status_code(), 200);
+    EXPECT_EQ(response->body_view(), "fast");
+    EXPECT_EQ(*callback.requests, 2);
+}
+
+UTEST(HttpClientHedging, FailedFirstAttempt) {
+    const FailFirstCallback callback;
+    const utest::SimpleServer http_server{callback};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    auto settings = MakeSettings();
+    // The failed attempt is retried without waiting for the hedging delay
+    settings.min_delay = settings.max_delay = utest::kMaxTestWaitTime;
+
+    const auto response = clients::http::PerformHedgedRequest(
+        [&] { return http_client_ptr->CreateRequest().get(http_server.GetBaseUrl()).retry(1).timeout(1000); },
+        settings
+    );
+
+    EXPECT_EQ(response->status_code(), 200);
+    EXPECT_EQ(response->body_view(), "ok");
+    EXPECT_EQ(*callback.requests, 2);
+}
+
+UTEST(HttpClientHedging, AllAttemptsFailed) {
+    const utest::SimpleServer http_server{[](const HttpRequest&) {
+        return MakeResponse("503 Service Unavailable", "unavailable");
+    }};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    const auto response = clients::http::PerformHedgedRequest(
+        [&] { return http_client_ptr->CreateRequest().get(http_server.GetBaseUrl()).retry(1).timeout(1000); },
+        MakeSettings()
+    );
+
+    EXPECT_EQ(response->status_code(), 503);
+}
+
+USERVER_NAMESPACE_END
@@ -14,6 +14,7 @@
 #include <userver/clients/http/streamed_response.hpp>
 #include <userver/concurrent/queue.hpp>
 #include <userver/engine/future.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/http/url.hpp>
 #include <userver/tracing/span.hpp>
@@ -343,6 +344,28 @@ Request& Request::data(std::string data) & {
 }
 Request Request::data(std::string data) && { return std::move(this->data(std::move(data))); }
 
+Request& Request::upload_body(BodySource body_source, std::optional<std::size_t> content_length) & {
+    pimpl_->easy().add_header(kHeaderExpect, "", curl::easy::EmptyHeaderAction::kDoNotSend);
+    pimpl_->easy().set_body_source(
+        std::move(body_source), content_length ? static_cast<curl::native::curl_off_t>(*content_length) : -1
+    );
+    return *this;
+}
+Request Request::upload_body(BodySource body_source, std::optional<std::size_t> content_length) && {
+    return std::move(this->upload_body(std::move(body_source), content_length));
+}
+
+Request& Request::upload_file(fs::blocking::FileDescriptor&& file) & {
+    const auto file_size = file.GetSize();
+    auto shared_file = std::make_shared<fs::blocking::FileDescriptor>(std::move(file));
+    return upload_body(
+        [file = std::move(shared_file)](char* buffer, std::size_t size) { return file->Read(buffer, size); }, file_size
+    );
+}
+Request Request::upload_file(fs::blocking::FileDescriptor&& file) && {
+    return std::move(this->upload_file(std::move(file)));
+}
+
 Request& Request::form(Form&& form) & {
     pimpl_->easy().set_http_post(std::move(form).GetNative());
     pimpl_->easy().add_header(kHeaderExpect, "", curl::easy::EmptyHeaderAction::kDoNotSend);
@@ -421,6 +444,7 @@ Request Request::cookies(const std::unordered_map<std::string, std::string>& coo
 }
 
 Request& Request::method(HttpMethod method) & {
+    pimpl_->SetNoResponseBody(method == HttpMethod::kHead);
     switch (method) {
         case HttpMethod::kDelete:
         case HttpMethod::kOptions:
@@ -537,6 +561,8 @@ void Request::SetDeadlinePropagationConfig(const DeadlinePropagationConfig& dead
     pimpl_->SetDeadlinePropagationConfig(deadline_propagation_config);
 }
 
+Statistics* Request::GetDestinationStatistics() { return pimpl_->GetDestinationStatistics(); }
+
 Request& Request::DisableReplyDecoding() & {
     pimpl_->DisableReplyDecoding();
     return *this;
@@ -1,6 +1,7 @@
 #include <clients/http/request_state.hpp>
 
 #include <algorithm>
+#include <charconv>
 #include <chrono>
 #include <map>
 #include <string_view>
@@ -52,6 +53,14 @@ constexpr Status kLeastHttpCodeForDeadlineExpired{400};
 
 constexpr Status kFakeHttpErrorCode{599};
 
+/// Stream API: max count of the consumed chunk buffers kept for reuse
+constexpr std::size_t kMaxRecycledStreamBuffers = 16;
+
+/// Response body memory is reserved by Content-Length up to this size, larger
+/// bodies grow as they arrive. A small limit, as the Content-Length is not
+/// trusted.
+constexpr std::size_t kMaxBodyReserve = 64 * 1024;
+
 const std::string kTracingClientName = "external";
 
 const std::map<std::string, std::error_code> kTestsuiteActions = {
@@ -89,6 +98,11 @@ bool IsSetCookie(std::string_view key) {
     return equal(key, USERVER_NAMESPACE::http::headers::kSetCookie);
 }
 
+bool IsContentLength(std::string_view key) {
+    const utils::StrIcaseEqual equal;
+    return equal(key, USERVER_NAMESPACE::http::headers::kContentLength);
+}
+
 // Not a strict check, but OK for non-header line check
 bool IsHttpStatusLineStart(const char* ptr, size_t size) { return (size > 5 && memcmp(ptr, "HTTP/", 5) == 0); }
 
@@ -385,6 +399,8 @@ void RequestState::SetAllowedUrlsExtra(const std::vector<std::string>& urls) { a
 
 void RequestState::DisableReplyDecoding() { easy().set_accept_encoding(nullptr); }
 
+void RequestState::SetNoResponseBody(bool no_body) { no_response_body_ = no_body; }
+
 void RequestState::SetCancellationPolicy(CancellationPolicy cp) { cancellation_policy_ = cp; }
 
 CancellationPolicy RequestState::GetCancellationPolicy() const { return cancellation_policy_; }
@@ -457,7 +473,14 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
 
     holder->AccountResponse(err);
     const auto sockets = easy.get_num_connects();
-    holder->WithRequestStats([sockets](RequestStats& stats) { stats.AccountOpenSockets(sockets); });
+    // Failed attempts may report no new connections without connecting at all
+    const bool connection_reused = !err && sockets == 0 && status_code != 0;
+    // A handshake time is only reported if this attempt has performed the TLS handshake
+    const bool tls_handshake = sockets > 0 && easy.get_appconnect_time_usec() > 0;
+    holder->WithRequestStats([sockets, connection_reused, tls_handshake](RequestStats& stats) {
+        stats.AccountOpenSockets(sockets);
+        stats.AccountConnections(connection_reused, tls_handshake);
+    });
 
     span.AddTag(tracing::kAttempts, holder->retry_.current);
     if (holder->deadline_propagation_config_.update_header) {
@@ -530,9 +553,11 @@ void RequestState::on_retry(std::shared_ptr<RequestState> holder, std::error_cod
     // - if we used all attempts
     // - if failed to reach server, and we should not retry on fails
     // - if this request was cancelled
+    // - if the retry budget of the destination is exhausted
     const bool not_need_retry = (!err && !holder->ShouldRetryResponse()) ||
                                 (holder->retry_.current >= holder->retry_.retries) ||
-                                (err && !holder->retry_.on_fails) || holder->is_cancelled_.load();
+                                (err && !holder->retry_.on_fails) || holder->is_cancelled_.load() ||
+                                !holder->IsRetryAllowedByBudget();
 
     if (not_need_retry) {
         // finish if no need to retry
@@ -623,6 +648,9 @@ void RequestState::parse_header(char* ptr, size_t size) try {
     }
 
     std::string value(col_pos, end - col_pos);
+    if (IsContentLength(key) && std::holds_alternative<FullBufferedData>(data_)) {
+        ReserveBody(value);
+    }
     response_->headers().emplace(std::move(key), std::move(value));
 } catch (const std::exception& e) {
     LOG_ERROR() << "Failed to parse header: " << e.what();
@@ -641,6 +669,20 @@ std::string_view RequestState::GetLoggedEffectiveUrl() noexcept {
     return log_url_ ? *log_url_ : easy().get_effective_url();
 }
 
+void RequestState::ReserveBody(std::string_view content_length) {
+    if (no_response_body_) return;
+    // Informational, 204 and 304 responses have no body, the body of a redirect is dropped
+    const auto status_code = static_cast<int>(easy().get_response_code());
+    if (status_code < 200 || status_code == 204 || (status_code >= 300 && status_code < 400)) return;
+
+    std::size_t size = 0;
+    const auto [ptr, ec] = std::from_chars(content_length.data(), content_length.data() + content_length.size(), size);
+    if (ec != std::errc{} || ptr != content_length.data() + content_length.size()) return;
+
+    // Saves reallocations of the bodies
+    response_->sink_string().reserve(std::min(size, kMaxBodyReserve));
+}
+
 engine::Future<std::shared_ptr<Response>> RequestState::async_perform(utils::impl::SourceLocation location) {
     data_.emplace<FullBufferedData>();
 
@@ -652,10 +694,12 @@ engine::Future<std::shared_ptr<Response>> RequestState::async_perform(utils::imp
 
     // set place for response body
     easy().set_sink(&response_->sink_string());
+    // A streamed request body can not be read twice
+    if (easy().has_body_source()) retry_.retries = 1;
 
     auto future = std::get_if<FullBufferedData>(&data_)->promise_.get_future();
 
-    if (UpdateTimeoutFromDeadlineAndCheck()) {
+    if (UpdateTimeoutFromDeadlineAndCheck() && AcquireCircuitBreakerAndCheck()) {
         perform_request([holder = shared_from_this()](std::error_code err) mutable {
             RequestState::on_retry(std::move(holder), err);
         });
@@ -666,7 +710,7 @@ engine::Future<std::shared_ptr<Response>> RequestState::async_perform(utils::imp
 
 engine::Future<void>
 RequestState::async_perform_stream(const std::shared_ptr<Queue>& queue, utils::impl::SourceLocation location) {
-    data_.emplace<StreamData>(queue->GetProducer());
+    data_.emplace<StreamData>(queue->GetProducer(), RecycledBuffers::Create(kMaxRecycledStreamBuffers));
 
     StartNewSpan(location);
     ResetDataForNewRequest();
@@ -681,7 +725,7 @@ RequestState::async_perform_stream(const std::shared_ptr<Queue>& queue, utils::i
 
     auto future = std::get_if<StreamData>(&data_)->headers_promise.get_future();
 
-    if (UpdateTimeoutFromDeadlineAndCheck()) {
+    if (UpdateTimeoutFromDeadlineAndCheck() && AcquireCircuitBreakerAndCheck()) {
         perform_request([holder = shared_from_this()](std::error_code err) mutable {
             RequestState::on_completed(std::move(holder), err);
         });
@@ -701,6 +745,15 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
 
     plugin_pipeline_.HookPerformRequest(*this);
 
+    if (retry_.current == 1 && easy_.IsDestinationAffinityEnabled()) {
+        // Retries are started from the IO thread, so only the first attempt
+        // may change it
+        const MaybeOwnedUrl target{proxy_url_, easy()};
+        if (auto* multi_stats = easy_.BindToDestination(target.Get())) {
+            stats_.Rebind(*multi_stats);
+        }
+    }
+
     if (resolver_ && retry_.current == 1) {
         engine::AsyncNoSpan([this, holder = shared_from_this(), handler = std::move(handler)]() mutable {
             try {
@@ -782,8 +835,24 @@ void RequestState::HandleDeadlineAlreadyPassed() {
 
     WithRequestStats([](RequestStats& stats) { stats.AccountCancelledByDeadline(); });
 
-    auto exc = PrepareDeadlinePassedException(GetLoggedOriginalUrl(), easy().get_local_stats());
+    FailBeforePerform(PrepareDeadlinePassedException(GetLoggedOriginalUrl(), easy().get_local_stats()));
+}
+
+bool RequestState::AcquireCircuitBreakerAndCheck() {
+    if (!dest_req_stats_ || dest_req_stats_->GetStatistics().GetCircuitBreaker().TryAcquire()) return true;
+
+    auto& span = span_storage_->Get();
+    span.AddTag(tracing::kAttempts, 0);
+    span.AddTag(tracing::kErrorFlag, true);
+    span.AddTag("circuit_breaker_open", 1);
+
+    FailBeforePerform(
+        std::make_exception_ptr(CircuitBreakerOpenException(GetLoggedOriginalUrl(), easy().get_local_stats()))
+    );
+    return false;
+}
 
+void RequestState::FailBeforePerform(std::exception_ptr exc) {
     const utils::Overloaded visitor{
         [&exc](FullBufferedData& buffered_data) {
             auto promise = std::move(buffered_data.promise_);
@@ -849,6 +918,10 @@ bool RequestState::ShouldRetryResponse() {
     return status_code >= kLeastBadHttpCodeForEB;
 }
 
+bool RequestState::IsRetryAllowedByBudget() const {
+    return !dest_req_stats_ || dest_req_stats_->GetStatistics().GetRetryBudget().CanRetry();
+}
+
 void RequestState::AccountResponse(std::error_code err) {
     const auto attempts = retry_.current;
 
@@ -914,7 +987,6 @@ size_t RequestState::StreamWriteFunction(char* ptr, size_t size, size_t nmemb, v
     LOG_DEBUG() << fmt::format("Got bytes in stream API chunk, chunk of ({} bytes)", actual_size)
                 << tracing::impl::LogSpanAsLastNoCurrent{rs.span_storage_->Get()};
 
-    std::string buffer(ptr, actual_size);
     auto& queue_producer = stream_data->queue_producer;
 
     if (!stream_data->headers_promise_set.exchange(true)) {
@@ -922,6 +994,24 @@ size_t RequestState::StreamWriteFunction(char* ptr, size_t size, size_t nmemb, v
         LOG_DEBUG() << "Stream API, status code is set (with body)";
     }
 
+    const auto max_size = queue_producer.Queue()->GetSoftMaxSize();
+    if (actual_size > max_size) {
+        LOG_ERROR() << fmt::format(
+                           "Stream API, chunk of {} bytes does not fit into queue of {} bytes", actual_size, max_size
+                       )
+                    << tracing::impl::LogSpanAsLastNoCurrent{rs.span_storage_->Get()};
+        // Fails the request with a write error
+        return 0;
+    }
+
+    // Reuse the buffers of the consumed chunks
+    std::string buffer = std::move(stream_data->spare_buffer);
+    if (buffer.capacity() < actual_size) {
+        [[maybe_unused]] const bool recycled = stream_data->recycled_buffers_consumer.PopNoblock(buffer);
+    }
+    buffer.assign(ptr, actual_size);
+
+    // PushNoblock() leaves the buffer intact on failure
     if (queue_producer.PushNoblock(std::move(buffer))) {
         return actual_size;
     }
@@ -931,13 +1021,42 @@ size_t RequestState::StreamWriteFunction(char* ptr, size_t size, size_t nmemb, v
         return actual_size;
     }
 
-    LOG_DEBUG() << "There are some alive consumers";
+    LOG_DEBUG() << "There are some alive consumers, pausing";
 
-    UINVARIANT(false, "not implemented CURL_WRITEFUNC_PAUSE TAXICOMMON-5611");
+    stream_data->paused = true;
+    // The consumer might have freed the queue before seeing the flag
+    if (queue_producer.PushNoblock(std::move(buffer))) {
+        stream_data->paused = false;
+        return actual_size;
+    }
 
+    // cURL delivers the same data again after the transfer is resumed
+    stream_data->spare_buffer = std::move(buffer);
     return CURL_WRITEFUNC_PAUSE;
 }
 
+void RequestState::RecycleStreamBuffer(std::string&& buffer) {
+    auto* stream_data = std::get_if<StreamData>(&data_);
+    if (!stream_data || buffer.capacity() == 0) return;
+
+    buffer.clear();
+    [[maybe_unused]] const bool recycled = stream_data->recycled_buffers_producer.PushNoblock(std::move(buffer));
+}
+
+void RequestState::ResumeStreamIfPaused() {
+    auto* stream_data = std::get_if<StreamData>(&data_);
+    if (!stream_data) return;
+
+    // Waiting for the queue to get half empty saves pausing on every chunk
+    const auto& queue = stream_data->queue_producer.Queue();
+    if (queue->GetSizeApproximate() * 2 > queue->GetSoftMaxSize()) return;
+
+    if (stream_data->paused.exchange(false)) {
+        LOG_DEBUG() << "Stream API, resuming the transfer";
+        easy().unpause();
+    }
+}
+
 void RequestState::ApplyTestsuiteConfig() {
     if (!testsuite_config_) {
         return;
@@ -983,11 +1102,15 @@ void RequestState::StartNewSpan(utils::impl::SourceLocation location) {
 }
 
 void RequestState::StartStats() {
+    GetDestinationStatistics();
+    WithRequestStats([](RequestStats& stats) { stats.Start(); });
+}
+
+Statistics* RequestState::GetDestinationStatistics() {
     if (!dest_req_stats_) {
         dest_req_stats_ = dest_stats_->GetStatisticsForDestinationAuto(destination_metric_name_);
     }
-
-    WithRequestStats([](RequestStats& stats) { stats.Start(); });
+    return dest_req_stats_ ? &dest_req_stats_->GetStatistics() : nullptr;
 }
 
 template <typename Func>
@@ -2,6 +2,7 @@
 
 #include <array>
 #include <cstdlib>
+#include <exception>
 #include <memory>
 #include <optional>
 #include <string>
@@ -117,6 +118,9 @@ public:
 
     void DisableReplyDecoding();
 
+    /// HEAD responses have a Content-Length, but no body
+    void SetNoResponseBody(bool no_body);
+
     void SetCancellationPolicy(CancellationPolicy cp);
 
     CancellationPolicy GetCancellationPolicy() const;
@@ -135,6 +139,16 @@ public:
 
     PluginRequest GetEditableRequestInstance();
 
+    /// statistics of the destination, nullptr if the destination has none
+    Statistics* GetDestinationStatistics();
+
+    /// Stream API: gives the buffer of a consumed chunk back for the next
+    /// chunks, so that the buffers are allocated only once per stream
+    void RecycleStreamBuffer(std::string&& buffer);
+    /// Stream API: resumes the transfer paused on a full queue, once the
+    /// consumer has read enough
+    void ResumeStreamIfPaused();
+
 private:
     /// final callback that calls user callback and set value in promise
     static void on_completed(std::shared_ptr<RequestState>, std::error_code err);
@@ -148,6 +162,7 @@ private:
 
     /// parse one header
     void parse_header(char* ptr, size_t size);
+    void ReserveBody(std::string_view content_length);
     void ParseSingleCookie(const char* ptr, size_t size);
     /// simply run perform_request if there is now errors from timer
     void on_retry_timer(std::error_code err);
@@ -158,9 +173,14 @@ private:
     [[nodiscard]] bool UpdateTimeoutFromDeadlineAndCheck(std::chrono::milliseconds backoff = {});
     void UpdateTimeoutHeader();
     void HandleDeadlineAlreadyPassed();
+    // Returns false and fails the request if the circuit breaker of the
+    // destination is open
+    bool AcquireCircuitBreakerAndCheck();
+    void FailBeforePerform(std::exception_ptr exc);
     void CheckResponseDeadline(std::error_code& err, Status status_code);
     bool IsDeadlineExpiredResponse(Status status_code);
     bool ShouldRetryResponse();
+    bool IsRetryAllowedByBudget() const;
 
     const std::string& GetLoggedOriginalUrl() const noexcept;
     std::string_view GetLoggedEffectiveUrl() noexcept;
@@ -227,18 +247,35 @@ private:
     std::optional<std::string> log_url_;
 
     std::atomic<bool> is_cancelled_{false};
+    bool no_response_body_{false};
     std::array<char, CURL_ERROR_SIZE> errorbuffer_{};
 
     clients::dns::Resolver* resolver_{nullptr};
     std::string proxy_url_;
     impl::PluginPipeline& plugin_pipeline_;
 
+    using RecycledBuffers = concurrent::SpscQueue<std::string>;
+
     struct StreamData {
-        StreamData(Queue::Producer&& queue_producer) : queue_producer(std::move(queue_producer)) {}
+        StreamData(Queue::Producer&& queue_producer, const std::shared_ptr<RecycledBuffers>& recycled_buffers)
+            : queue_producer(std::move(queue_producer)),
+              recycled_buffers_producer(recycled_buffers->GetProducer()),
+              recycled_buffers_consumer(recycled_buffers->GetConsumer()) {}
 
         Queue::Producer queue_producer;
         std::atomic<bool> headers_promise_set{false};
         engine::Promise<void> headers_promise;
+
+        // Set by the write function when the queue is full and the transfer
+        // is paused until the consumer catches up
+        std::atomic<bool> paused{false};
+        // The buffer of the chunk that did not fit into the queue, only
+        // accessed by the write function
+        std::string spare_buffer;
+
+        // Buffers of the consumed chunks go back to the write function
+        RecycledBuffers::Producer recycled_buffers_producer;
+        RecycledBuffers::Consumer recycled_buffers_consumer;
     };
 
     struct FullBufferedData {
@@ -22,6 +22,13 @@ T SumToMean(T sum, U count) {
     return sum / static_cast<T>(count);
 }
 
+constexpr std::chrono::seconds kRecentTimingsUpdatePeriod{1};
+
+// Percentiles of fewer timings are too noisy to derive delays from
+constexpr std::uint32_t kRecentTimingsMinCount = 100;
+
+bool IsFailedStatus(int code) { return code >= 500; }
+
 }  // namespace
 
 RequestStats::RequestStats(Statistics& stats) : stats_(&stats) { stats_->easy_handles_++; }
@@ -34,6 +41,13 @@ RequestStats::~RequestStats() {
 
 RequestStats::RequestStats(RequestStats&& other) noexcept : stats_{std::exchange(other.stats_, nullptr)} {}
 
+void RequestStats::Rebind(Statistics& stats) noexcept {
+    UASSERT(stats_);
+    stats_->easy_handles_--;
+    stats_ = &stats;
+    stats_->easy_handles_++;
+}
+
 void RequestStats::Start() { start_time_ = std::chrono::steady_clock::now(); }
 
 void RequestStats::FinishOk(int code, unsigned int attempts) noexcept {
@@ -41,13 +55,26 @@ void RequestStats::FinishOk(int code, unsigned int attempts) noexcept {
     stats_->AccountError(Statistics::ErrorGroup::kOk);
     stats_->AccountStatus(code);
     if (attempts > 1) stats_->retries_ += utils::statistics::Rate{attempts - 1};
+    if (IsFailedStatus(code)) {
+        stats_->retry_budget_.AccountFail();
+        stats_->circuit_breaker_.AccountFail();
+    } else {
+        stats_->retry_budget_.AccountOk();
+        stats_->circuit_breaker_.AccountOk();
+    }
     StoreTiming();
 }
 
 void RequestStats::FinishEc(std::error_code ec, unsigned int attempts) noexcept {
     UASSERT(stats_);
-    stats_->AccountError(Statistics::ErrorCodeToGroup(ec));
+    const auto error_group = Statistics::ErrorCodeToGroup(ec);
+    stats_->AccountError(error_group);
     if (attempts > 1) stats_->retries_ += utils::statistics::Rate{attempts - 1};
+    // Cancelled requests (e.g. losing hedges) tell nothing about the destination
+    if (error_group != Statistics::ErrorGroup::kCancelled) {
+        stats_->retry_budget_.AccountFail();
+        stats_->circuit_breaker_.AccountFail();
+    }
     StoreTiming();
 }
 
@@ -72,6 +99,12 @@ void RequestStats::AccountOpenSockets(size_t sockets) noexcept {
     stats_->socket_open_ += utils::statistics::Rate{sockets};
 }
 
+void RequestStats::AccountConnections(bool connection_reused, bool tls_handshake) noexcept {
+    UASSERT(stats_);
+    if (connection_reused) ++stats_->connections_reused_;
+    if (tls_handshake) ++stats_->tls_handshakes_;
+}
+
 void RequestStats::AccountTimeoutUpdatedByDeadline() noexcept {
     UASSERT(stats_);
     ++stats_->timeout_updated_by_deadline_;
@@ -82,6 +115,14 @@ void RequestStats::AccountCancelledByDeadline() noexcept {
     ++stats_->cancelled_by_deadline_;
 }
 
+Statistics& RequestStats::GetStatistics() const noexcept {
+    UASSERT(stats_);
+    return *stats_;
+}
+
+Statistics::Statistics(const utils::RetryBudgetSettings& retry_budget_settings)
+    : retry_budget_(retry_budget_settings) {}
+
 Statistics::ErrorGroup Statistics::ErrorCodeToGroup(std::error_code ec) {
     using ErrorCode = curl::errc::EasyErrorCode;
 
@@ -149,6 +190,21 @@ void Statistics::AccountError(ErrorGroup error) { ++error_count_[static_cast<int
 
 void Statistics::AccountStatus(int code) { reply_status_.Account(code); }
 
+void Statistics::AccountHedge() noexcept { ++hedges_; }
+
+std::optional<std::chrono::milliseconds> Statistics::GetRecentTimingsPercentile(double percent) {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    auto update_time = recent_timings_update_time_.load(std::memory_order_relaxed);
+    if (now - std::chrono::steady_clock::duration{update_time} >= kRecentTimingsUpdatePeriod &&
+        recent_timings_update_time_.compare_exchange_strong(update_time, now.count(), std::memory_order_relaxed)) {
+        recent_timings_.Assign(timings_percentile_.GetStatsForPeriod(utils::statistics::kDefaultMaxPeriod, true));
+    }
+
+    const auto timings = recent_timings_.Read();
+    if (timings->Count() < kRecentTimingsMinCount) return std::nullopt;
+    return std::chrono::milliseconds{timings->GetPercentile(percent)};
+}
+
 void DumpMetric(utils::statistics::Writer& writer, const DestinationStatisticsView& view) {
     const auto& stats = view.stats;
 
@@ -166,8 +222,13 @@ void DumpMetric(utils::statistics::Writer& writer, const DestinationStatisticsVi
 
     writer["timeout-updated-by-deadline"] = stats.timeout_updated_by_deadline;
     writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
+    writer["hedges"] = stats.hedges;
+    writer["circuit-breaker"] = stats.circuit_breaker;
 
     writer["sockets"]["open"] = stats.multi.socket_open;
+
+    writer["connections"]["reused"] = stats.connections_reused;
+    writer["connections"]["tls-handshakes"] = stats.tls_handshakes;
 }
 
 void DumpMetric(utils::statistics::Writer& writer, const InstanceStatistics& stats) {
@@ -200,8 +261,12 @@ InstanceStatistics::InstanceStatistics(const Statistics& other)
       last_time_to_start_us(other.last_time_to_start_us_.load()),
       timings_percentile(other.timings_percentile_.GetStatsForPeriod()),
       retries(other.retries_.Load()),
+      connections_reused(other.connections_reused_.Load()),
+      tls_handshakes(other.tls_handshakes_.Load()),
       timeout_updated_by_deadline(other.timeout_updated_by_deadline_.Load()),
       cancelled_by_deadline(other.cancelled_by_deadline_.Load()),
+      hedges(other.hedges_.Load()),
+      circuit_breaker(other.circuit_breaker_.GetStatistics()),
       reply_status(other.reply_status_) {
     for (size_t i = 0; i < error_count.size(); i++) error_count[i] = other.error_count_[i].Load();
     multi.socket_open = other.socket_open_.Load();
@@ -231,9 +296,13 @@ InstanceStatistics& InstanceStatistics::operator+=(const InstanceStatistics& sta
         error_count[i] += stat.error_count[i];
     }
     retries += stat.retries;
+    connections_reused += stat.connections_reused;
+    tls_handshakes += stat.tls_handshakes;
 
     timeout_updated_by_deadline += stat.timeout_updated_by_deadline;
     cancelled_by_deadline += stat.cancelled_by_deadline;
+    hedges += stat.hedges;
+    circuit_breaker += stat.circuit_breaker;
     reply_status += stat.reply_status;
 
     multi += stat.multi;
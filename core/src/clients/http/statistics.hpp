@@ -1,11 +1,16 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
+#include <clients/http/circuit_breaker.hpp>
+#include <userver/rcu/rcu.hpp>
 #include <userver/utils/datetime.hpp>
+#include <userver/utils/retry_budget.hpp>
 #include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/rate.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
@@ -19,6 +24,9 @@ namespace clients::http {
 
 class Statistics;
 
+// Retry budgets of the destinations are disabled unless configured
+inline constexpr utils::RetryBudgetSettings kDisabledRetryBudget{100.0f, 0.1f, /*enabled=*/false};
+
 class RequestStats final {
 public:
     explicit RequestStats(Statistics& stats);
@@ -30,6 +38,9 @@ public:
     RequestStats(RequestStats&&) noexcept;
     RequestStats& operator=(RequestStats&&) = delete;
 
+    // Moves the request to the statistics of another IO thread
+    void Rebind(Statistics& stats) noexcept;
+
     void Start();
     void FinishOk(int code, unsigned int attempts) noexcept;
     void FinishEc(std::error_code ec, unsigned int attempts) noexcept;
@@ -37,10 +48,14 @@ public:
     void StoreTimeToStart(std::chrono::microseconds micro_seconds) noexcept;
 
     void AccountOpenSockets(size_t sockets) noexcept;
+    void AccountConnections(bool connection_reused, bool tls_handshake) noexcept;
 
     void AccountTimeoutUpdatedByDeadline() noexcept;
     void AccountCancelledByDeadline() noexcept;
 
+    // Returns the statistics the request is accounted in
+    Statistics& GetStatistics() const noexcept;
+
 private:
     void StoreTiming() noexcept;
 
@@ -73,6 +88,8 @@ class Statistics {
 public:
     Statistics() = default;
 
+    explicit Statistics(const utils::RetryBudgetSettings& retry_budget_settings);
+
     RequestStats CreateRequestStats() { return RequestStats{*this}; }
 
     enum class ErrorGroup {
@@ -96,6 +113,21 @@ public:
 
     void AccountStatus(int);
 
+    void AccountHedge() noexcept;
+
+    // Retries and hedges of the requests are allowed while the budget is not
+    // exhausted by failed attempts. Disabled by default.
+    utils::RetryBudget& GetRetryBudget() noexcept { return retry_budget_; }
+
+    // Fails the requests fast while the destination fails too many of them.
+    // Disabled unless configured via HTTP_CLIENT_CIRCUIT_BREAKER.
+    CircuitBreaker& GetCircuitBreaker() noexcept { return circuit_breaker_; }
+
+    // Returns the percentile of the timings for the last minute, nullopt if
+    // there are too few of them. The timings are aggregated at most once per
+    // second, so the call is cheap.
+    std::optional<std::chrono::milliseconds> GetRecentTimingsPercentile(double percent);
+
 private:
     std::atomic<uint64_t> easy_handles_{0};
     std::atomic<uint64_t> last_time_to_start_us_{0};
@@ -103,10 +135,18 @@ private:
     std::array<utils::statistics::RateCounter, kErrorGroupCount> error_count_;
     utils::statistics::RateCounter retries_;
     utils::statistics::RateCounter socket_open_{0};
+    utils::statistics::RateCounter connections_reused_;
+    utils::statistics::RateCounter tls_handshakes_;
     utils::statistics::RateCounter timeout_updated_by_deadline_;
     utils::statistics::RateCounter cancelled_by_deadline_;
+    utils::statistics::RateCounter hedges_;
     utils::statistics::HttpCodes reply_status_;
 
+    utils::RetryBudget retry_budget_{kDisabledRetryBudget};
+    CircuitBreaker circuit_breaker_;
+    rcu::Variable<Percentile> recent_timings_;
+    std::atomic<std::chrono::steady_clock::rep> recent_timings_update_time_{0};
+
     friend struct InstanceStatistics;
     friend class RequestStats;
 };
@@ -129,9 +169,13 @@ struct InstanceStatistics {
     Percentile timings_percentile;
     std::array<utils::statistics::Rate, Statistics::kErrorGroupCount> error_count;
     utils::statistics::Rate retries{0};
+    utils::statistics::Rate connections_reused;
+    utils::statistics::Rate tls_handshakes;
 
     utils::statistics::Rate timeout_updated_by_deadline;
     utils::statistics::Rate cancelled_by_deadline;
+    utils::statistics::Rate hedges;
+    CircuitBreakerStatistics circuit_breaker;
     utils::statistics::HttpCodes::Snapshot reply_status;
 
     MultiStats multi;
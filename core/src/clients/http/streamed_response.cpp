@@ -78,7 +78,10 @@ const Response::CookiesMap& StreamedResponse::GetCookies() {
 bool StreamedResponse::ReadChunk(std::string& output, engine::Deadline deadline) {
     WaitForHeadersOrThrow(deadline_);
 
-    return queue_consumer_.Pop(output, deadline);
+    request_state_->RecycleStreamBuffer(std::move(output));
+    const bool result = queue_consumer_.Pop(output, deadline);
+    request_state_->ResumeStreamIfPaused();
+    return result;
 }
 
 }  // namespace clients::http
@@ -6,6 +6,7 @@
 #include <userver/components/component.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/tracing/sampling_policy.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
@@ -29,6 +30,18 @@ const dynamic_config::Key<tracing::NoLogSpans> kNoLogSpans{
 )"}};
 /// [key]
 
+const dynamic_config::Key<tracing::SamplingPolicy> kTraceSampling{
+    "USERVER_TRACE_SAMPLING",
+    dynamic_config::DefaultAsJsonString{R"(
+  {
+    "head-probability": 1.0,
+    "use-inbound-decision": false,
+    "tail-sampling-enabled": false,
+    "tail-latency-threshold-ms": 1000,
+    "tail-max-spans": 1000
+  }
+)"}};
+
 const dynamic_config::Key<logging::DynamicDebugConfig> kDynamicDebugConfig{
     "USERVER_LOG_DYNAMIC_DEBUG",
     dynamic_config::DefaultAsJsonString{R"(
@@ -54,6 +67,7 @@ LoggingConfigurator::~LoggingConfigurator() { config_subscription_.Unsubscribe()
 void LoggingConfigurator::OnConfigUpdate(const dynamic_config::Snapshot& config) {
     (void)this;  // silence clang-tidy
     tracing::Tracer::SetNoLogSpans(tracing::NoLogSpans{config[kNoLogSpans]});
+    tracing::Tracer::SetSamplingPolicy(tracing::SamplingPolicy{config[kTraceSampling]});
 
     try {
         const auto& dd = config[kDynamicDebugConfig];
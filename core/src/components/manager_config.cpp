@@ -105,6 +105,31 @@ properties:
                     lead to inaccuracy in coro pool size estimation.
                     local_cache_size=0 disables local cache.
                 defaultDescription: 8
+            stack_reclaim_idle_threshold:
+                type: integer
+                description: |
+                    Release the unused stack pages of the idle coroutines
+                    beyond this many, so that RSS goes down after a load
+                    spike. Pages are released with madvise(2) below the stack
+                    pointer of the suspended coroutine, at most once a second
+                    for a batch of coroutines.
+                defaultDescription: stack pages are never released
+            stack_reclaim_lazy_free:
+                type: boolean
+                description: |
+                    Release the pages with MADV_FREE instead of MADV_DONTNEED:
+                    cheaper, but RSS goes down only under memory pressure
+                defaultDescription: false
+            hugepage_stacks:
+                type: boolean
+                description: |
+                    Allocate up to max_size stacks from a pre-reserved arena
+                    backed by transparent huge pages to reduce TLB misses.
+                    Stacks are grouped into 2MiB-aligned runs with a guard
+                    before each run and no guards between the stacks of a run,
+                    so an overflow may corrupt a neighbouring stack. stack_size
+                    should be a divisor or a multiple of 2MiB.
+                defaultDescription: false
     event_thread_pool:
         type: object
         description: event thread pool options
@@ -115,6 +140,18 @@ properties:
                 description: >
                     number of threads to process low level IO system calls
                     (number of ev loops to start in libev)
+            ev_backend:
+                type: string
+                description: |
+                    libev backend for the ev loops. `io_uring` is used by
+                    libev for readiness polling only, it requires Linux 5.1+
+                    and libev 4.31+. If it is not available or is forbidden
+                    by seccomp, the default backend is used.
+                defaultDescription: default
+                enum:
+                  - default
+                  - epoll
+                  - io_uring
     components:
         type: object
         description: 'dictionary of "component name": "options"'
@@ -150,6 +187,23 @@ properties:
                       - normal
                       - low-priority
                       - idle
+                cpu-affinity:
+                    type: array
+                    description: |
+                        list of CPUs to pin the task processor threads to,
+                        by default the threads are not pinned. The CPUs must
+                        be allowed for the process, e.g. by the cgroup cpuset
+                    items:
+                        type: integer
+                        description: CPU number
+                numa-node:
+                    type: integer
+                    description: |
+                        NUMA node to allocate the memory of the task
+                        processor threads from. If `cpu-affinity` is not set,
+                        the threads are pinned to the allowed CPUs of the node.
+                        Coroutine stacks come from the coro pool shared by all
+                        the task processors and are not node local.
                 spinning-iterations:
                     type: integer
                     description: |
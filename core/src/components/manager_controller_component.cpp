@@ -1,5 +1,7 @@
 #include <userver/components/manager_controller_component.hpp>
 
+#include <map>
+
 #include <components/manager_config.hpp>
 #include <components/manager_controller_component_config.hpp>
 #include <engine/task/task_processor.hpp>
@@ -8,6 +10,7 @@
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/logging/component.hpp>
+#include <userver/utils/statistics/rate.hpp>
 
 #include <components/manager.hpp>
 
@@ -54,6 +57,22 @@ void DumpMetric(utils::statistics::Writer& writer, const engine::TaskProcessor&
 
 namespace components {
 
+namespace {
+
+struct NumaNodeStats final {
+    std::size_t worker_threads{0};
+    std::size_t tasks_alive{0};
+    std::size_t tasks_queued{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const NumaNodeStats& stats) {
+    writer["worker-threads"] = stats.worker_threads;
+    writer["tasks"]["alive"] = stats.tasks_alive;
+    writer["tasks"]["queued"] = stats.tasks_queued;
+}
+
+}  // namespace
+
 ManagerControllerComponent::ManagerControllerComponent(
     const components::ComponentConfig&,
     const components::ComponentContext& context
@@ -89,6 +108,25 @@ void ManagerControllerComponent::WriteStatistics(utils::statistics::Writer& writ
         writer["task-processors"].ValueWithLabels(*task_processor, {{"task_processor", name}});
     }
 
+    // NUMA nodes of the bound task processors
+    std::map<std::size_t, NumaNodeStats> numa_nodes;
+    for (const auto& [name, task_processor] : components_manager_.GetTaskProcessorsMap()) {
+        const auto numa_node = task_processor->GetNumaNode();
+        if (!numa_node) continue;
+
+        const auto& counter = task_processor->GetTaskCounter();
+        const auto created = counter.GetCreatedTasks();
+        const auto destroyed = counter.GetDestroyedTasks();
+
+        auto& stats = numa_nodes[*numa_node];
+        stats.worker_threads += task_processor->GetWorkerCount();
+        stats.tasks_alive += created.value - std::min(destroyed, created).value;
+        stats.tasks_queued += task_processor->GetTaskQueueSize();
+    }
+    for (const auto& [numa_node, stats] : numa_nodes) {
+        writer["numa-nodes"].ValueWithLabels(stats, {{"numa_node", std::to_string(numa_node)}});
+    }
+
     // ev-threads
     const auto& pools_ptr = components_manager_.GetTaskProcessorPools();
     writer["ev-threads"]["cpu-load-percent"] = pools_ptr->EventThreadPool();
@@ -104,6 +142,11 @@ void ManagerControllerComponent::WriteStatistics(utils::statistics::Writer& writ
             stack_usage_stats["max-usage-percent"] = stats.max_stack_usage_pct;
             stack_usage_stats["is-monitor-active"] = stats.is_stack_usage_monitor_active;
         }
+        if (auto stack_reclaim_stats = coro_pool["stack-reclaim"]) {
+            stack_reclaim_stats["reclaimed-stacks"] = utils::statistics::Rate{stats.reclaimed_stacks};
+            stack_reclaim_stats["reclaimed-bytes"] = utils::statistics::Rate{stats.reclaimed_stack_bytes};
+        }
+        coro_pool["hugepage-arena"]["stacks"] = stats.arena_stacks;
     }
 
     // misc
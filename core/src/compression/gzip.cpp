@@ -1,5 +1,10 @@
 #include <compression/gzip.hpp>
 
+#include <algorithm>
+
+#include <fmt/format.h>
+#include <zlib.h>
+
 #include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
@@ -9,6 +14,93 @@ namespace compression::gzip {
 
 namespace {
 constexpr auto kDecompressBufferSize = 1024;
+
+// 15 is the max window size, +16 asks zlib for the gzip header and trailer
+constexpr int kGzipWindowBits = 15 + 16;
+constexpr int kMemLevel = 8;
+constexpr std::size_t kMinCompressBufferSize = 64;
+
+void CheckDeflateResult(int ret, const z_stream& stream) {
+    if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+        throw CompressionError(fmt::format("gzip compression failed: {}", stream.msg ? stream.msg : zError(ret)));
+    }
+}
+
+// Feeds `input` to the stream with the given flush mode, appends the output
+void DeflateTo(z_stream& stream, std::string_view input, int flush, std::string& output) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream.avail_in = input.size();
+
+    const std::size_t buffer_size = std::max<std::size_t>(deflateBound(&stream, input.size()), kMinCompressBufferSize);
+    do {
+        const auto old_size = output.size();
+        output.resize(old_size + buffer_size);
+        stream.next_out = reinterpret_cast<Bytef*>(output.data() + old_size);
+        stream.avail_out = buffer_size;
+
+        const int ret = deflate(&stream, flush);
+        CheckDeflateResult(ret, stream);
+        output.resize(output.size() - stream.avail_out);
+        if (ret == Z_STREAM_END) {
+            break;
+        }
+    } while (stream.avail_out == 0 || stream.avail_in != 0);
+}
+
+class DeflateStream final {
+public:
+    explicit DeflateStream(int level) {
+        const int ret = deflateInit2(&stream_, level, Z_DEFLATED, kGzipWindowBits, kMemLevel, Z_DEFAULT_STRATEGY);
+        if (ret != Z_OK) {
+            throw CompressionError(fmt::format("Couldn't create gzip compression stream: {}", zError(ret)));
+        }
+    }
+
+    ~DeflateStream() { deflateEnd(&stream_); }
+
+    DeflateStream(const DeflateStream&) = delete;
+    DeflateStream& operator=(const DeflateStream&) = delete;
+
+    z_stream& Get() noexcept { return stream_; }
+
+private:
+    z_stream stream_{};
+};
+
+}  // namespace
+
+struct StreamCompressor::Impl {
+    explicit Impl(int level) : stream(level) {}
+
+    DeflateStream stream;
+};
+
+StreamCompressor::StreamCompressor(int level) : impl_(std::make_unique<Impl>(level)) {}
+
+StreamCompressor::StreamCompressor(StreamCompressor&&) noexcept = default;
+
+StreamCompressor& StreamCompressor::operator=(StreamCompressor&&) noexcept = default;
+
+StreamCompressor::~StreamCompressor() = default;
+
+std::string StreamCompressor::Compress(std::string_view chunk) {
+    std::string output;
+    DeflateTo(impl_->stream.Get(), chunk, Z_SYNC_FLUSH, output);
+    return output;
+}
+
+std::string StreamCompressor::Finish() {
+    std::string output;
+    DeflateTo(impl_->stream.Get(), {}, Z_FINISH, output);
+    return output;
+}
+
+std::string Compress(std::string_view data, int level) {
+    DeflateStream stream{level};
+    std::string output;
+    DeflateTo(stream.Get(), data, Z_FINISH, output);
+    return output;
 }
 
 std::string Decompress(std::string_view compressed, size_t max_size) {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <userver/compression/error.hpp>
@@ -12,6 +14,36 @@ namespace compression::gzip {
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Default compression level of zlib
+inline constexpr int kDefaultCompressionLevel = 6;
+
+/// Compresses the string into a gzip member.
+/// @throws CompressionError
+std::string Compress(std::string_view data, int level = kDefaultCompressionLevel);
+
+/// @brief Compresses a stream of chunks into a single gzip member.
+///
+/// Output of each Compress() call is flushed with Z_SYNC_FLUSH, so that the
+/// peer is able to decompress the data received so far.
+class StreamCompressor final {
+public:
+    explicit StreamCompressor(int level = kDefaultCompressionLevel);
+    StreamCompressor(StreamCompressor&&) noexcept;
+    StreamCompressor& operator=(StreamCompressor&&) noexcept;
+    ~StreamCompressor();
+
+    /// @throws CompressionError
+    std::string Compress(std::string_view chunk);
+
+    /// Writes the gzip trailer, the compressor must not be used afterwards.
+    /// @throws CompressionError
+    std::string Finish();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
@@ -28,4 +28,27 @@ TEST(Gzip, TestOverflow) {
     EXPECT_THROW(compression::gzip::Decompress(compressed, big_msg.size() / 2), compression::TooBigError);
 }
 
+TEST(Gzip, CompressRoundTrip) {
+    const std::string str(16'000, 'a');
+
+    const auto compressed = compression::gzip::Compress(str);
+    EXPECT_LT(compressed.size(), str.size());
+    EXPECT_EQ(compression::gzip::Decompress(compressed, str.size()), str);
+}
+
+TEST(Gzip, StreamCompress) {
+    compression::gzip::StreamCompressor compressor;
+
+    std::string compressed;
+    std::string expected;
+    for (int i = 0; i < 10; ++i) {
+        const std::string chunk(1000, static_cast<char>('a' + i));
+        compressed += compressor.Compress(chunk);
+        expected += chunk;
+    }
+    compressed += compressor.Finish();
+
+    EXPECT_EQ(compression::gzip::Decompress(compressed, expected.size()), expected);
+}
+
 USERVER_NAMESPACE_END
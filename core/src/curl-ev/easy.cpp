@@ -136,6 +136,12 @@ std::shared_ptr<easy> easy::GetBoundBlocking(multi& multi_handle) const {
     return std::make_shared<easy>(cloned, &multi_handle);
 }
 
+void easy::Rebind(multi& multi_handle) {
+    UASSERT(multi_);
+    UASSERT(!multi_registered_);
+    multi_ = &multi_handle;
+}
+
 easy* easy::from_native(native::CURL* native_easy) {
     easy* easy_handle = nullptr;
     native::curl_easy_getinfo(native_easy, native::CURLINFO_PRIVATE, &easy_handle);
@@ -207,6 +213,20 @@ void easy::cancel(size_t request_num) {
     }
 }
 
+void easy::unpause() {
+    if (multi_) {
+        multi_->GetThreadControl().RunInEvLoopAsync([self = shared_from_this(), request_num = request_counter_] {
+            self->do_ev_unpause(request_num);
+        });
+    }
+}
+
+void easy::do_ev_unpause(size_t request_num) {
+    // The request might have been finished or cancelled in the meantime
+    if (request_num != request_counter_ || !multi_registered_) return;
+    native::curl_easy_pause(handle_, CURLPAUSE_CONT);
+}
+
 void easy::do_ev_cancel(size_t request_num) {
     // RunInEvLoopAsync(do_ev_async_perform) and RunInEvLoopSync(do_ev_cancel) are
     // not synchronized. So we need to count last cancelled request to prevent its
@@ -225,6 +245,7 @@ void easy::reset() {
 
     orig_url_str_.clear();
     std::string{}.swap(post_fields_);  // forced memory freeing
+    body_source_ = {};
     form_.reset();
     if (headers_) headers_->clear();
     if (proxy_headers_) proxy_headers_->clear();
@@ -276,6 +297,23 @@ void easy::set_source(std::shared_ptr<std::istream> source, std::error_code& ec)
     if (!ec) set_seek_data(this, ec);
 }
 
+void easy::set_body_source(body_source_t source, native::curl_off_t size) {
+    std::error_code ec;
+    set_body_source(std::move(source), size, ec);
+    throw_error(ec, "set_body_source");
+}
+
+void easy::set_body_source(body_source_t source, native::curl_off_t size, std::error_code& ec) {
+    std::string{}.swap(post_fields_);
+    body_source_ = std::move(source);
+    set_post(true, ec);
+    // POSTFIELDS take precedence over the read function
+    if (!ec) set_post_fields(static_cast<void*>(nullptr), ec);
+    if (!ec) set_post_field_size_large(size, ec);
+    if (!ec) set_read_function(&easy::body_source_function, ec);
+    if (!ec) set_read_data(this, ec);
+}
+
 void easy::set_sink(std::string* sink) {
     std::error_code ec;
     set_sink(sink, ec);
@@ -336,6 +374,7 @@ void easy::set_post_fields(std::string&& post_fields) {
 
 void easy::set_post_fields(std::string&& post_fields, std::error_code& ec) {
     post_fields_ = std::move(post_fields);
+    body_source_ = {};
     ec = std::error_code{static_cast<errc::EasyErrorCode>(
         native::curl_easy_setopt(handle_, native::CURLOPT_POSTFIELDS, post_fields_.c_str())
     )};
@@ -351,6 +390,7 @@ void easy::set_http_post(std::unique_ptr<form> form) {
 
 void easy::set_http_post(std::unique_ptr<form> form, std::error_code& ec) {
     form_ = std::move(form);
+    body_source_ = {};
 
     if (form_) {
         ec = std::error_code{static_cast<errc::EasyErrorCode>(
@@ -600,7 +640,9 @@ void easy::set_share(std::shared_ptr<share> share, std::error_code& ec) {
     }
 }
 
-bool easy::has_post_data() const { return !post_fields_.empty() || form_; }
+bool easy::has_post_data() const { return !post_fields_.empty() || form_ || body_source_; }
+
+bool easy::has_body_source() const { return static_cast<bool>(body_source_); }
 
 const std::string& easy::get_post_data() const { return post_fields_; }
 
@@ -701,6 +743,18 @@ size_t easy::read_function(void* ptr, size_t size, size_t nmemb, void* userdata)
     }
 }
 
+size_t easy::body_source_function(void* ptr, size_t size, size_t nmemb, void* userdata) noexcept {
+    easy* self = static_cast<easy*>(userdata);
+    if (!self->body_source_) return CURL_READFUNC_ABORT;
+
+    try {
+        return self->body_source_(static_cast<char*>(ptr), size * nmemb);
+    } catch (const std::exception& e) {
+        LOG_WARNING() << "Request body source failed: " << e;
+        return CURL_READFUNC_ABORT;
+    }
+}
+
 int easy::seek_function(void* instream, native::curl_off_t offset, int origin) noexcept {
     // TODO we could allow the user to define an offset which this library
     // should consider as position zero for uploading chunks of the file
@@ -216,6 +216,10 @@ public:
 
     const multi* GetMulti() const { return multi_; }
 
+    // Moves a bound easy to another multi (and its ev thread). Must only be
+    // called while the easy is not performing.
+    void Rebind(multi&);
+
     inline native::CURL* native_handle() { return handle_; }
     engine::ev::ThreadControl& GetThreadControl();
 
@@ -223,9 +227,20 @@ public:
     void perform(std::error_code& ec);
     void async_perform(handler_type handler);
     void cancel();
+    // Resumes the transfer paused by a callback. Thread-safe, the transfer is
+    // resumed asynchronously in the ev thread.
+    void unpause();
     void reset();
     void set_source(std::shared_ptr<std::istream> source);
     void set_source(std::shared_ptr<std::istream> source, std::error_code& ec);
+
+    // Fills the buffer with the next part of the request body, returns the
+    // count of written bytes or 0 at the end of the body. Called in ev thread.
+    using body_source_t = std::function<size_t(char* buffer, size_t size)>;
+    // Sends the body produced by `source` as POST data of `size` bytes, or
+    // with chunked encoding if `size` is -1.
+    void set_body_source(body_source_t source, native::curl_off_t size);
+    void set_body_source(body_source_t source, native::curl_off_t size, std::error_code& ec);
     void set_sink(std::string* sink);
     void set_sink(std::string* sink, std::error_code& ec);
 
@@ -665,6 +680,8 @@ public:
 
     bool has_post_data() const;
 
+    bool has_body_source() const;
+
     const std::string& get_post_data() const;
 
     std::string extract_post_data();
@@ -689,6 +706,7 @@ private:
 
     static size_t write_function(char* ptr, size_t size, size_t nmemb, void* userdata) noexcept;
     static size_t read_function(void* ptr, size_t size, size_t nmemb, void* userdata) noexcept;
+    static size_t body_source_function(void* ptr, size_t size, size_t nmemb, void* userdata) noexcept;
     static int seek_function(void* instream, native::curl_off_t offset, int origin) noexcept;
     static int xferinfo_function(
         void* clientp,
@@ -704,6 +722,7 @@ private:
     // do_ev_* methods run in libev thread
     void do_ev_async_perform(handler_type handler, size_t request_num);
     void do_ev_cancel(size_t request_num);
+    void do_ev_unpause(size_t request_num);
 
     void mark_start_performing();
     void mark_open_socket();
@@ -719,6 +738,7 @@ private:
     std::shared_ptr<std::istream> source_;
     std::string* sink_{nullptr};
     std::string post_fields_;
+    body_source_t body_source_;
     std::shared_ptr<form> form_;
     std::shared_ptr<string_list> headers_;
     std::shared_ptr<string_list> proxy_headers_;
@@ -1,6 +1,7 @@
 #include <engine/coro/pool.hpp>
 
 #include <algorithm>  // for std::max/std::min
+#include <chrono>
 #include <iterator>
 #include <optional>
 
@@ -13,11 +14,21 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
 
+namespace {
+
+constexpr std::chrono::steady_clock::duration kStackReclaimPeriod = std::chrono::seconds{1};
+constexpr std::size_t kMaxStacksReclaimedPerStep = 256;
+
+}  // namespace
+
 Pool::Pool(PoolConfig config, Executor executor)
     : config_(FixupConfig(std::move(config))),
       executor_(executor),
       local_coroutine_move_size_((config_.local_cache_size + 1) / 2),
-      stack_allocator_(config_.stack_size),
+      stack_arena_(
+          config_.hugepage_stacks ? std::make_unique<StackArena>(config_.stack_size, config_.max_size) : nullptr
+      ),
+      stack_allocator_(config_.stack_size, stack_arena_.get()),
       stack_usage_monitor_(config_.stack_size),
       initial_coroutines_(config_.initial_size),
       used_coroutines_(config_.max_size),
@@ -70,6 +81,7 @@ void Pool::PutCoroutine(CoroutinePtr&& coroutine_ptr) {
             used_coroutines_.enqueue(GetUsedPoolToken<moodycamel::ProducerToken>(), std::move(coroutine_ptr.Get()));
         if (ok) {
             ++idle_coroutines_num_;
+            MaybeReclaimIdleStacks();
         }
         return;
     }
@@ -88,6 +100,9 @@ PoolStats Pool::GetStats() const {
     stats.total_coroutines = std::max(total_coroutines_num_.load(), stats.active_coroutines);
     stats.max_stack_usage_pct = stack_usage_monitor_.GetMaxStackUsagePct();
     stats.is_stack_usage_monitor_active = stack_usage_monitor_.IsActive();
+    stats.reclaimed_stacks = reclaimed_stacks_num_.load();
+    stats.reclaimed_stack_bytes = reclaimed_stack_bytes_.load();
+    stats.arena_stacks = stack_arena_ ? stack_arena_->GetUsedStacksCount() : 0;
     return stats;
 }
 
@@ -108,6 +123,7 @@ void Pool::ClearLocalCache() {
         );
         if (ok) {
             idle_coroutines_num_.fetch_add(return_to_pool_from_local_cache_num);
+            MaybeReclaimIdleStacks();
         } else {
             return_to_pool_from_local_cache_num = 0;
         }
@@ -175,6 +191,7 @@ void Pool::DepopulateLocalCache() {
         );
         if (ok) {
             idle_coroutines_num_.fetch_add(return_to_pool_from_local_cache_num);
+            MaybeReclaimIdleStacks();
         } else {
             return_to_pool_from_local_cache_num = 0;
         }
@@ -184,6 +201,68 @@ void Pool::DepopulateLocalCache() {
     local_coro_buffer_.erase(local_coro_buffer_.end() - local_coroutine_move_size_, local_coro_buffer_.end());
 }
 
+void Pool::MaybeReclaimIdleStacks() {
+    const auto& threshold = config_.stack_reclaim_idle_threshold;
+    if (!threshold || idle_coroutines_num_.load(std::memory_order_relaxed) <= *threshold) {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    auto next_reclaim = next_stack_reclaim_ns_.load(std::memory_order_relaxed);
+    if (now.count() < next_reclaim) {
+        return;
+    }
+    // Only one of the threads does the step
+    if (!next_stack_reclaim_ns_.compare_exchange_strong(
+            next_reclaim, std::chrono::duration_cast<std::chrono::nanoseconds>(now + kStackReclaimPeriod).count()
+        )) {
+        return;
+    }
+    ReclaimIdleStacks();
+}
+
+void Pool::ReclaimIdleStacks() {
+    // Coroutines in the local caches are reused right away, only the ones in
+    // the shared pool beyond the threshold are likely to sit idle until the
+    // next load spike
+    const auto& threshold = config_.stack_reclaim_idle_threshold;
+    const auto idle_coroutines = idle_coroutines_num_.load();
+    if (!threshold || idle_coroutines <= *threshold) {
+        return;
+    }
+
+    std::vector<Coroutine> coroutines;
+    coroutines.reserve(std::min(idle_coroutines - *threshold, kMaxStacksReclaimedPerStep));
+    const std::size_t dequeued_num = used_coroutines_.try_dequeue_bulk(
+        GetUsedPoolToken<moodycamel::ConsumerToken>(), std::back_inserter(coroutines), coroutines.capacity()
+    );
+    if (dequeued_num == 0) {
+        return;
+    }
+    idle_coroutines_num_.fetch_sub(dequeued_num);
+
+    std::size_t reclaimed_stacks = 0;
+    std::size_t reclaimed_bytes = 0;
+    for (const auto& coroutine : coroutines) {
+        const auto bytes = ReclaimUnusedStack(coroutine, config_.stack_size, config_.stack_reclaim_lazy_free);
+        if (bytes) {
+            ++reclaimed_stacks;
+            reclaimed_bytes += bytes;
+        }
+    }
+    reclaimed_stacks_num_ += reclaimed_stacks;
+    reclaimed_stack_bytes_ += reclaimed_bytes;
+
+    const bool ok = used_coroutines_.enqueue_bulk(
+        GetUsedPoolToken<moodycamel::ProducerToken>(), std::make_move_iterator(coroutines.begin()), dequeued_num
+    );
+    if (ok) {
+        idle_coroutines_num_.fetch_add(dequeued_num);
+    } else {
+        total_coroutines_num_ -= dequeued_num;
+    }
+}
+
 std::size_t Pool::GetStackSize() const { return config_.stack_size; }
 
 PoolConfig Pool::FixupConfig(PoolConfig&& config) {
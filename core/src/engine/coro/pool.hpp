@@ -1,12 +1,15 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
 #include <engine/coro/pool_config.hpp>
 #include <engine/coro/pool_stats.hpp>
+#include <engine/coro/stack_allocator.hpp>
 #include <engine/coro/stack_usage_monitor.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -35,6 +38,10 @@ public:
     void RegisterThread();
     void AccountStackUsage();
 
+    // Releases the unused stack pages of the idle coroutines beyond
+    // stack_reclaim_idle_threshold, up to a batch at a time
+    void ReclaimIdleStacks();
+
 private:
     static PoolConfig FixupConfig(PoolConfig&& config);
 
@@ -44,6 +51,10 @@ private:
     bool TryPopulateLocalCache();
     void DepopulateLocalCache();
 
+    // Calls ReclaimIdleStacks at most once per kStackReclaimPeriod, keeping
+    // the syscalls out of the coroutine return path
+    void MaybeReclaimIdleStacks();
+
     template <typename Token>
     Token& GetUsedPoolToken();
 
@@ -60,10 +71,12 @@ private:
     // outside of any coroutine.
     static inline thread_local std::vector<Coroutine> local_coro_buffer_;
 
-    boost::coroutines2::protected_fixedsize_stack stack_allocator_;
+    // Must outlive all the coroutines
+    std::unique_ptr<StackArena> stack_arena_;
+    StackAllocator stack_allocator_;
     // Some pointers arithmetic in StackUsageMonitor depends on this.
     // If you change the allocator, adjust the math there accordingly.
-    static_assert(std::is_same_v<decltype(stack_allocator_), boost::coroutines2::protected_fixedsize_stack>);
+    static_assert(std::is_same_v<decltype(stack_allocator_), StackAllocator>);
     StackUsageMonitor stack_usage_monitor_;
 
     // We aim to reuse coroutines as much as possible,
@@ -77,6 +90,10 @@ private:
 
     std::atomic<std::size_t> idle_coroutines_num_;
     std::atomic<std::size_t> total_coroutines_num_;
+
+    std::atomic<std::int64_t> next_stack_reclaim_ns_{0};
+    std::atomic<std::size_t> reclaimed_stacks_num_{0};
+    std::atomic<std::size_t> reclaimed_stack_bytes_{0};
 };
 
 class Pool::CoroutinePtr final {
@@ -10,6 +10,9 @@ PoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<PoolCo
     config.max_size = value["max_size"].As<size_t>(config.max_size);
     config.stack_size = value["stack_size"].As<size_t>(config.stack_size);
     config.local_cache_size = value["local_cache_size"].As<size_t>(config.local_cache_size);
+    config.stack_reclaim_idle_threshold = value["stack_reclaim_idle_threshold"].As<std::optional<size_t>>();
+    config.stack_reclaim_lazy_free = value["stack_reclaim_lazy_free"].As<bool>(config.stack_reclaim_lazy_free);
+    config.hugepage_stacks = value["hugepage_stacks"].As<bool>(config.hugepage_stacks);
     return config;
 }
 
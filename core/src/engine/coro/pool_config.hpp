@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 
 #include <userver/formats/yaml.hpp>
@@ -14,6 +15,14 @@ struct PoolConfig {
     std::size_t max_size = 4000;
     std::size_t stack_size = 256 * 1024ULL;
     std::size_t local_cache_size = 8;
+    // Release the unused pages of the coroutines returned to the pool while
+    // more than this many coroutines are idle; unset to never release
+    std::optional<std::size_t> stack_reclaim_idle_threshold;
+    // Use MADV_FREE instead of MADV_DONTNEED for the released pages
+    bool stack_reclaim_lazy_free = false;
+    // Allocate up to max_size stacks from a transparent huge pages backed
+    // arena
+    bool hugepage_stacks = false;
 };
 
 PoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<PoolConfig>);
@@ -12,6 +12,9 @@ struct PoolStats {
     size_t total_coroutines = 0;
     std::uint16_t max_stack_usage_pct = 0;
     bool is_stack_usage_monitor_active = false;
+    size_t reclaimed_stacks = 0;
+    size_t reclaimed_stack_bytes = 0;
+    size_t arena_stacks = 0;
 };
 
 inline PoolStats& operator+=(PoolStats& lhs, const PoolStats& rhs) {
@@ -21,6 +24,9 @@ inline PoolStats& operator+=(PoolStats& lhs, const PoolStats& rhs) {
         lhs.max_stack_usage_pct = rhs.max_stack_usage_pct;
     }
     lhs.is_stack_usage_monitor_active |= rhs.is_stack_usage_monitor_active;
+    lhs.reclaimed_stacks += rhs.reclaimed_stacks;
+    lhs.reclaimed_stack_bytes += rhs.reclaimed_stack_bytes;
+    lhs.arena_stacks += rhs.arena_stacks;
     return lhs;
 }
 
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include <engine/coro/pool.hpp>
+#include <engine/coro/stack_allocator.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kStackConsumption = 64 * 1024;
+
+__attribute__((noinline)) void ConsumeStack() {
+    std::array<volatile char, kStackConsumption> buffer;
+    for (std::size_t i = 0; i < buffer.size(); i += 512) {
+        buffer[i] = 1;
+    }
+}
+
+void ConsumingExecutor(engine::coro::Pool::TaskPipe& task_pipe) {
+    for ([[maybe_unused]] auto* task : task_pipe) {
+        ConsumeStack();
+    }
+}
+
+engine::coro::PoolConfig MakeConfig() {
+    engine::coro::PoolConfig config;
+    config.initial_size = 0;
+    config.max_size = 2;
+    config.local_cache_size = 0;
+    return config;
+}
+
+}  // namespace
+
+TEST(CoroPool, StackReclaim) {
+#if defined(BOOST_USE_UCONTEXT)
+    GTEST_SKIP() << "Suspended coroutine stack pointer is not available with ucontext";
+#endif
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer)
+    GTEST_SKIP() << "ASAN moves big stack variables to the fake stack";
+#endif
+#endif
+
+    auto config = MakeConfig();
+    config.stack_reclaim_idle_threshold = 0;
+    engine::coro::Pool pool(config, &ConsumingExecutor);
+
+    auto coroutine = pool.GetCoroutine();
+    coroutine.Get()(nullptr);
+    std::move(coroutine).ReturnToPool();
+    pool.ReclaimIdleStacks();
+
+    const auto stats = pool.GetStats();
+    EXPECT_EQ(stats.reclaimed_stacks, 1);
+    EXPECT_GE(stats.reclaimed_stack_bytes, kStackConsumption / 2);
+    EXPECT_LT(stats.reclaimed_stack_bytes, config.stack_size);
+
+    // The coroutine is still usable after its stack got reclaimed
+    coroutine = pool.GetCoroutine();
+    coroutine.Get()(nullptr);
+    std::move(coroutine).ReturnToPool();
+    pool.ReclaimIdleStacks();
+    EXPECT_EQ(pool.GetStats().reclaimed_stacks, 2);
+}
+
+TEST(CoroPool, NoStackReclaimBelowThreshold) {
+    auto config = MakeConfig();
+    config.stack_reclaim_idle_threshold = 1;
+    engine::coro::Pool pool(config, &ConsumingExecutor);
+
+    auto coroutine = pool.GetCoroutine();
+    coroutine.Get()(nullptr);
+    std::move(coroutine).ReturnToPool();
+    pool.ReclaimIdleStacks();
+
+    EXPECT_EQ(pool.GetStats().reclaimed_stacks, 0);
+    EXPECT_EQ(pool.GetStats().reclaimed_stack_bytes, 0);
+}
+
+TEST(CoroPool, HugepageStacks) {
+    auto config = MakeConfig();
+    config.hugepage_stacks = true;
+    engine::coro::Pool pool(config, &ConsumingExecutor);
+
+    std::vector<engine::coro::Pool::CoroutinePtr> coroutines;
+    for (std::size_t i = 0; i < config.max_size + 1; ++i) {
+        coroutines.push_back(pool.GetCoroutine());
+        coroutines.back().Get()(nullptr);
+    }
+    // The rest are allocated with guard pages
+    EXPECT_EQ(pool.GetStats().arena_stacks, config.max_size);
+
+    for (auto& coroutine : coroutines) {
+        std::move(coroutine).ReturnToPool();
+    }
+}
+
+TEST(CoroPool, HugepageStackRuns) {
+    constexpr std::size_t kStackSize = 256 * 1024;
+    // Several runs, the last one is not full
+    constexpr std::size_t kStacksCount = 8 * 3 + 5;
+    engine::coro::StackArena arena{kStackSize, kStacksCount};
+
+    std::vector<boost::context::stack_context> stacks;
+    for (std::size_t i = 0; i < kStacksCount; ++i) {
+        auto sctx = arena.TryAllocate();
+        ASSERT_TRUE(sctx);
+        EXPECT_EQ(sctx->size, kStackSize);
+        // The whole stack is writable
+        std::memset(static_cast<char*>(sctx->sp) - kStackSize, 1, kStackSize);
+        stacks.push_back(*sctx);
+    }
+    EXPECT_FALSE(arena.TryAllocate());
+    EXPECT_EQ(arena.GetUsedStacksCount(), kStacksCount);
+
+    std::vector<void*> stack_ends;
+    for (const auto& sctx : stacks) stack_ends.push_back(sctx.sp);
+    std::sort(stack_ends.begin(), stack_ends.end());
+    EXPECT_EQ(std::adjacent_find(stack_ends.begin(), stack_ends.end()), stack_ends.end());
+
+    for (auto& sctx : stacks) {
+        EXPECT_TRUE(arena.TryDeallocate(sctx));
+    }
+    EXPECT_EQ(arena.GetUsedStacksCount(), 0);
+
+    boost::context::stack_context foreign;
+    std::array<char, 16> buffer{};
+    foreign.sp = buffer.data() + buffer.size();
+    EXPECT_FALSE(arena.TryDeallocate(foreign));
+}
+
+USERVER_NAMESPACE_END
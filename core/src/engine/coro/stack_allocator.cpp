@@ -0,0 +1,245 @@
+#include <engine/coro/stack_allocator.hpp>
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <system_error>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <engine/coro/stack_usage_monitor.hpp>
+#include <utils/check_syscall.hpp>
+#include <utils/sys_info.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+namespace {
+
+// The most common transparent huge page size
+constexpr std::size_t kHugePageSize = 2 * 1024 * 1024;
+
+// Each run takes two VMAs, its guard and its stacks. Keeps well below the
+// default vm.max_map_count of 65530, that is shared with the mmap-ed stacks.
+constexpr std::size_t kMaxRuns = 4096;
+
+const auto kPageSize = utils::sys_info::GetPageSize();
+
+std::uintptr_t RoundDownTo(std::uintptr_t value, std::size_t alignment) noexcept { return value & ~(alignment - 1); }
+
+std::uintptr_t RoundUpTo(std::uintptr_t value, std::size_t alignment) noexcept {
+    return RoundDownTo(value + alignment - 1, alignment);
+}
+
+// Counts resident pages in [begin, end) with mincore(2)
+std::size_t CountResidentPages(std::uintptr_t begin, std::uintptr_t end) noexcept {
+    constexpr std::size_t kChunkPages = 64;
+    std::array<unsigned char, kChunkPages> residency{};
+
+    std::size_t resident_pages = 0;
+    while (begin < end) {
+        const auto chunk_size = std::min(end - begin, kChunkPages * kPageSize);
+        // NOLINTNEXTLINE(performance-no-int-to-ptr)
+        if (::mincore(reinterpret_cast<void*>(begin), chunk_size, residency.data()) == -1) {
+            // Unknown, assume everything is resident
+            return (end - begin) / kPageSize + resident_pages;
+        }
+        for (std::size_t i = 0; i < chunk_size / kPageSize; ++i) {
+            resident_pages += residency[i] & 1;
+        }
+        begin += chunk_size;
+    }
+    return resident_pages;
+}
+
+}  // namespace
+
+StackArena::StackArena(std::size_t stack_size, std::size_t stacks_count)
+    : stack_size_(stack_size), stacks_count_(stacks_count) {
+    UASSERT(stack_size_ % kPageSize == 0);
+    if (stacks_count_ == 0) {
+        return;
+    }
+
+    if (kHugePageSize % stack_size_ != 0 && stack_size_ % kHugePageSize != 0) {
+        LOG_WARNING() << "Coroutine stack size " << stack_size_ << " is neither a divisor nor a multiple of the "
+                      << kHugePageSize << " bytes huge page, the rest of the last huge page of each run of stacks "
+                      << "is wasted";
+    }
+
+    stacks_per_run_ = std::max<std::size_t>(kHugePageSize / stack_size_, 1);
+    runs_count_ = (stacks_count_ + stacks_per_run_ - 1) / stacks_per_run_;
+    if (runs_count_ > kMaxRuns) {
+        stacks_per_run_ = (stacks_count_ + kMaxRuns - 1) / kMaxRuns;
+        runs_count_ = (stacks_count_ + stacks_per_run_ - 1) / stacks_per_run_;
+    }
+    run_stride_ = kHugePageSize + RoundUpTo(stacks_per_run_ * stack_size_, kHugePageSize);
+
+    // Over-reserve to align the runs on a huge page boundary
+    const std::size_t stacks_size = run_stride_ * runs_count_;
+    mapping_size_ = stacks_size + kHugePageSize;
+    // MAP_NORESERVE: pages are committed on the first touch only
+    void* mapping = ::mmap(
+        nullptr, mapping_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0
+    );
+    utils::CheckSyscallNotEquals(mapping, MAP_FAILED, "reserving {} bytes for the coroutine stacks", mapping_size_);
+    mapping_ = static_cast<char*>(mapping);
+    // NOLINTNEXTLINE(performance-no-int-to-ptr)
+    stacks_begin_ = reinterpret_cast<char*>(RoundUpTo(reinterpret_cast<std::uintptr_t>(mapping_), kHugePageSize));
+
+    // Stacks grow down, the guard huge page is at the lowest address of a run.
+    // There are no guards inside a run, so that it is backed by huge pages.
+    for (std::size_t run = 0; run < runs_count_; ++run) {
+        char* const run_begin = stacks_begin_ + run * run_stride_;
+        if (::mprotect(run_begin, kHugePageSize, PROT_NONE) == -1) {
+            const auto error = errno;
+            ::munmap(mapping_, mapping_size_);
+            throw std::system_error(error, std::system_category(), "protecting a coroutine stacks guard");
+        }
+#ifdef MADV_HUGEPAGE
+        const bool hugepages_enabled =
+            ::madvise(run_begin + kHugePageSize, run_stride_ - kHugePageSize, MADV_HUGEPAGE) == 0;
+        if (!hugepages_enabled && run == 0) {
+            LOG_WARNING() << "Failed to enable transparent huge pages for the coroutine stacks arena: "
+                          << std::error_code(errno, std::system_category()).message();
+        }
+#endif
+    }
+#ifndef MADV_HUGEPAGE
+    LOG_WARNING() << "Transparent huge pages are not supported on the target platform";
+#endif
+
+    free_slots_.reserve(stacks_count_);
+    // Reverse order to hand out the lowest addresses first
+    for (std::size_t i = stacks_count_; i > 0; --i) {
+        free_slots_.push_back(i - 1);
+    }
+
+    LOG_INFO() << "Reserved " << stacks_size << " bytes for " << stacks_count_ << " coroutine stacks in "
+               << runs_count_ << " runs of " << stacks_per_run_;
+}
+
+StackArena::~StackArena() {
+    if (mapping_) {
+        ::munmap(mapping_, mapping_size_);
+    }
+}
+
+char* StackArena::GetStackEnd(std::size_t slot) const noexcept {
+    const std::size_t run = slot / stacks_per_run_;
+    const std::size_t index = slot % stacks_per_run_;
+    return stacks_begin_ + run * run_stride_ + kHugePageSize + (index + 1) * stack_size_;
+}
+
+std::optional<boost::context::stack_context> StackArena::TryAllocate() {
+    std::size_t slot = 0;
+    {
+        const std::lock_guard lock{mutex_};
+        if (free_slots_.empty()) {
+            return std::nullopt;
+        }
+        slot = free_slots_.back();
+        free_slots_.pop_back();
+    }
+
+    boost::context::stack_context sctx;
+    sctx.size = stack_size_;
+    sctx.sp = GetStackEnd(slot);
+    return sctx;
+}
+
+bool StackArena::TryDeallocate(boost::context::stack_context& sctx) noexcept {
+    auto* const stack_end = static_cast<char*>(sctx.sp);
+    if (stack_end <= stacks_begin_ || stack_end > stacks_begin_ + runs_count_ * run_stride_) {
+        return false;
+    }
+    const auto offset = static_cast<std::size_t>(stack_end - stacks_begin_);
+    // The end of the last stack of a run may be the beginning of the next run
+    const std::size_t run = (offset - 1) / run_stride_;
+    const std::size_t run_offset = offset - run * run_stride_;
+    UASSERT(run_offset > kHugePageSize && (run_offset - kHugePageSize) % stack_size_ == 0);
+    const std::size_t slot = run * stacks_per_run_ + (run_offset - kHugePageSize) / stack_size_ - 1;
+    UASSERT(slot < stacks_count_ && GetStackEnd(slot) == stack_end);
+
+    // The next owner gets a zeroed stack, as with a fresh mmap
+    ::madvise(stack_end - stack_size_, stack_size_, MADV_DONTNEED);
+
+    const std::lock_guard lock{mutex_};
+    free_slots_.push_back(slot);
+    return true;
+}
+
+std::size_t StackArena::GetUsedStacksCount() const {
+    const std::lock_guard lock{mutex_};
+    return stacks_count_ - free_slots_.size();
+}
+
+StackAllocator::StackAllocator(std::size_t stack_size, StackArena* arena) noexcept
+    : fallback_allocator_(stack_size), arena_(arena) {}
+
+boost::context::stack_context StackAllocator::allocate() {
+    if (arena_) {
+        if (auto sctx = arena_->TryAllocate()) {
+            return *sctx;
+        }
+    }
+    return fallback_allocator_.allocate();
+}
+
+void StackAllocator::deallocate(boost::context::stack_context& sctx) noexcept {
+    if (arena_ && arena_->TryDeallocate(sctx)) {
+        return;
+    }
+    fallback_allocator_.deallocate(sctx);
+}
+
+std::size_t ReclaimUnusedStack(
+    const boost::coroutines2::coroutine<impl::TaskContext*>::push_type& coro,
+    std::size_t stack_size,
+    bool lazy_free
+) noexcept {
+    const auto stack_pointer = reinterpret_cast<std::uintptr_t>(GetCoroSuspendedStackPointer(coro));
+    if (!stack_pointer) {
+        return 0;
+    }
+
+    // Control block resides at the top of the stack, see StackUsageMonitor
+    const auto stack_begin = RoundUpTo(reinterpret_cast<std::uintptr_t>(GetCoroCbPtr(coro)), kPageSize);
+    const auto stack_end = stack_begin - stack_size;
+    if (stack_pointer <= stack_end || stack_pointer > stack_begin) {
+        UASSERT_MSG(false, "Suspended coroutine stack pointer is out of its stack");
+        return 0;
+    }
+
+    // Everything above the stack pointer is alive, keep one more page below
+    // it just in case
+    const auto reclaim_begin = RoundDownTo(stack_pointer, kPageSize) - kPageSize;
+    if (reclaim_begin <= stack_end) {
+        return 0;
+    }
+
+    const auto resident_pages = CountResidentPages(stack_end, reclaim_begin);
+    if (resident_pages == 0) {
+        return 0;
+    }
+
+#ifdef MADV_FREE
+    const int advice = lazy_free ? MADV_FREE : MADV_DONTNEED;
+#else
+    const int advice = MADV_DONTNEED;
+    static_cast<void>(lazy_free);
+#endif
+    // NOLINTNEXTLINE(performance-no-int-to-ptr)
+    if (::madvise(reinterpret_cast<void*>(stack_end), reclaim_begin - stack_end, advice) == -1) {
+        return 0;
+    }
+    return resident_pages * kPageSize;
+}
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <coroutines/coroutine.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+class TaskContext;
+}  // namespace engine::impl
+
+namespace engine::coro {
+
+/// Pre-reserved transparent huge pages backed region for coroutine stacks.
+///
+/// Stacks are grouped into 2MiB-aligned runs of adjacent stacks, each run is
+/// preceded by a PROT_NONE guard huge page. There are no guards between the
+/// stacks of a run, otherwise the kernel could not back it by huge pages:
+/// an overflow of a stack that is not the lowest one in its run corrupts the
+/// neighbouring stack instead of crashing. The number of runs is bounded to
+/// keep the number of mappings well below vm.max_map_count. StackUsageMonitor
+/// marks split the runs, so huge pages are not used with the monitor enabled.
+class StackArena final {
+public:
+    StackArena(std::size_t stack_size, std::size_t stacks_count);
+    ~StackArena();
+
+    StackArena(const StackArena&) = delete;
+    StackArena& operator=(const StackArena&) = delete;
+
+    std::optional<boost::context::stack_context> TryAllocate();
+
+    /// @returns false if the stack was not allocated from this arena
+    bool TryDeallocate(boost::context::stack_context& sctx) noexcept;
+
+    std::size_t GetUsedStacksCount() const;
+
+private:
+    char* GetStackEnd(std::size_t slot) const noexcept;
+
+    const std::size_t stack_size_;
+    const std::size_t stacks_count_;
+    std::size_t stacks_per_run_{0};
+    std::size_t runs_count_{0};
+    // Guard huge page and the stacks of a run
+    std::size_t run_stride_{0};
+    std::size_t mapping_size_{0};
+    char* mapping_{nullptr};
+    char* stacks_begin_{nullptr};
+
+    mutable std::mutex mutex_;
+    std::vector<std::size_t> free_slots_;
+};
+
+/// Stack allocator for coroutines that takes stacks from the arena if any
+/// and falls back to the guarded mmap-ed stacks otherwise.
+///
+/// Stack layout is the same in both cases: the usable part of the stack is
+/// [sp - stack_size, sp), StackUsageMonitor math depends on that.
+class StackAllocator final {
+public:
+    StackAllocator(std::size_t stack_size, StackArena* arena) noexcept;
+
+    boost::context::stack_context allocate();
+    void deallocate(boost::context::stack_context& sctx) noexcept;
+
+private:
+    boost::coroutines2::protected_fixedsize_stack fallback_allocator_;
+    StackArena* arena_;
+};
+
+/// Releases the pages of the coroutine stack below the stack pointer of the
+/// suspended coroutine.
+///
+/// @returns the amount of resident bytes released
+std::size_t ReclaimUnusedStack(
+    const boost::coroutines2::coroutine<impl::TaskContext*>::push_type& coro,
+    std::size_t stack_size,
+    bool lazy_free
+) noexcept;
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
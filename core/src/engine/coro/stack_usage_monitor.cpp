@@ -1,5 +1,7 @@
 #include <engine/coro/stack_usage_monitor.hpp>
 
+#include <cstring>
+
 #include <coroutines/coroutine.hpp>
 
 #include <engine/task/task_context.hpp>
@@ -57,6 +59,21 @@ public:
     static const void* GetCbPtr(const push_coroutine<T>& coro) {
         return coro.cb_;
     }
+
+    template <typename T>
+    static const void* GetSuspendedStackPointer(const push_coroutine<T>& coro) {
+#if defined(BOOST_USE_UCONTEXT) || defined(BOOST_USE_WINFIB)
+        return nullptr;
+#else
+        // fcontext-based fiber holds nothing but the stack pointer of the
+        // suspended context
+        const auto& fiber = coro.cb_->c;
+        static_assert(sizeof(fiber) == sizeof(void*));
+        const void* stack_pointer = nullptr;
+        std::memcpy(&stack_pointer, &fiber, sizeof(stack_pointer));
+        return stack_pointer;
+#endif
+    }
 };
 }  // namespace boost::coroutines2::detail
 
@@ -68,6 +85,12 @@ const void* GetCoroCbPtr(const boost::coroutines2::coroutine<impl::TaskContext*>
     return boost::coroutines2::detail::pull_coroutine<boost::coroutines2::detail::FriendHijackTag>::GetCbPtr(coro);
 }
 
+const void* GetCoroSuspendedStackPointer(const boost::coroutines2::coroutine<impl::TaskContext*>::push_type& coro
+) noexcept {
+    return boost::coroutines2::detail::pull_coroutine<
+        boost::coroutines2::detail::FriendHijackTag>::GetSuspendedStackPointer(coro);
+}
+
 #ifdef HAS_STACK_USAGE_MONITOR
 
 namespace {
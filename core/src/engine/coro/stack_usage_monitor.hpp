@@ -42,6 +42,15 @@ private:
 
 std::size_t GetCurrentTaskStackUsageBytes() noexcept;
 
+// Pointer to the coroutine control block, which resides at the very top of
+// the coroutine stack
+const void* GetCoroCbPtr(const boost::coroutines2::coroutine<impl::TaskContext*>::push_type& coro) noexcept;
+
+// Stack pointer of a suspended coroutine, nullptr if it could not be obtained
+// on the target platform
+const void* GetCoroSuspendedStackPointer(const boost::coroutines2::coroutine<impl::TaskContext*>::push_type& coro
+) noexcept;
+
 }  // namespace engine::coro
 
 USERVER_NAMESPACE_END
@@ -40,9 +40,33 @@ void ReleaseEvDefaultLoop() {
     GetEvDefaultLoopFlag().clear();
 }
 
+unsigned GetEvBackendFlags(EvBackend ev_backend) noexcept {
+    switch (ev_backend) {
+        case EvBackend::kDefault:
+            return EVFLAG_AUTO;
+        case EvBackend::kEpoll:
+            return EVBACKEND_EPOLL;
+        case EvBackend::kIoUring:
+// io_uring backend is available since libev 4.31
+#if EV_VERSION_MAJOR > 4 || (EV_VERSION_MAJOR == 4 && EV_VERSION_MINOR >= 31)
+            return EVBACKEND_IOURING;
+#else
+            return 0;
+#endif
+    }
+
+    UASSERT_MSG(false, "Unexpected EvBackend value");
+    return EVFLAG_AUTO;
+}
+
+struct ev_loop* MakeEvLoop(EventLoop::EvLoopType ev_loop_mode, unsigned flags) noexcept {
+    return (ev_loop_mode == EventLoop::EvLoopType::kDefaultLoop) ? ev_default_loop(flags) : ev_loop_new(flags);
+}
+
 }  // namespace
 
-EventLoop::EventLoop(EvLoopType ev_loop_mode) : ev_loop_mode_(ev_loop_mode) {
+EventLoop::EventLoop(EvLoopType ev_loop_mode, EvBackend ev_backend)
+    : ev_loop_mode_(ev_loop_mode), ev_backend_(ev_backend) {
     if (ev_loop_mode_ == EvLoopType::kDefaultLoop) AcquireEvDefaultLoop();
     Start();
 }
@@ -78,7 +102,20 @@ bool EventLoop::DebugIsSameOsThread() noexcept {
 }
 
 void EventLoop::Start() {
-    loop_ = ((ev_loop_mode_ == EvLoopType::kDefaultLoop) ? ev_default_loop(EVFLAG_AUTO) : ev_loop_new(EVFLAG_AUTO));
+    if (ev_backend_ != EvBackend::kDefault) {
+        // libev silently ignores backends it was built without, and io_uring
+        // may also be forbidden by the kernel or seccomp
+        const auto backend_flags = GetEvBackendFlags(ev_backend_);
+        if (backend_flags & ev_supported_backends()) {
+            loop_ = MakeEvLoop(ev_loop_mode_, backend_flags);
+        }
+        if (!loop_) {
+            LOG_WARNING() << "Requested ev backend is not available, falling back to the default one";
+        }
+    }
+    if (!loop_) {
+        loop_ = MakeEvLoop(ev_loop_mode_, EVFLAG_AUTO);
+    }
 
     UASSERT(loop_);
 #ifdef EV_HAS_IO_PESSIMISTIC_REMOVE
@@ -27,13 +27,14 @@ const auto kCpuStatsThrottle = static_cast<std::size_t>(kCpuStatsCollectInterval
 
 }  // namespace
 
-Thread::Thread(const std::string& thread_name) : Thread(thread_name, EventLoop::EvLoopType::kNewLoop) {}
+Thread::Thread(const std::string& thread_name, EvBackend ev_backend)
+    : Thread(thread_name, EventLoop::EvLoopType::kNewLoop, ev_backend) {}
 
-Thread::Thread(const std::string& thread_name, UseDefaultEvLoop)
-    : Thread(thread_name, EventLoop::EvLoopType::kDefaultLoop) {}
+Thread::Thread(const std::string& thread_name, UseDefaultEvLoop, EvBackend ev_backend)
+    : Thread(thread_name, EventLoop::EvLoopType::kDefaultLoop, ev_backend) {}
 
-Thread::Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type)
-    : event_loop_(ev_loop_type),
+Thread::Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type, EvBackend ev_backend)
+    : event_loop_(ev_loop_type, ev_backend),
       lock_(loop_mutex_, std::defer_lock),
       name_{thread_name},
       cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle} {
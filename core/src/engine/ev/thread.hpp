@@ -27,8 +27,8 @@ public:
     struct UseDefaultEvLoop {};
     static constexpr UseDefaultEvLoop kUseDefaultEvLoop{};
 
-    explicit Thread(const std::string& thread_name);
-    Thread(const std::string& thread_name, UseDefaultEvLoop);
+    explicit Thread(const std::string& thread_name, EvBackend ev_backend = EvBackend::kDefault);
+    Thread(const std::string& thread_name, UseDefaultEvLoop, EvBackend ev_backend = EvBackend::kDefault);
 
     ~Thread();
 
@@ -49,7 +49,7 @@ public:
     const std::string& GetName() const;
 
 private:
-    Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type);
+    Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type, EvBackend ev_backend);
 
     void RegisterInEvLoop(AsyncPayloadBase& payload);
 
@@ -1,13 +1,45 @@
 #include "thread_pool_config.hpp"
 
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/utils/trivial_map.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+namespace {
+
+constexpr utils::TrivialBiMap kEvBackendMap([](auto selector) {
+    return selector()
+        .Case(EvBackend::kDefault, "default")
+        .Case(EvBackend::kEpoll, "epoll")
+        .Case(EvBackend::kIoUring, "io_uring");
+});
+
+}  // namespace
+
+EvBackend ParseEvBackend(std::string_view value) {
+    const auto result = kEvBackendMap.TryFindBySecond(value);
+    if (!result) {
+        throw std::runtime_error(fmt::format(
+            "Unknown ev backend '{}', expected one of: {}", value, kEvBackendMap.DescribeSecond()
+        ));
+    }
+    return *result;
+}
+
+EvBackend Parse(const yaml_config::YamlConfig& value, formats::parse::To<EvBackend>) {
+    return utils::ParseFromValueString(value, kEvBackendMap);
+}
+
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ThreadPoolConfig>) {
     ThreadPoolConfig config;
     config.threads = value["threads"].As<std::size_t>(config.threads);
     config.thread_name = value["thread_name"].As<std::string>(config.thread_name);
+    config.ev_backend = value["ev_backend"].As<EvBackend>(config.ev_backend);
     return config;
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include <userver/formats/yaml.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
@@ -9,10 +10,26 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+/// libev backend used by the ev loops of the pool
+enum class EvBackend {
+    kDefault,  ///< libev's own choice, epoll on Linux
+    kEpoll,
+    /// libev io_uring backend. It is still readiness-based: libev polls the
+    /// descriptors via io_uring, the IO syscalls themselves are unchanged.
+    /// Falls back to kDefault if libev was built without it, or the kernel or
+    /// seccomp forbid io_uring (see EventLoop::Start)
+    kIoUring,
+};
+
+EvBackend ParseEvBackend(std::string_view value);
+
+EvBackend Parse(const yaml_config::YamlConfig& value, formats::parse::To<EvBackend>);
+
 struct ThreadPoolConfig {
     std::size_t threads = 2;
     std::string thread_name = "event-worker";
     bool ev_default_loop_disabled = false;
+    EvBackend ev_backend = EvBackend::kDefault;
 };
 
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ThreadPoolConfig>);
@@ -23,6 +23,15 @@ namespace {
 
 constexpr auto kDeadlineMaxTime = std::chrono::seconds{60};
 
+constexpr std::array<const char*, 2> kEvBackends = {"epoll", "io_uring"};
+
+engine::TaskProcessorPoolsConfig MakeEvBackendConfig(benchmark::State& state) {
+    engine::TaskProcessorPoolsConfig config;
+    config.ev_backend = kEvBackends.at(state.range(0));
+    state.SetLabel(config.ev_backend);
+    return config;
+}
+
 }  // namespace
 
 void socket_send_all(benchmark::State& state) {
@@ -134,4 +143,58 @@ BENCHMARK(socket_send_all_v);
 // TODO(TAXICOMMON-5510) flaky, sometimes throws engine::io::IoTimeout
 // BENCHMARK(socket_send_all_range)->RangeMultiplier(10)->Range(10, 10000);
 
+// Every RecvSome has to wait for readiness, so the ev backend is on the hot path
+void socket_ping_pong_ev_backend(benchmark::State& state) {
+    engine::RunStandalone(2, MakeEvBackendConfig(state), [&]() {
+        const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+        internal::net::TcpListener listener;
+        auto [server, client] = listener.MakeSocketPair(test_deadline);
+        auto task_echo = engine::AsyncNoSpan(
+            [test_deadline](auto&& server) {
+                std::array<char, 128> buf = {};
+                while (true) {
+                    const auto recv_bytes = server.RecvSome(buf.data(), buf.size(), test_deadline);
+                    if (recv_bytes == 0) break;
+                    [[maybe_unused]] const auto sent_bytes = server.SendAll(buf.data(), recv_bytes, test_deadline);
+                }
+            },
+            std::move(server)
+        );
+        std::array<char, 128> buf = {};
+        for ([[maybe_unused]] auto _ : state) {
+            auto bytes = client.SendAll("ping", 4, test_deadline);
+            bytes += client.RecvAll(buf.data(), 4, test_deadline);
+            benchmark::DoNotOptimize(bytes);
+        }
+        client.Close();
+        task_echo.Get();
+    });
+}
+BENCHMARK(socket_ping_pong_ev_backend)->DenseRange(0, kEvBackends.size() - 1);
+
+void socket_send_all_ev_backend(benchmark::State& state) {
+    engine::RunStandalone(2, MakeEvBackendConfig(state), [&]() {
+        const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+        internal::net::TcpListener listener;
+        auto [server, client] = listener.MakeSocketPair(test_deadline);
+        std::atomic<bool> reading{true};
+        auto task_reader = engine::AsyncNoSpan(
+            [&reading, test_deadline](auto&& server) {
+                std::array<char, 128> buf = {};
+                while (server.RecvSome(buf.data(), buf.size(), test_deadline) > 0 && reading) {
+                }
+            },
+            std::move(server)
+        );
+        for ([[maybe_unused]] auto _ : state) {
+            const auto send_bytes = client.SendAll({{"qqq", 3}, {"aaa", 3}, {"qwerty", 6}}, test_deadline);
+            benchmark::DoNotOptimize(send_bytes);
+        }
+        reading.store(false);
+        client.Close();
+        task_reader.Get();
+    });
+}
+BENCHMARK(socket_send_all_ev_backend)->DenseRange(0, kEvBackends.size() - 1);
+
 USERVER_NAMESPACE_END
@@ -15,6 +15,7 @@
 #include <userver/engine/io/sockaddr.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/run_standalone.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/wait_any.hpp>
@@ -193,6 +194,30 @@ UTEST(Socket, SendAllVector) {
     EXPECT_EQ(bytes_sent, bytes_read);
 }
 
+TEST(Socket, IoUringEvBackend) {
+    engine::TaskProcessorPoolsConfig config;
+    config.ev_backend = "io_uring";
+
+    // Falls back to the default backend if io_uring is not available
+    engine::RunStandalone(2, config, [] {
+        const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+        TcpListener listener;
+        auto sockets = listener.MakeSocketPair(deadline);
+        auto echo_task = engine::AsyncNoSpan([&sockets, &deadline] {
+            std::array<char, 16> buf = {};
+            const auto bytes_read = sockets.first.RecvAll(buf.data(), 4, deadline);
+            EXPECT_EQ(sockets.first.SendAll(buf.data(), bytes_read, deadline), bytes_read);
+        });
+
+        std::array<char, 16> buf = {};
+        EXPECT_EQ(sockets.second.SendAll("ping", 4, deadline), 4);
+        EXPECT_EQ(sockets.second.RecvAll(buf.data(), 4, deadline), 4);
+        EXPECT_EQ(std::string_view(buf.data(), 4), "ping");
+        echo_task.Get();
+    });
+}
+
 UTEST(Socket, WaitAnyRead) {
     const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
     TcpListener listener;
@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <concurrent/impl/latch.hpp>
 #include <engine/impl/standalone.hpp>
@@ -15,14 +16,40 @@
 #include <engine/task/work_stealing_queue/task_queue.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/single_threaded_task_processors_pool.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_all_checked.hpp>
 #include <utils/impl/parallelize_benchmark.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+std::unique_ptr<engine::TaskProcessor> MakeBenchmarkTaskProcessor(benchmark::State& state) {
+    engine::TaskProcessorConfig proc_config;
+    proc_config.name = "benchmark";
+    proc_config.thread_name = "benchmark";
+    proc_config.worker_threads = state.range(0);
+    proc_config.task_processor_queue =
+        state.range(1) ? engine::TaskQueueType::kWorkStealingTaskQueue : engine::TaskQueueType::kGlobalTaskQueue;
+    return std::make_unique<engine::TaskProcessor>(
+        std::move(proc_config), engine::current_task::GetTaskProcessor().GetTaskProcessorPools()
+    );
+}
+
+void TaskQueueArgs(benchmark::internal::Benchmark* b) {
+    for (int threads : {2, 4, 8, 16}) {
+        for (int work_stealing : {0, 1}) {
+            b->Args({threads, work_stealing});
+        }
+    }
+}
+
+}  // namespace
+
 void engine_task_create(benchmark::State& state) {
     // We use 2 threads to ensure that detached tasks are deallocated,
     // otherwise this benchmark OOMs after some time.
@@ -194,4 +221,54 @@ void engine_tasks_from_another_task_processor(benchmark::State& state) {
 }
 BENCHMARK(engine_tasks_from_another_task_processor)->RangeMultiplier(2)->Range(2, 32)->Arg(6)->Arg(12);
 
+// range(0) - worker threads, range(1) - 1 for work stealing queue
+void engine_task_ping_pong(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        auto task_processor = MakeBenchmarkTaskProcessor(state);
+        engine::SingleConsumerEvent ping;
+        engine::SingleConsumerEvent pong;
+        std::atomic<bool> keep_running{true};
+
+        auto ponger = engine::AsyncNoSpan(*task_processor, [&] {
+            while (ping.WaitForEvent() && keep_running) {
+                pong.Send();
+            }
+        });
+
+        engine::AsyncNoSpan(*task_processor, [&] {
+            for ([[maybe_unused]] auto _ : state) {
+                ping.Send();
+                [[maybe_unused]] const bool ok = pong.WaitForEvent();
+            }
+            keep_running = false;
+            ping.Send();
+        }).Get();
+        ponger.Get();
+    });
+}
+BENCHMARK(engine_task_ping_pong)->Apply(TaskQueueArgs);
+
+// range(0) - worker threads, range(1) - 1 for work stealing queue
+void engine_task_fan_out(benchmark::State& state) {
+    constexpr std::size_t kTasksCount = 64;
+    engine::RunStandalone([&] {
+        auto task_processor = MakeBenchmarkTaskProcessor(state);
+
+        engine::AsyncNoSpan(*task_processor, [&] {
+            std::vector<engine::TaskWithResult<void>> tasks;
+            tasks.reserve(kTasksCount);
+            for ([[maybe_unused]] auto _ : state) {
+                for (std::size_t i = 0; i < kTasksCount; ++i) {
+                    tasks.push_back(engine::AsyncNoSpan([] {}));
+                }
+                engine::WaitAllChecked(tasks);
+                tasks.clear();
+            }
+        }).Get();
+
+        state.SetItemsProcessed(state.iterations() * kTasksCount);
+    });
+}
+BENCHMARK(engine_task_fan_out)->Apply(TaskQueueArgs);
+
 USERVER_NAMESPACE_END
@@ -1,9 +1,13 @@
 #include "task_processor.hpp"
 
+#include <sched.h>
 #include <sys/types.h>
+
+#include <algorithm>
 #include <csignal>
 
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 
 #include <concurrent/impl/latch.hpp>
 #include <userver/logging/log.hpp>
@@ -14,6 +18,7 @@
 #include <userver/utils/thread_name.hpp>
 #include <userver/utils/threads.hpp>
 #include <utils/statistics/thread_statistics.hpp>
+#include <utils/sys_info.hpp>
 
 #include <engine/task/counted_coroutine_ptr.hpp>
 #include <engine/task/task_context.hpp>
@@ -93,12 +98,82 @@ auto MakeTaskQueue(TaskProcessorConfig config) {
     UINVARIANT(false, "Unexpected value of TaskQueueType enum");
 }
 
+bool Contains(const std::vector<std::size_t>& values, std::size_t value) {
+    return std::find(values.begin(), values.end(), value) != values.end();
+}
+
+// Reports the settings that the worker threads would fail to apply
+TaskProcessorConfig ResolveCpuAffinity(TaskProcessorConfig config) {
+    if (!config.numa_node && config.cpu_affinity.empty()) {
+        return config;
+    }
+    const auto allowed_cpus = utils::sys_info::GetAllowedCpus();
+
+    if (config.numa_node) {
+        // Throws if the node does not exist
+        auto node_cpus = utils::sys_info::GetNumaNodeCpus(*config.numa_node);
+
+        const auto allowed_numa_nodes = utils::sys_info::GetAllowedNumaNodes();
+        if (allowed_numa_nodes && !Contains(*allowed_numa_nodes, *config.numa_node)) {
+            throw std::runtime_error(fmt::format(
+                "numa-node {} of task processor '{}' is not allowed for the process, allowed nodes: {}",
+                *config.numa_node,
+                config.name,
+                fmt::join(*allowed_numa_nodes, ",")
+            ));
+        }
+
+        if (config.cpu_affinity.empty()) {
+            if (allowed_cpus) {
+                node_cpus.erase(
+                    std::remove_if(
+                        node_cpus.begin(),
+                        node_cpus.end(),
+                        [&](std::size_t cpu) { return !Contains(*allowed_cpus, cpu); }
+                    ),
+                    node_cpus.end()
+                );
+            }
+            if (node_cpus.empty()) {
+                throw std::runtime_error(fmt::format(
+                    "None of the CPUs of numa-node {} of task processor '{}' is allowed for the process",
+                    *config.numa_node,
+                    config.name
+                ));
+            }
+            config.cpu_affinity = std::move(node_cpus);
+        }
+    }
+
+    for (const auto cpu : config.cpu_affinity) {
+#ifdef CPU_SETSIZE
+        if (cpu >= CPU_SETSIZE) {
+            throw std::runtime_error(fmt::format(
+                "cpu-affinity of task processor '{}' has CPU {}, the maximum supported is {}",
+                config.name,
+                cpu,
+                CPU_SETSIZE - 1
+            ));
+        }
+#endif
+        if (allowed_cpus && !Contains(*allowed_cpus, cpu)) {
+            throw std::runtime_error(fmt::format(
+                "cpu-affinity of task processor '{}' has CPU {} that is not allowed for the process, allowed CPUs: {}",
+                config.name,
+                cpu,
+                fmt::join(*allowed_cpus, ",")
+            ));
+        }
+    }
+    return config;
+}
+
 }  // namespace
 
 TaskProcessor::TaskProcessor(TaskProcessorConfig config, std::shared_ptr<impl::TaskProcessorPools> pools)
     : task_queue_(MakeTaskQueue(config)),
       task_counter_(config.worker_threads),
-      config_(std::move(config)),
+      config_(ResolveCpuAffinity(std::move(config))),
       pools_(std::move(pools)) {
     utils::impl::FinishStaticRegistration();
     try {
@@ -284,6 +359,20 @@ void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
             break;
     }
 
+    // Must go before any per-thread allocations to make them node local.
+    // The settings are validated in the constructor, so this may fail only if
+    // e.g. the cpuset of the process changed since then.
+    try {
+        if (!config_.cpu_affinity.empty()) {
+            utils::SetCurrentThreadCpuAffinity(config_.cpu_affinity);
+        }
+        if (config_.numa_node) {
+            utils::SetCurrentThreadPreferredNumaNode(*config_.numa_node);
+        }
+    } catch (const std::exception& e) {
+        LOG_ERROR() << "Failed to bind a worker thread of task processor '" << Name() << "': " << e;
+    }
+
     std::visit([index](auto& obj) { obj.PrepareWorker(index); }, task_queue_);
 
     pools_->GetCoroPool().PrepareLocalCache();
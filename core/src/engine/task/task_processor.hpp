@@ -61,6 +61,8 @@ public:
 
     std::size_t GetWorkerCount() const { return workers_.size(); }
 
+    std::optional<std::size_t> GetNumaNode() const { return config_.numa_node; }
+
     void SetSettings(const TaskProcessorSettings& settings);
 
     std::chrono::microseconds GetProfilerThreshold() const;
@@ -63,6 +63,8 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value, formats::parse::
     config.os_scheduling = value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
     config.spinning_iterations = value["spinning-iterations"].As<int>(config.spinning_iterations);
     config.task_processor_queue = value["task-processor-queue"].As<TaskQueueType>(config.task_processor_queue);
+    config.cpu_affinity = value["cpu-affinity"].As<std::vector<std::size_t>>({});
+    config.numa_node = value["numa-node"].As<std::optional<std::size_t>>();
 
     const auto task_trace = value["task-trace"];
     if (!task_trace.IsMissing()) {
@@ -3,7 +3,9 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include <userver/formats/json_fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
@@ -34,6 +36,14 @@ struct TaskProcessorConfig {
     int spinning_iterations{1000};
     TaskQueueType task_processor_queue{TaskQueueType::kGlobalTaskQueue};
 
+    /// CPUs to pin the worker threads to, empty means no pinning
+    std::vector<std::size_t> cpu_affinity;
+    /// NUMA node to allocate the memory of worker threads from. If
+    /// cpu_affinity is empty, the workers are pinned to the allowed CPUs of
+    /// the node. Coroutine stacks are shared by all the task processors and
+    /// are not node local.
+    std::optional<std::size_t> numa_node;
+
     std::size_t task_trace_every{1000};
     std::size_t task_trace_max_csw{0};
     std::string task_trace_logger_name;
@@ -34,7 +34,6 @@ void FutexWake(std::atomic<std::int32_t>* value, int count) {
 
 namespace {
 constexpr std::size_t kDefaultStealSpins = 10000;
-constexpr std::size_t kDefaultStealSize = 7;
 // frequency of visits to the global
 // queue to guarantee progress
 constexpr std::size_t kFrequencyGlobalQueuePop = 61;
@@ -57,6 +56,19 @@ void Consumer::Push(impl::TaskContext* ctx) {
         owner_.background_queue_.Push(background_queue_token_, ctx);
         return;
     }
+
+    // nullptr is a stop signal and goes straight to the local queue
+    if (ctx && ctx != running_task_) {
+        ctx = lifo_slot_.exchange(ctx);
+        if (!ctx) {
+            return;
+        }
+    }
+
+    PushLocal(ctx);
+}
+
+void Consumer::PushLocal(impl::TaskContext* ctx) {
     const std::size_t surplus_queue_size = local_queue_surplus_.GetSize();
     if (surplus_queue_size) {
         if (!local_queue_surplus_.TryPush(ctx)) {
@@ -71,10 +83,15 @@ void Consumer::Push(impl::TaskContext* ctx) {
     }
 }
 
-impl::TaskContext* Consumer::PopBlocking() { return DoPop(); }
+impl::TaskContext* Consumer::PopBlocking() {
+    impl::TaskContext* context = DoPop();
+    running_task_ = context;
+    return context;
+}
 
 std::size_t Consumer::GetLocalQueueSize() const noexcept {
-    return local_queue_.GetSize() + local_queue_surplus_.GetSize();
+    const std::size_t lifo_slot_size = lifo_slot_.load(std::memory_order_relaxed) ? 1 : 0;
+    return local_queue_.GetSize() + local_queue_surplus_.GetSize() + lifo_slot_size;
 }
 
 WorkStealingTaskQueue* Consumer::GetOwner() const noexcept { return &owner_; }
@@ -137,7 +154,10 @@ Consumer::StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std:
     if (stealed_size > 0) {
         impl::TaskContext* context = steal_buffer_[0];
         if (stealed_size > 1) {
-            local_queue_.PushBulk(utils::span(steal_buffer_.data() + 1, stealed_size - 1));
+            // Local queue is empty while stealing, so the batch always fits
+            [[maybe_unused]] const std::size_t pushed_size =
+                local_queue_.PushBulk(utils::span(steal_buffer_.data() + 1, stealed_size - 1));
+            UASSERT(pushed_size == stealed_size - 1);
         }
         return context;
     }
@@ -156,12 +176,25 @@ std::size_t Consumer::Steal(utils::span<impl::TaskContext*> buffer) {
     }
 
     can_be_stealed_count = local_queue_surplus_.GetSize();
-    return (
-        can_be_stealed_count ? local_queue_surplus_.TryPopBulk(
-                                   utils::span(buffer.data(), std::min(buffer.size(), (can_be_stealed_count + 1) / 2))
-                               )
-                             : 0
-    );
+    if (can_be_stealed_count) {
+        const size_t stealed_count = local_queue_surplus_.TryPopBulk(
+            utils::span(buffer.data(), std::min(buffer.size(), (can_be_stealed_count + 1) / 2))
+        );
+        if (stealed_count) {
+            return stealed_count;
+        }
+    }
+
+    // The victim is probably busy with a long task, do not let the LIFO slot
+    // task wait for it
+    if (!buffer.empty() && lifo_slot_.load(std::memory_order_relaxed)) {
+        impl::TaskContext* context = lifo_slot_.exchange(nullptr);
+        if (context) {
+            buffer[0] = context;
+            return 1;
+        }
+    }
+    return 0;
 }
 
 impl::TaskContext* Consumer::TryPopFromOwnerQueue(const bool is_global) {
@@ -206,12 +239,13 @@ impl::TaskContext* Consumer::TryPop() {
     }
 
     if (consumers_manager_.AllowStealing()) {
-        context = StealFromAnotherConsumerOrGlobalQueue(steal_attempts_count_, kDefaultStealSize);
+        // Steal in batches of up to a half of the victim's local queue
+        context = StealFromAnotherConsumerOrGlobalQueue(steal_attempts_count_, kConsumerStealBufferSize);
         bool last = consumers_manager_.StopStealing();
 
         // there are potentially other tasks that require a consumer
         if (last && context) {
-            consumers_manager_.WakeUpOne();
+            consumers_manager_.WakeUpOne(inner_index_);
         }
         if (context) {
             return context;
@@ -258,18 +292,40 @@ impl::TaskContext* Consumer::TryPopLocal() {
     return context;
 }
 
+impl::TaskContext* Consumer::TryPopLifoSlot() {
+    if (!lifo_slot_.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    return lifo_slot_.exchange(nullptr);
+}
+
 impl::TaskContext* Consumer::DoPop() {
     ++steps_count_;
     impl::TaskContext* context = ProbabilisticPopFromOwnerQueues();
     if (context) {
+        lifo_slot_pops_in_row_ = 0;
         return context;
     }
 
+    if (lifo_slot_pops_in_row_ < kMaxLifoSlotPopsInRow) {
+        context = TryPopLifoSlot();
+        if (context) {
+            ++lifo_slot_pops_in_row_;
+            return context;
+        }
+    }
+    lifo_slot_pops_in_row_ = 0;
+
     context = TryPopLocal();
     if (context) {
         return context;
     }
 
+    context = TryPopLifoSlot();
+    if (context) {
+        return context;
+    }
+
     while (!IsStopped()) {
         context = TryPop();
         if (context) {
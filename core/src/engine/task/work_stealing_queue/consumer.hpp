@@ -39,6 +39,8 @@ private:
 
     bool IsStopped() const noexcept;
 
+    void PushLocal(impl::TaskContext* ctx);
+
     void EmptySurplusQueue(impl::TaskContext* extra);
 
     impl::TaskContext* StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std::size_t to_steal);
@@ -55,6 +57,8 @@ private:
 
     impl::TaskContext* TryPopLocal();
 
+    impl::TaskContext* TryPopLifoSlot();
+
     impl::TaskContext* DoPop();
 
     void Sleep(const std::int32_t old_sleep_counter);
@@ -66,9 +70,21 @@ private:
     static constexpr std::size_t kLocalQueueSize = 1024;
     // Equal to half the queue size
     static constexpr std::size_t kConsumerStealBufferSize = 512;
+    // Limits the LIFO slot usage so that a pair of tasks waking each other
+    // could not starve the rest of the local queue
+    static constexpr std::size_t kMaxLifoSlotPopsInRow = 3;
 
     LocalQueue<impl::TaskContext, kLocalQueueSize> local_queue_{};
     LocalQueue<impl::TaskContext, kConsumerStealBufferSize> local_queue_surplus_{};
+    // The task pushed last by this consumer, it is popped before the local
+    // queue to run a just woken task on the same hot cache. Other consumers
+    // steal from it only when the local queues are empty.
+    std::atomic<impl::TaskContext*> lifo_slot_{nullptr};
+    std::size_t lifo_slot_pops_in_row_{0};
+    // The task popped last, i.e. currently run by this consumer. If it
+    // reschedules itself (e.g. engine::Yield), it goes to the local queue
+    // behind the other tasks instead of the LIFO slot.
+    const impl::TaskContext* running_task_{nullptr};
     WorkStealingTaskQueue& owner_;
     ConsumersManager& consumers_manager_;
     const std::size_t steal_attempts_count_;
@@ -1,6 +1,7 @@
 #include <engine/task/work_stealing_queue/consumers_manager.hpp>
 
 #include <mutex>
+#include <utility>
 
 #include <userver/utils/assert.hpp>
 
@@ -11,35 +12,34 @@ USERVER_NAMESPACE_BEGIN
 namespace engine {
 
 ConsumersManager::ConsumersManager(std::size_t consumers_count)
-    : consumers_count_(consumers_count), is_sleeping_(consumers_count, false) {}
+    : consumers_count_(consumers_count), sleeping_(consumers_count, nullptr) {}
 
-void ConsumersManager::NotifyNewTask() {
+void ConsumersManager::NotifyNewTask(std::optional<std::size_t> producer_index) {
     ConsumersState::State curr_state = state_.Get();
     UASSERT(curr_state.sleeping_count <= consumers_count_);
     UASSERT(curr_state.stealing_count <= consumers_count_);
     UASSERT(curr_state.stealing_count + curr_state.sleeping_count <= consumers_count_);
     if (curr_state.sleeping_count > 0 && curr_state.stealing_count == 0) {
-        WakeUpOne();
+        WakeUpOne(producer_index);
     }
 }
 
 void ConsumersManager::NotifyWakeUp(Consumer* const consumer) {
     std::lock_guard lock_(mutex_);
-    if (!is_sleeping_[consumer->inner_index_]) {
+    if (!sleeping_[consumer->inner_index_]) {
         return;
     }
-    is_sleeping_[consumer->inner_index_] = false;
+    sleeping_[consumer->inner_index_] = nullptr;
     state_.DecrementSleepingCount();
 }
 
 void ConsumersManager::NotifySleep(Consumer* const consumer) {
     std::lock_guard lock_(mutex_);
 
-    if (is_sleeping_[consumer->inner_index_]) {
+    if (sleeping_[consumer->inner_index_]) {
         return;
     }
-    is_sleeping_[consumer->inner_index_] = true;
-    sleep_dq_.push_back(consumer);
+    sleeping_[consumer->inner_index_] = consumer;
     state_.IncrementSleepingCount();
 }
 
@@ -61,16 +61,18 @@ bool ConsumersManager::StopStealing() noexcept {
     return old_state.stealing_count == 1;
 }
 
-void ConsumersManager::WakeUpOne() {
+void ConsumersManager::WakeUpOne(std::optional<std::size_t> producer_index) {
     Consumer* consumer = nullptr;
     {
         std::lock_guard lock_(mutex_);
-        while (!sleep_dq_.empty()) {
-            Consumer* candidate = sleep_dq_.front();
-            sleep_dq_.pop_front();
-            if (is_sleeping_[candidate->inner_index_]) {
-                is_sleeping_[candidate->inner_index_] = false;
-                consumer = candidate;
+        // Pushes from outside of the task processor have no locality, spread
+        // them over the consumers
+        const std::size_t start = producer_index.value_or(next_wakeup_index_++ % consumers_count_);
+        UASSERT(start < consumers_count_);
+        for (std::size_t i = 0; i < consumers_count_; ++i) {
+            const std::size_t index = GetNeighbourIndex(start, i, consumers_count_);
+            if (sleeping_[index]) {
+                consumer = std::exchange(sleeping_[index], nullptr);
                 break;
             }
         }
@@ -81,6 +83,14 @@ void ConsumersManager::WakeUpOne() {
     }
 }
 
+std::size_t
+ConsumersManager::GetNeighbourIndex(std::size_t start, std::size_t step, std::size_t consumers_count) noexcept {
+    UASSERT(start < consumers_count);
+    const std::size_t distance = (step + 1) / 2;
+    return (step % 2 == 1) ? (start + distance) % consumers_count
+                           : (start + consumers_count - distance) % consumers_count;
+}
+
 void ConsumersManager::Stop() noexcept {
     stopped_.store(true);
     WakeUpAll();
@@ -93,12 +103,9 @@ void ConsumersManager::WakeUpAll() {
     consumers.reserve(consumers_count_);
     {
         std::lock_guard lock_(mutex_);
-        while (!sleep_dq_.empty()) {
-            Consumer* consumer = sleep_dq_.front();
-            sleep_dq_.pop_front();
-            if (is_sleeping_[consumer->inner_index_]) {
-                is_sleeping_[consumer->inner_index_] = false;
-                consumers.push_back(consumer);
+        for (auto& consumer : sleeping_) {
+            if (consumer) {
+                consumers.push_back(std::exchange(consumer, nullptr));
             }
         }
     }
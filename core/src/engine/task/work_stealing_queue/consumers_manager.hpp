@@ -2,8 +2,8 @@
 
 #include <atomic>
 #include <cstddef>
-#include <deque>
 #include <mutex>
+#include <optional>
 #include <vector>
 
 #include <engine/task/work_stealing_queue/consumers_state.hpp>
@@ -18,7 +18,8 @@ class ConsumersManager final {
 public:
     explicit ConsumersManager(std::size_t consumers_count);
 
-    void NotifyNewTask();
+    // `producer_index` is the index of the pushing consumer, if any
+    void NotifyNewTask(std::optional<std::size_t> producer_index);
 
     void NotifyWakeUp(Consumer* const consumer);
 
@@ -28,7 +29,9 @@ public:
 
     bool StopStealing() noexcept;
 
-    void WakeUpOne();
+    // Prefers the consumers with indices next to `producer_index`: with pinned
+    // worker threads they are likely to share caches with the producer
+    void WakeUpOne(std::optional<std::size_t> producer_index);
 
     void Stop() noexcept;
 
@@ -36,6 +39,10 @@ public:
 
     std::size_t GetConsumersCount() const noexcept { return consumers_count_; }
 
+    // The `step`-th consumer to visit in WakeUpOne, in the order of
+    // start, start + 1, start - 1, start + 2, start - 2, ...
+    static std::size_t GetNeighbourIndex(std::size_t start, std::size_t step, std::size_t consumers_count) noexcept;
+
 private:
     void WakeUpAll();
 
@@ -43,8 +50,9 @@ private:
     std::mutex mutex_;
     ConsumersState state_{};
     std::atomic<bool> stopped_{false};
-    std::deque<Consumer*> sleep_dq_{};
-    std::vector<bool> is_sleeping_{};
+    // Indexed by Consumer::inner_index_, nullptr for the awake consumers
+    std::vector<Consumer*> sleeping_{};
+    std::size_t next_wakeup_index_{0};
 };
 
 }  // namespace engine
@@ -61,18 +61,21 @@ void WorkStealingTaskQueue::PrepareWorker(std::size_t index) {
 }
 
 void WorkStealingTaskQueue::DoPush(impl::TaskContext* context) {
-    {
-        Consumer* consumer = GetConsumer();
-
-        if (consumer != nullptr && consumer->GetOwner() == this) {
-            consumer->Push(context);
-        } else if (context && context->IsBackground()) {
-            background_queue_.Push(context);
-        } else {
-            global_queue_.Push(context);
-        }
+    Consumer* consumer = GetConsumer();
+    if (consumer != nullptr && consumer->GetOwner() == this) {
+        consumer->Push(context);
+        // Even a task in the LIFO slot must be stolen by someone if the
+        // current task runs for long
+        consumers_manager_.NotifyNewTask(consumer->inner_index_);
+        return;
+    }
+
+    if (context && context->IsBackground()) {
+        background_queue_.Push(context);
+    } else {
+        global_queue_.Push(context);
     }
-    consumers_manager_.NotifyNewTask();
+    consumers_manager_.NotifyNewTask(std::nullopt);
 }
 
 impl::TaskContext* WorkStealingTaskQueue::DoPopBlocking() {
@@ -0,0 +1,104 @@
+#include <engine/task/work_stealing_queue/task_queue.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <engine/task/work_stealing_queue/consumers_manager.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::unique_ptr<engine::TaskProcessor> MakeWorkStealingTaskProcessor(std::size_t worker_threads) {
+    engine::TaskProcessorConfig proc_config;
+    proc_config.name = "work-stealing";
+    proc_config.thread_name = "work-stealing";
+    proc_config.worker_threads = worker_threads;
+    proc_config.task_processor_queue = engine::TaskQueueType::kWorkStealingTaskQueue;
+    return std::make_unique<engine::TaskProcessor>(
+        std::move(proc_config), engine::current_task::GetTaskProcessor().GetTaskProcessorPools()
+    );
+}
+
+}  // namespace
+
+UTEST(WorkStealingTaskQueue, LifoSlotHandOff) {
+    auto task_processor = MakeWorkStealingTaskProcessor(1);
+
+    // The only worker runs the tasks one by one, no synchronization is needed
+    std::vector<int> order;
+    engine::AsyncNoSpan(*task_processor, [&order] {
+        std::vector<engine::TaskWithResult<void>> tasks;
+        for (int i = 0; i < 3; ++i) {
+            tasks.push_back(engine::AsyncNoSpan([&order, i] { order.push_back(i); }));
+        }
+        engine::WaitAllChecked(tasks);
+    }).Get();
+
+    // The task pushed last waits in the LIFO slot and runs first, the ones
+    // it has displaced go to the local queue in FIFO order
+    EXPECT_EQ(order, (std::vector<int>{2, 0, 1}));
+}
+
+UTEST(WorkStealingTaskQueue, StealFromLifoSlot) {
+    auto task_processor = MakeWorkStealingTaskProcessor(2);
+
+    engine::AsyncNoSpan(*task_processor, [] {
+        const auto owner_thread = std::this_thread::get_id();
+        std::thread::id thief_thread;
+        std::atomic<bool> stolen{false};
+
+        auto task = engine::AsyncNoSpan([&] {
+            thief_thread = std::this_thread::get_id();
+            stolen = true;
+        });
+
+        // The owner is busy and never gets to its LIFO slot, the task runs
+        // only if the other consumer steals it
+        const auto deadline = std::chrono::steady_clock::now() + utest::kMaxTestWaitTime;
+        while (!stolen && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+
+        EXPECT_TRUE(stolen);
+        task.Wait();
+        EXPECT_NE(thief_thread, owner_thread);
+    }).Get();
+}
+
+TEST(WorkStealingTaskQueue, NeighbourWakeUpOrder) {
+    const auto get_order = [](std::size_t start, std::size_t consumers_count) {
+        std::vector<std::size_t> order;
+        for (std::size_t step = 0; step < consumers_count; ++step) {
+            order.push_back(engine::ConsumersManager::GetNeighbourIndex(start, step, consumers_count));
+        }
+        return order;
+    };
+
+    EXPECT_EQ(get_order(3, 5), (std::vector<std::size_t>{3, 4, 2, 0, 1}));
+    EXPECT_EQ(get_order(0, 4), (std::vector<std::size_t>{0, 1, 3, 2}));
+    EXPECT_EQ(get_order(0, 1), (std::vector<std::size_t>{0}));
+
+    // Every consumer is visited exactly once
+    for (std::size_t consumers_count = 1; consumers_count <= 16; ++consumers_count) {
+        for (std::size_t start = 0; start < consumers_count; ++start) {
+            auto order = get_order(start, consumers_count);
+            std::sort(order.begin(), order.end());
+            for (std::size_t i = 0; i < consumers_count; ++i) {
+                EXPECT_EQ(order[i], i) << "start=" << start << " consumers_count=" << consumers_count;
+            }
+        }
+    }
+}
+
+USERVER_NAMESPACE_END
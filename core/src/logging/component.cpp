@@ -79,6 +79,7 @@ void Logging::Init(const ComponentConfig& config, const ComponentContext& contex
         }
 
         auto logger = logging::impl::GetDefaultLoggerOrMakeTpLogger(logger_config);
+        logger->SetDeferredFormatting(logger_config.deferred_formatting);
 
         if (is_default_logger) {
             if (logger_config.queue_overflow_behavior == logging::QueueOverflowBehavior::kBlock) {
@@ -273,6 +274,7 @@ properties:
                       - tskv
                       - ltsv
                       - raw
+                      - json
                 flush_level:
                     type: string
                     description: messages of this and higher levels get flushed to the file immediately
@@ -288,6 +290,33 @@ properties:
                     enum:
                       - discard
                       - block
+                deferred_formatting:
+                    type: boolean
+                    description: |
+                        pass the log records to the logger task unformatted, the timestamp formatting and
+                        escaping are done by the logger task instead of the logging coroutines
+                    defaultDescription: false
+                file_batch_size:
+                    type: integer
+                    description: |
+                        if not 0, the log file is written in batches of this size in bytes with a single
+                        write per batch instead of the buffered writes per record
+                    defaultDescription: 0
+                    minimum: 0
+                fsync_policy:
+                    type: string
+                    description: |
+                        when the log file written in batches is synced to the disk: `none` leaves it to the OS,
+                        `periodic` syncs on flush at most once per `fsync_interval`, `every-flush` syncs on every flush
+                    defaultDescription: none
+                    enum:
+                      - none
+                      - periodic
+                      - every-flush
+                fsync_interval:
+                    type: string
+                    description: the minimal interval between syncs for the `periodic` fsync_policy
+                    defaultDescription: 1s
                 fs-task-processor:
                     type: string
                     description: task processor for disk I/O operations for this logger
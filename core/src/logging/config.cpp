@@ -15,6 +15,16 @@ QueueOverflowBehavior Parse(const yaml_config::YamlConfig& value, formats::parse
     return utils::ParseFromValueString(value, kMap);
 }
 
+FsyncPolicy Parse(const yaml_config::YamlConfig& value, formats::parse::To<FsyncPolicy>) {
+    static constexpr utils::TrivialBiMap kMap([](auto selector) {
+        return selector()
+            .Case(FsyncPolicy::kNone, "none")
+            .Case(FsyncPolicy::kPeriodic, "periodic")
+            .Case(FsyncPolicy::kEveryFlush, "every-flush");
+    });
+    return utils::ParseFromValueString(value, kMap);
+}
+
 Format Parse(const yaml_config::YamlConfig& value, formats::parse::To<Format>) {
     const auto format_str = value.As<std::string>("tskv");
     return FormatFromString(format_str);
@@ -44,6 +54,12 @@ LoggerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Logg
     config.queue_overflow_behavior =
         value["overflow_behavior"].As<QueueOverflowBehavior>(config.queue_overflow_behavior);
 
+    config.deferred_formatting = value["deferred_formatting"].As<bool>(config.deferred_formatting);
+
+    config.file_batch_size = value["file_batch_size"].As<std::size_t>(config.file_batch_size);
+    config.fsync_policy = value["fsync_policy"].As<FsyncPolicy>(config.fsync_policy);
+    config.fsync_interval = value["fsync_interval"].As<std::chrono::milliseconds>(config.fsync_interval);
+
     config.fs_task_processor = value["fs-task-processor"].As<std::optional<std::string>>();
 
     config.testsuite_capture = value["testsuite-capture"].As<std::optional<TestsuiteCaptureConfig>>();
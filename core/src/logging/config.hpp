@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <string>
 #include <unordered_map>
 
@@ -22,6 +23,16 @@ enum class QueueOverflowBehavior { kDiscard, kBlock };
 
 QueueOverflowBehavior Parse(const yaml_config::YamlConfig& value, formats::parse::To<QueueOverflowBehavior>);
 
+/// When the batched file sink calls fdatasync
+enum class FsyncPolicy {
+    kNone,
+    /// On flush, at most once per `fsync_interval`
+    kPeriodic,
+    kEveryFlush,
+};
+
+FsyncPolicy Parse(const yaml_config::YamlConfig& value, formats::parse::To<FsyncPolicy>);
+
 struct LoggerConfig final {
     static constexpr size_t kDefaultMessageQueueSize = 1 << 16;
 
@@ -37,6 +48,12 @@ struct LoggerConfig final {
     // must be a power of 2
     size_t message_queue_size = kDefaultMessageQueueSize;
     QueueOverflowBehavior queue_overflow_behavior = QueueOverflowBehavior::kDiscard;
+    bool deferred_formatting = false;
+
+    // The log file is written in batches of this size if it is not 0
+    std::size_t file_batch_size = 0;
+    FsyncPolicy fsync_policy = FsyncPolicy::kNone;
+    std::chrono::milliseconds fsync_interval{1000};
 
     std::optional<std::string> fs_task_processor;
 
@@ -0,0 +1,138 @@
+#include "batched_file_sink.hpp"
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <system_error>
+
+#include <userver/utils/assert.hpp>
+
+#include "open_file_helper.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+BatchedFileSink::BatchedFileSink(
+    const std::string& filename,
+    const BatchedFileSinkConfig& config,
+    FileBatchStatistics& stats
+)
+    : filename_{filename},
+      config_{config},
+      stats_{stats},
+      fd_(OpenFile<fs::blocking::FileDescriptor>(filename)),
+      last_sync_(std::chrono::steady_clock::now()) {
+    UINVARIANT(config_.batch_size != 0, "Batch size of BatchedFileSink must not be 0");
+    buffer_.reserve(config_.batch_size);
+    if (fd_.GetSize() > 0) {
+        buffer_.push_back('\n');
+    }
+}
+
+BatchedFileSink::~BatchedFileSink() {
+    try {
+        if (fd_.IsOpen()) {
+            WriteBatch(buffer_, {});
+        }
+    } catch (const std::exception& e) {
+        UASSERT_MSG(false, std::string{"Failed to write the last batch of logs: "} + e.what());
+    }
+}
+
+void BatchedFileSink::Write(std::string_view log) {
+    if (buffer_.size() + log.size() <= config_.batch_size) {
+        buffer_.append(log);
+        return;
+    }
+
+    // The record that does not fit is written together with the batch, so
+    // large records are never copied
+    WriteBatch(buffer_, log);
+    buffer_.clear();
+}
+
+void BatchedFileSink::Flush() {
+    if (!fd_.IsOpen()) {
+        return;
+    }
+
+    WriteBatch(buffer_, {});
+    buffer_.clear();
+
+    switch (config_.fsync_policy) {
+        case FsyncPolicy::kNone:
+            break;
+        case FsyncPolicy::kPeriodic:
+            if (std::chrono::steady_clock::now() - last_sync_ >= config_.fsync_interval) {
+                Sync();
+            }
+            break;
+        case FsyncPolicy::kEveryFlush:
+            Sync();
+            break;
+    }
+}
+
+void BatchedFileSink::Reopen(ReopenMode mode) {
+    // The old file is kept on a failed reopen, so the sink always has a file to write to
+    auto new_fd = OpenFile<fs::blocking::FileDescriptor>(filename_, mode);
+    WriteBatch(buffer_, {});
+    buffer_.clear();
+    Sync();
+    std::move(fd_).Close();
+    fd_ = std::move(new_fd);
+}
+
+void BatchedFileSink::WriteBatch(std::string_view batch, std::string_view last_record) {
+    const auto total_size = batch.size() + last_record.size();
+    if (total_size == 0) {
+        return;
+    }
+
+    std::array<::iovec, 2> iov{
+        ::iovec{const_cast<char*>(batch.data()), batch.size()},             // NOLINT
+        ::iovec{const_cast<char*>(last_record.data()), last_record.size()}  // NOLINT
+    };
+    auto* iov_begin = iov.data();
+    const auto* const iov_end = iov.data() + iov.size();
+
+    const auto start = std::chrono::steady_clock::now();
+    while (iov_begin != iov_end) {
+        const auto written = ::writev(fd_.GetNative(), iov_begin, static_cast<int>(iov_end - iov_begin));
+        if (written < 0) {
+            if (errno == EAGAIN || errno == EINTR) continue;
+            throw std::system_error(std::make_error_code(std::errc{errno}), "calling ::writev");
+        }
+
+        // Skip the written part after a short write
+        auto left = static_cast<std::size_t>(written);
+        while (iov_begin != iov_end && left >= iov_begin->iov_len) {
+            left -= iov_begin->iov_len;
+            ++iov_begin;
+        }
+        if (iov_begin != iov_end) {
+            iov_begin->iov_base = static_cast<char*>(iov_begin->iov_base) + left;
+            iov_begin->iov_len -= left;
+        }
+    }
+    const auto latency = std::chrono::steady_clock::now() - start;
+
+    ++stats_.writes;
+    stats_.write_latency_us.Account(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+    stats_.batch_size_bytes.Account(total_size);
+}
+
+void BatchedFileSink::Sync() {
+    if (::fdatasync(fd_.GetNative()) == -1) {
+        throw std::system_error(std::make_error_code(std::errc{errno}), "calling ::fdatasync");
+    }
+    last_sync_ = std::chrono::steady_clock::now();
+    ++stats_.fsyncs;
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
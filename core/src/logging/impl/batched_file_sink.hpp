@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <string_view>
+
+#include <logging/config.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/logging/impl/log_stats.hpp>
+
+#include "base_sink.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+struct BatchedFileSinkConfig final {
+    std::size_t batch_size{0};
+    FsyncPolicy fsync_policy{FsyncPolicy::kNone};
+    std::chrono::milliseconds fsync_interval{1000};
+};
+
+/// @brief File sink that accumulates the records and writes them with a single
+/// `writev` per batch.
+///
+/// A batch is written when the next record does not fit into `batch_size`, on
+/// Flush and on Reopen. fdatasync is done on Flush according to the
+/// FsyncPolicy, so a single sync commits all the batches since the last one.
+class BatchedFileSink final : public BaseSink {
+public:
+    BatchedFileSink(const std::string& filename, const BatchedFileSinkConfig& config, FileBatchStatistics& stats);
+    ~BatchedFileSink() override;
+
+    void Reopen(ReopenMode mode) override;
+
+    void Flush() override;
+
+protected:
+    void Write(std::string_view log) override;
+
+private:
+    void WriteBatch(std::string_view batch, std::string_view last_record);
+    void Sync();
+
+    const std::string filename_;
+    const BatchedFileSinkConfig config_;
+    FileBatchStatistics& stats_;
+    fs::blocking::FileDescriptor fd_;
+    std::string buffer_;
+    std::chrono::steady_clock::time_point last_sync_{};
+};
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <userver/fs/blocking/temp_directory.hpp>
 #include <userver/utils/rand.hpp>
 
+#include "batched_file_sink.hpp"
 #include "buffered_file_sink.hpp"
 #include "file_sink.hpp"
 
@@ -36,4 +37,47 @@ void check_buffered_file_sink(benchmark::State& state) {
 }
 BENCHMARK(check_buffered_file_sink);
 
+// The argument is the batch size
+void check_batched_file_sink(benchmark::State& state) {
+    const auto temp_root = fs::blocking::TempDirectory::Create();
+    const std::string filename = temp_root.GetPath() + "/temp_file_" + std::to_string(utils::Rand());
+    logging::impl::FileBatchStatistics stats;
+    const logging::impl::BatchedFileSinkConfig config{static_cast<std::size_t>(state.range(0))};
+    auto sink = logging::impl::BatchedFileSink(filename, config, stats);
+    for ([[maybe_unused]] auto _ : state) {
+        for (auto i = 0; i < kCountLogs; ++i) {
+            sink.Log({"message\n", logging::Level::kWarning});
+        }
+    }
+    sink.Flush();
+    state.counters["writes"] = stats.writes.Load().value;
+}
+BENCHMARK(check_batched_file_sink)->Arg(64 << 10)->Arg(1 << 20);
+
+// Access log sized records with a flush every `state.range(1)` records, the
+// way the flush task and the flush_level do it, with `state.range(2)` being
+// the FsyncPolicy
+void check_batched_file_sink_flushes(benchmark::State& state) {
+    const auto temp_root = fs::blocking::TempDirectory::Create();
+    const std::string filename = temp_root.GetPath() + "/temp_file_" + std::to_string(utils::Rand());
+    const std::string record(512, 'x');
+    logging::impl::FileBatchStatistics stats;
+    const logging::impl::BatchedFileSinkConfig config{
+        static_cast<std::size_t>(state.range(0)), static_cast<logging::FsyncPolicy>(state.range(2))};
+    auto sink = logging::impl::BatchedFileSink(filename, config, stats);
+    for ([[maybe_unused]] auto _ : state) {
+        for (auto i = 1; i <= kCountLogs; ++i) {
+            sink.Log({record, logging::Level::kInfo});
+            if (i % state.range(1) == 0) {
+                sink.Flush();
+            }
+        }
+    }
+    sink.Flush();
+    state.SetBytesProcessed(static_cast<std::int64_t>(record.size() * kCountLogs * state.iterations()));
+}
+BENCHMARK(check_batched_file_sink_flushes)
+    ->Args({1 << 20, 10000, static_cast<int>(logging::FsyncPolicy::kNone)})
+    ->Args({1 << 20, 10000, static_cast<int>(logging::FsyncPolicy::kEveryFlush)});
+
 USERVER_NAMESPACE_END
@@ -8,6 +8,7 @@
 #include <userver/utest/parameter_names.hpp>
 #include <userver/utest/utest.hpp>
 
+#include "batched_file_sink.hpp"
 #include "buffered_file_sink.hpp"
 #include "sink_helper_test.hpp"
 
@@ -28,6 +29,22 @@ SinkPtr MakeBufferedFileSink(const std::string& filename) {
     return std::make_unique<logging::impl::BufferedFileSink>(filename);
 }
 
+logging::impl::FileBatchStatistics& GetFileBatchStatistics() {
+    static logging::impl::FileBatchStatistics stats;
+    return stats;
+}
+
+SinkPtr MakeBatchedFileSink(const std::string& filename) {
+    const logging::impl::BatchedFileSinkConfig config{4096, logging::FsyncPolicy::kEveryFlush};
+    return std::make_unique<logging::impl::BatchedFileSink>(filename, config, GetFileBatchStatistics());
+}
+
+// Every record overflows the batch
+SinkPtr MakeSmallBatchedFileSink(const std::string& filename) {
+    const logging::impl::BatchedFileSinkConfig config{8, logging::FsyncPolicy::kPeriodic};
+    return std::make_unique<logging::impl::BatchedFileSink>(filename, config, GetFileBatchStatistics());
+}
+
 class FileSinks : public testing::TestWithParam<SinkFactory> {
 protected:
     const std::string& GetTempRootPath() const { return temp_root_.GetPath(); }
@@ -179,10 +196,43 @@ UTEST_P(FileSinks, TestValidWriteMultiInFile) {
     EXPECT_EQ(test::ReadFromFile(Filename()), test::Messages("message", "message 2", "message 3"));
 }
 
+UTEST(BatchedFileSink, WritesInBatches) {
+    const auto temp_root = fs::blocking::TempDirectory::Create();
+    const auto filename = temp_root.GetPath() + "/temp_file";
+    logging::impl::FileBatchStatistics stats;
+    logging::impl::BatchedFileSink sink{filename, {16, logging::FsyncPolicy::kNone}, stats};
+
+    sink.Log({"message\n", logging::Level::kInfo});
+    sink.Log({"message 2\n", logging::Level::kInfo});
+    // Nothing is written until the batch is full
+    EXPECT_EQ(test::ReadFromFile(filename), test::Messages());
+    EXPECT_EQ(stats.writes.Load().value, 0);
+
+    sink.Log({"a message that is longer than the batch\n", logging::Level::kInfo});
+    EXPECT_EQ(
+        test::ReadFromFile(filename), test::Messages("message", "message 2", "a message that is longer than the batch")
+    );
+    EXPECT_EQ(stats.writes.Load().value, 1);
+
+    sink.Log({"message 3\n", logging::Level::kInfo});
+    sink.Flush();
+    EXPECT_EQ(
+        test::ReadFromFile(filename),
+        test::Messages("message", "message 2", "a message that is longer than the batch", "message 3")
+    );
+    EXPECT_EQ(stats.writes.Load().value, 2);
+    EXPECT_EQ(stats.fsyncs.Load().value, 0);
+}
+
 INSTANTIATE_UTEST_SUITE_P(
     /* no prefix */,
     FileSinks,
-    testing::Values(SinkFactory{"FileSink", MakeFileSink}, SinkFactory{"BufferedFileSink", MakeBufferedFileSink}),
+    testing::Values(
+        SinkFactory{"FileSink", MakeFileSink},
+        SinkFactory{"BufferedFileSink", MakeBufferedFileSink},
+        SinkFactory{"BatchedFileSink", MakeBatchedFileSink},
+        SinkFactory{"SmallBatchedFileSink", MakeSmallBatchedFileSink}
+    ),
     utest::PrintTestName()
 );
 
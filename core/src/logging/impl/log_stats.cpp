@@ -6,6 +6,23 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace {
+
+constexpr double kWriteLatencyBoundsUs[] = {10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 50000};
+constexpr double kBatchSizeBoundsBytes[] = {4 << 10, 16 << 10, 64 << 10, 256 << 10, 1 << 20, 4 << 20};
+
+}  // namespace
+
+FileBatchStatistics::FileBatchStatistics()
+    : write_latency_us(kWriteLatencyBoundsUs), batch_size_bytes(kBatchSizeBoundsBytes) {}
+
+void DumpMetric(utils::statistics::Writer& writer, const FileBatchStatistics& stats) {
+    writer["writes"] = stats.writes;
+    writer["fsyncs"] = stats.fsyncs;
+    writer["write_latency_us"] = stats.write_latency_us;
+    writer["batch_size_bytes"] = stats.batch_size_bytes;
+}
+
 void DumpMetric(utils::statistics::Writer& writer, const impl::LogStatistics& stats) {
     writer["dropped"].ValueWithLabels(stats.dropped, {"version", "2"});
 
@@ -19,6 +36,9 @@ void DumpMetric(utils::statistics::Writer& writer, const impl::LogStatistics& st
 
     writer["total"] = total;
     writer["has_reopening_error"] = stats.has_reopening_error.load();
+    if (stats.file_batches) {
+        writer["file_batches"] = *stats.file_batches;
+    }
 }
 
 }  // namespace logging::impl
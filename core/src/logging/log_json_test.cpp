@@ -0,0 +1,80 @@
+#include <regex>
+
+#include <gtest/gtest.h>
+
+#include <logging/logging_test.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/logging/log_extra.hpp>
+#include <userver/logging/log_helper.hpp>
+#include <userver/utils/impl/source_location.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kTextToEscape =
+    "quote \" backslash \\ tab \t newline \n control \x01 utf-8 \xd1\x82\xd0\xb5\xd0\xba\xd1\x81\xd1\x82";
+
+}  // namespace
+
+TEST_F(LoggingJsonTest, Basic) {
+    constexpr auto kJsonTextToLog = "This is the JSON text to log";
+    LOG_INFO() << kJsonTextToLog;
+
+    EXPECT_EQ(LoggedText(), kJsonTextToLog);
+
+    const auto str = GetStreamString();
+    ASSERT_EQ(str.back(), '\n');
+    const auto record = formats::json::FromString(str);
+    EXPECT_EQ(record["level"].As<std::string>(), "INFO");
+    EXPECT_EQ(record["text"].As<std::string>(), kJsonTextToLog);
+    EXPECT_TRUE(record.HasMember("timestamp")) << str;
+    EXPECT_TRUE(record.HasMember("module")) << str;
+    EXPECT_TRUE(record.HasMember("thread_id")) << str;
+}
+
+TEST_F(LoggingJsonTest, Escaping) {
+    LOG_INFO() << kTextToEscape << logging::LogExtra{{"Some.Key", std::string{kTextToEscape}}, {"int", 42}};
+
+    const auto str = GetStreamString();
+    EXPECT_EQ(GetRecordsCount(), 1) << str;
+    const auto record = formats::json::FromString(str);
+    EXPECT_EQ(record["text"].As<std::string>(), kTextToEscape);
+    // The keys are escaped the same way as in TSKV
+    EXPECT_EQ(record["some_key"].As<std::string>(), kTextToEscape);
+    EXPECT_EQ(record["int"].As<std::string>(), "42");
+}
+
+TEST_F(LoggingJsonTest, ModuleEscaping) {
+    constexpr auto kLocation = utils::impl::SourceLocation::Custom(42, "dir\\file\".cpp", "operator\"\"_lit");
+    logging::LogHelper(GetStreamLogger(), logging::Level::kInfo, kLocation) << "text";
+
+    const auto str = GetStreamString();
+    EXPECT_EQ(GetRecordsCount(), 1) << str;
+    const auto record = formats::json::FromString(str);
+    EXPECT_EQ(record["text"].As<std::string>(), "text");
+    EXPECT_EQ(record["module"].As<std::string>(), "operator\"\"_lit ( dir\\file\".cpp:42 ) ");
+}
+
+TEST_F(LoggingJsonTest, DeferredFormatting) {
+    auto logger = GetStreamLogger();
+    const auto log = [&logger] {
+        LOG_INFO_TO(logger) << kTextToEscape << logging::LogExtra{{"Some.Key", "value\"with quote"}, {"int", 42}};
+    };
+
+    log();
+    logger->SetDeferredFormatting(true);
+    log();
+
+    // The timestamps may differ
+    const std::regex timestamp_regex{R"("timestamp":"[^"]*")"};
+    const auto records = std::regex_replace(GetStreamString(), timestamp_regex, R"("timestamp":"")");
+    const auto first_end = records.find('\n');
+    ASSERT_NE(first_end, std::string::npos);
+    EXPECT_EQ(records.substr(0, first_end + 1), records.substr(first_end + 1));
+    EXPECT_EQ(GetRecordsCount(), 2);
+}
+
+USERVER_NAMESPACE_END
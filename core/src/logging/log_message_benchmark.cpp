@@ -3,6 +3,7 @@
 #include <ostream>
 
 #include <userver/logging/impl/logger_base.hpp>
+#include <userver/logging/impl/structured_record.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/logger.hpp>
@@ -148,6 +149,39 @@ void LogPrependedTags(benchmark::State& state) {
 }
 BENCHMARK(LogPrependedTags);
 
+// A TSKV logger that gets either the formatted text or the unformatted
+// structured records, like the loggers with deferred formatting
+class TskvTagLogger final : public logging::impl::LoggerBase {
+public:
+    explicit TskvTagLogger(bool structured) noexcept : LoggerBase(logging::Format::kTskv) {
+        SetLevel(logging::Level::kInfo);
+        SetStructured(structured);
+    }
+
+    void Log(logging::Level, std::string_view msg) override { benchmark::DoNotOptimize(msg.data()); }
+
+    void LogStructured(logging::impl::StructuredRecord&& record) override {
+        benchmark::DoNotOptimize(record.entries.data());
+    }
+
+    void PrependCommonTags(logging::impl::TagWriter writer) const override {
+        writer.PutTag("trace_id", "0123456789abcdef0123456789abcdef");
+        writer.PutTag("span_id", "0123456789abcdef");
+        writer.PutTag("link", "fedcba9876543210fedcba9876543210");
+        writer.PutTag("request_id", 42);
+    }
+};
+
+void LogDeferredFormatting(benchmark::State& state) {
+    const logging::DefaultLoggerGuard guard{std::make_shared<TskvTagLogger>(state.range(1) != 0)};
+    const auto msg = Launder(std::string(state.range(0), '*') + "\twith\ttabs\n");
+
+    for ([[maybe_unused]] auto _ : state) {
+        LOG_INFO() << msg;
+    }
+}
+BENCHMARK(LogDeferredFormatting)->ArgNames({"size", "deferred"})->Ranges({{8, 8 << 10}, {0, 1}});
+
 }  // namespace
 
 USERVER_NAMESPACE_END
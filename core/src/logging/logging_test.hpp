@@ -49,7 +49,26 @@ inline StringStreamLogger MakeNamedStreamLogger(const std::string& logger_name,
 }
 
 inline std::string_view GetTextKey(logging::Format format) {
-    return format == logging::Format::kLtsv ? "text:" : "text=";
+    switch (format) {
+        case logging::Format::kLtsv:
+            return "text:";
+        case logging::Format::kJson:
+            return R"("text":")";
+        default:
+            return "text=";
+    }
+}
+
+// Returns the position of the quote that closes the escaped JSON string
+inline std::size_t FindJsonStringEnd(std::string_view escaped) {
+    for (std::size_t i = 0; i < escaped.size(); ++i) {
+        if (escaped[i] == '\\') {
+            ++i;
+        } else if (escaped[i] == '"') {
+            return i;
+        }
+    }
+    return std::string_view::npos;
 }
 
 inline std::string ParseLoggedText(std::string_view log_record, logging::Format format) {
@@ -65,7 +84,8 @@ inline std::string ParseLoggedText(std::string_view log_record, logging::Format
         throw std::runtime_error(fmt::format("The log contains multiple log records: {}", log_record));
     }
 
-    const auto text_end = log_record.find_first_of("\t\r\n");
+    const auto text_end =
+        format == logging::Format::kJson ? FindJsonStringEnd(log_record) : log_record.find_first_of("\t\r\n");
     if (text_end != std::string_view::npos) {
         log_record = log_record.substr(0, text_end);
     }
@@ -121,4 +141,9 @@ protected:
     LoggingLtsvTest() : LoggingTestBase(logging::Format::kLtsv) { SetDefaultLogger(GetStreamLogger()); }
 };
 
+class LoggingJsonTest : public LoggingTestBase {
+protected:
+    LoggingJsonTest() : LoggingTestBase(logging::Format::kJson) { SetDefaultLogger(GetStreamLogger()); }
+};
+
 USERVER_NAMESPACE_END
@@ -23,6 +23,12 @@ struct TpLogger::ActionVisitor final {
         logger.BackendLog(std::move(log));
     }
 
+    void operator()(impl::async::StructuredLog&& log) const {
+        logger.AccountLogConsumed();
+        const auto level = log.record.level;
+        logger.BackendLog(impl::async::Log{level, ToText(log.record, logger.GetFormat()), log.record.time});
+    }
+
     void operator()(impl::async::Stop&&) const noexcept {
         // The consumer thread will check state_ later.
     }
@@ -126,6 +132,18 @@ void TpLogger::Flush() {
 impl::LogStatistics& TpLogger::GetStatistics() noexcept { return stats_; }
 
 void TpLogger::Log(Level level, std::string_view msg) {
+    PushLog(level, [&] { return impl::async::Log{level, std::string{msg}}; });
+}
+
+void TpLogger::LogStructured(StructuredRecord&& record) {
+    const auto level = record.level;
+    PushLog(level, [&] { return impl::async::StructuredLog{std::move(record)}; });
+}
+
+void TpLogger::SetDeferredFormatting(bool deferred_formatting) noexcept { SetStructured(deferred_formatting); }
+
+template <typename MakeAction>
+void TpLogger::PushLog(Level level, MakeAction make_action) {
     ++stats_.by_level[static_cast<std::size_t>(level)];
 
     if (GetSinks().empty()) {
@@ -139,7 +157,7 @@ void TpLogger::Log(Level level, std::string_view msg) {
         produced_->fetch_add(1);
 
         try {
-            Push(impl::async::Log{level, std::string{msg}});
+            Push(make_action());
         } catch (const std::exception&) {
             // failed to construct a Log action or a node in Push
             produced_->fetch_sub(1);
@@ -15,6 +15,7 @@
 #include <userver/engine/task/task.hpp>
 #include <userver/logging/format.hpp>
 #include <userver/logging/impl/logger_base.hpp>
+#include <userver/logging/impl/structured_record.hpp>
 
 #include <concurrent/impl/interference_shield.hpp>
 #include <engine/impl/async_flat_combining_queue.hpp>
@@ -38,6 +39,11 @@ struct Log {
     std::chrono::system_clock::time_point time{std::chrono::system_clock::now()};
 };
 
+// Formatted on the consumer task
+struct StructuredLog {
+    StructuredRecord record;
+};
+
 struct FlushCoro {
     engine::Promise<void> promise;
 };
@@ -53,7 +59,7 @@ struct ReopenCoro {
 
 struct Stop {};
 
-using Action = std::variant<Stop, Log, FlushCoro, FlushThreaded, ReopenCoro>;
+using Action = std::variant<Stop, Log, StructuredLog, FlushCoro, FlushThreaded, ReopenCoro>;
 
 struct ActionNode final : public concurrent::impl::SinglyLinkedBaseHook {
     Action action{Stop{}};
@@ -75,7 +81,12 @@ public:
 
     void StopConsumerTask();
 
+    /// The records are formatted by the consumer task instead of the logging
+    /// coroutines
+    void SetDeferredFormatting(bool deferred_formatting) noexcept;
+
     void Log(Level level, std::string_view msg) override;
+    void LogStructured(StructuredRecord&& record) override;
     void Flush() override;
     void PrependCommonTags(TagWriter writer) const override;
 
@@ -105,6 +116,8 @@ private:
     void ProcessingLoop();
     bool HasFreeQueueCapacity() noexcept;
     bool TryWaitFreeQueueCapacity();
+    template <typename MakeAction>
+    void PushLog(Level level, MakeAction make_action);
     void Push(impl::async::Action&& action);
     void DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
     void ConsumeNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
@@ -38,6 +38,8 @@ protected:
         return utils::FastScopeGuard([this]() noexcept { tp_logger_->StopConsumerTask(); });
     }
 
+    void SetDeferredFormatting(bool deferred_formatting) { tp_logger_->SetDeferredFormatting(deferred_formatting); }
+
 private:
     std::shared_ptr<logging::impl::TpLogger> tp_logger_;
     std::optional<logging::DefaultLoggerGuard> guard_;
@@ -47,6 +49,7 @@ private:
 
 BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogString)(benchmark::State& state) {
     engine::RunStandalone(2, [&] {
+        SetDeferredFormatting(state.range(1) != 0);
         auto scope = StartAsyncLoggerScope();
         const auto msg = Launder(std::string(state.range(0), '*'));
         for ([[maybe_unused]] auto _ : state) {
@@ -55,8 +58,13 @@ BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogString)(benchmark::State& state) {
         state.SetComplexityN(state.range(0));
     });
 }
-// Run benchmarks to output string of sizes of 8 bytes to 8 kilobytes
-BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogString)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+// Run benchmarks to output string of sizes of 8 bytes to 8 kilobytes, formatted
+// by the logging coroutine or deferred to the consumer task
+BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogString)
+    ->ArgNames({"size", "deferred"})
+    ->RangeMultiplier(2)
+    ->Ranges({{8, 8 << 10}, {0, 1}})
+    ->Complexity();
 
 namespace {
 
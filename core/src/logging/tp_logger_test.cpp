@@ -1,5 +1,7 @@
 #include <logging/tp_logger.hpp>
 
+#include <regex>
+
 #include <gmock/gmock.h>
 
 #include <userver/engine/async.hpp>
@@ -184,6 +186,27 @@ TEST_F(LoggingTest, TpLoggerBasicRecursive) {
     EXPECT_EQ(GetRecordsCount(), kLoggingRecursionDepth);
 }
 
+TEST_F(LoggingTest, TpLoggerDeferredFormatting) {
+    auto logger = GetStreamLogger();
+    const auto log = [&logger] {
+        LOG_INFO_TO(logger) << "Text with\ttab, \\ and\nnewline " << 42 << ' ' << 4.2
+                            << logging::LogExtra{{"Some.Key", "value\twith tab"}, {"int", 42}};
+    };
+
+    log();
+    logger->SetDeferredFormatting(true);
+    EXPECT_TRUE(logger->IsStructured());
+    log();
+
+    // The timestamps may differ
+    const std::regex timestamp_regex{"timestamp=[^\t]*"};
+    const auto records = std::regex_replace(GetStreamString(), timestamp_regex, "timestamp=");
+    const auto first_end = records.find('\n');
+    ASSERT_NE(first_end, std::string::npos);
+    EXPECT_EQ(records.substr(0, first_end + 1), records.substr(first_end + 1));
+    EXPECT_EQ(GetRecordsCount(), 2);
+}
+
 TEST_F(LoggingTest, TpLoggerBasicMT) {
     ASSERT_FALSE(engine::current_task::IsTaskProcessorThread())
         << "Misconfigured test. Should not be run in coroutine environment";
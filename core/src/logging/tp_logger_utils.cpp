@@ -8,6 +8,7 @@
 #include <boost/filesystem/operations.hpp>
 #include <boost/range/algorithm/find_if.hpp>
 
+#include <logging/impl/batched_file_sink.hpp>
 #include <logging/impl/buffered_file_sink.hpp>
 #include <logging/impl/tcp_socket_sink.hpp>
 #include <logging/impl/unix_socket_sink.hpp>
@@ -36,16 +37,23 @@ void CreateLogDirectory(const std::string& logger_name, const std::string& file_
     }
 }
 
-SinkPtr GetSinkFromFilename(const std::string& file_path) {
+SinkPtr GetSinkFromFilename(const LoggerConfig& config, LogStatistics& stats) {
+    const auto& file_path = config.file_path;
     if (utils::text::StartsWith(file_path, kUnixSocketPrefix)) {
         // Use Unix-socket sink
         return std::make_unique<UnixSocketSink>(file_path.substr(kUnixSocketPrefix.size()));
+    } else if (config.file_batch_size != 0) {
+        if (!stats.file_batches) {
+            stats.file_batches = std::make_unique<FileBatchStatistics>();
+        }
+        const BatchedFileSinkConfig sink_config{config.file_batch_size, config.fsync_policy, config.fsync_interval};
+        return std::make_unique<BatchedFileSink>(file_path, sink_config, *stats.file_batches);
     } else {
         return std::make_unique<BufferedFileSink>(file_path);
     }
 }
 
-SinkPtr MakeOptionalSink(const LoggerConfig& config) {
+SinkPtr MakeOptionalSink(const LoggerConfig& config, LogStatistics& stats) {
     if (config.file_path == "@null") {
         return nullptr;
     } else if (config.file_path == "@stderr") {
@@ -54,7 +62,7 @@ SinkPtr MakeOptionalSink(const LoggerConfig& config) {
         return std::make_unique<logging::impl::BufferedUnownedFileSink>(stdout);
     } else {
         CreateLogDirectory(config.logger_name, config.file_path);
-        return GetSinkFromFilename(config.file_path);
+        return GetSinkFromFilename(config, stats);
     }
 }
 
@@ -70,7 +78,7 @@ std::shared_ptr<TpLogger> MakeTpLogger(const LoggerConfig& config) {
     logger->SetLevel(config.level);
     logger->SetFlushOn(config.flush_level);
 
-    if (auto basic_sink = MakeOptionalSink(config)) {
+    if (auto basic_sink = MakeOptionalSink(config, logger->GetStatistics())) {
         logger->AddSink(std::move(basic_sink));
     }
 
@@ -193,6 +193,12 @@ properties:
                         enum:
                           - 1.1
                           - 2
+                    http1-fast-parser:
+                        type: boolean
+                        description: |
+                            parse the complete HTTP/1.x requests with a vectorized parser, the partial and uncommon
+                            requests are still parsed by llhttp
+                        defaultDescription: false
                     http2-session:
                         type: object
                         description: settings of the HTTP/2.0 session
@@ -209,10 +215,46 @@ properties:
                             initial_window_size:
                                 type: integer
                                 description: the initial window size of the server
+                                maximum: 2147483647
+                                defaultDescription: 65536
+                            connection_window_size:
+                                type: integer
+                                description: the initial receive window size of the whole connection
+                                maximum: 2147483647
                                 defaultDescription: 65536
+                            window_auto_tuning:
+                                type: boolean
+                                description: |
+                                    grow the connection receive window up to the estimated bandwidth-delay product,
+                                    the estimate is measured with PING frames
+                                defaultDescription: false
+                            max_connection_window_size:
+                                type: integer
+                                description: max size of the connection receive window for window_auto_tuning
+                                maximum: 2147483647
+                                defaultDescription: 16777216
+                            rfc9218_priorities:
+                                type: boolean
+                                description: |
+                                    schedule the streams by the RFC 9218 priorities (the `priority` header and
+                                    PRIORITY_UPDATE frames) instead of the deprecated RFC 7540 ones
+                                defaultDescription: false
             shards:
                 type: integer
                 description: how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing
+            reuseport-steering:
+                type: string
+                description: |
+                    how the kernel distributes new connections between the shards, each shard has its own SO_REUSEPORT socket.
+                    `hash` - by the hash of the connection addresses;
+                    `cpu` - by the CPU that received the connection, so that a shard gets the connections of the same
+                    CPUs; makes sense with the NIC queues (RSS) bound to the CPUs. This is not CPU affinity: the
+                    shards are not pinned to the CPUs and are run by any thread of the task processor. Linux only,
+                    other platforms fail on startup.
+                defaultDescription: hash
+                enum:
+                  - hash
+                  - cpu
     listener-monitor:
         type: object
         description: describes the special monitoring socket, used for getting statistics and processing utility requests that should succeed even is the main socket is under heavy pressure
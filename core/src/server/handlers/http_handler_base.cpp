@@ -204,7 +204,12 @@ void HttpHandlerBase::HandleRequestStream(const http::HttpRequest& http_request,
     const utils::ScopeGuard scope([&response] { response.SetHeadersEnd(); });
 
     auto& http_response = http_request.GetHttpResponse();
-    server::http::ResponseBodyStream response_body_stream{response.GetBodyProducer(), http_response};
+    std::unique_ptr<http::impl::BodyStreamCompressor> compressor;
+    if (const auto& compression = context.GetInternalContext().GetResponseStreamCompression()) {
+        compressor = std::make_unique<http::impl::BodyStreamCompressor>(*compression);
+    }
+    server::http::ResponseBodyStream response_body_stream{
+        response.GetBodyProducer(), http_response, std::move(compressor)};
 
     // Just in case HandleStreamRequest() throws an exception.
     // Though it can be changed in HandleStreamRequest().
@@ -256,7 +261,11 @@ void HttpHandlerBase::HandleHttpRequest(http::HttpRequest& request, request::Req
         HandleRequestStream(http_request, context);
     } else {
         // !IsBodyStreamed()
-        response.SetData(HandleRequestThrow(http_request, context));
+        auto data = HandleRequestThrow(http_request, context);
+        // The handler may have set the body via SetSharedData() and returned nothing
+        if (!data.empty() || !response.HasSharedData()) {
+            response.SetData(std::move(data));
+        }
     }
 }
 
@@ -1,11 +1,16 @@
 #include <userver/server/handlers/http_handler_static.hpp>
 
+#include <array>
+
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/http/common_headers.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
+#include <server/http/content_encoding.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::handlers {
@@ -32,6 +37,61 @@ const dynamic_config::Key<dynamic_config::ValueDict<std::string>> kContentTypeMa
 )"},
 };
 
+struct PrecompressedFile final {
+    http::impl::ContentEncoding encoding;
+    std::string_view suffix;
+};
+
+// In the order of server preference
+constexpr std::array kPrecompressedFiles{
+    PrecompressedFile{http::impl::ContentEncoding::kZstd, ".zst"},
+    PrecompressedFile{http::impl::ContentEncoding::kGzip, ".gz"},
+};
+
+// Looks up `<path>.zst` and `<path>.gz` and returns the one accepted by the
+// client, if any
+fs::FileInfoWithDataConstPtr
+TryGetPrecompressedFile(const fs::FsCacheClient& storage, const http::HttpRequest& request) {
+    std::array<http::impl::ContentEncoding, kPrecompressedFiles.size()> available{};
+    std::array<fs::FileInfoWithDataConstPtr, kPrecompressedFiles.size()> files;
+    std::size_t available_count = 0;
+    for (const auto& [encoding, suffix] : kPrecompressedFiles) {
+        auto file = storage.TryGetFile(request.GetRequestPath() + std::string{suffix});
+        if (file) {
+            available[available_count] = encoding;
+            files[available_count] = std::move(file);
+            ++available_count;
+        }
+    }
+    if (available_count == 0) {
+        return {};
+    }
+
+    auto& response = request.GetHttpResponse();
+    http::impl::AddVaryAcceptEncoding(response);
+    const auto encoding = http::impl::NegotiateContentEncoding(
+        request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding),
+        utils::span<const http::impl::ContentEncoding>{available.data(), available_count}
+    );
+    if (!encoding) {
+        return {};
+    }
+
+    for (std::size_t i = 0; i < available_count; ++i) {
+        if (available[i] == *encoding) {
+            response.SetContentEncoding(std::string{http::impl::ToString(*encoding)});
+            return files[i];
+        }
+    }
+    UINVARIANT(false, "Negotiated content encoding is not available");
+}
+
+// The cached file data is sent without copying it to the response
+void SetFileData(http::HttpResponse& response, fs::FileInfoWithDataConstPtr file) {
+    const auto* data = &file->data;
+    response.SetSharedData(std::shared_ptr<const std::string>{std::move(file), data});
+}
+
 }  // namespace
 
 HttpHandlerStatic::HttpHandlerStatic(
@@ -43,15 +103,24 @@ HttpHandlerStatic::HttpHandlerStatic(
       storage_(
           context.FindComponent<components::FsCache>(config["fs-cache-component"].As<std::string>("fs-cache-component"))
               .GetClient()
-      ) {}
+      ),
+      serve_precompressed_(config["serve-precompressed"].As<bool>(false)) {}
 
 std::string HttpHandlerStatic::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const {
     LOG_DEBUG() << "Handler: " << request.GetRequestPath();
     const auto file = storage_.TryGetFile(request.GetRequestPath());
     if (file) {
         const auto config = config_.GetSnapshot();
+        // Content type of the original file even if a compressed one is sent
         request.GetHttpResponse().SetContentType(config[kContentTypeMap][file->extension]);
-        return file->data;
+        if (serve_precompressed_) {
+            if (auto precompressed = TryGetPrecompressedFile(storage_, request)) {
+                SetFileData(request.GetHttpResponse(), std::move(precompressed));
+                return {};
+            }
+        }
+        SetFileData(request.GetHttpResponse(), file);
+        return {};
     }
     request.GetResponse().SetStatusNotFound();
     return "File not found";
@@ -69,6 +138,12 @@ properties:
         type: string
         description: Name of the FsCache component
         defaultDescription: fs-cache-component
+    serve-precompressed:
+        type: boolean
+        description: |
+            send `<file>.zst` or `<file>.gz` from the FsCache instead of
+            `<file>` if the client accepts the content coding
+        defaultDescription: false
 )");
 }
 
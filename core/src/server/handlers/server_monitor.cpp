@@ -1,9 +1,14 @@
 #include <userver/server/handlers/server_monitor.hpp>
 
+#include <mutex>
+
 #include <userver/components/component.hpp>
 #include <userver/components/statistics_storage.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/server/handlers/exceptions.hpp>
+#include <userver/server/http/http_response_body_stream.hpp>
+#include <userver/utils/overloaded.hpp>
 #include <userver/utils/statistics/graphite.hpp>
 #include <userver/utils/statistics/json.hpp>
 #include <userver/utils/statistics/pretty_format.hpp>
@@ -34,6 +39,10 @@ namespace {
 
 using impl::StatsFormat;
 
+// Big enough to amortize the per-chunk overhead, small enough to start sending
+// the response early
+constexpr std::size_t kStreamChunkSize = 256 * 1024;
+
 std::optional<StatsFormat> ParseFormat(std::string_view format) {
     if (format.empty()) return {};
 
@@ -60,18 +69,21 @@ std::optional<StatsFormat> ParseFormat(std::string_view format) {
     )});
 }
 
-}  // namespace
+StatsFormat GetFormat(const http::HttpRequest& request, std::optional<StatsFormat> default_format) {
+    const auto arg_format = ParseFormat(request.GetArg("format"));
 
-ServerMonitor::ServerMonitor(
-    const components::ComponentConfig& config,
-    const components::ComponentContext& component_context
-)
-    : HttpHandlerBase(config, component_context, /*is_monitor = */ true),
-      statistics_storage_(component_context.FindComponent<components::StatisticsStorage>().GetStorage()),
-      common_labels_{config["common-labels"].As<CommonLabels>({})},
-      default_format_{ParseFormat(config["format"].As<std::string>({}))} {}
+    if (!default_format.has_value() && !arg_format.has_value()) {
+        throw handlers::ClientError(handlers::ExternalBody{"No format was provided"});
+    }
 
-std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const {
+    return arg_format.has_value() ? arg_format.value() : default_format.value();
+}
+
+utils::statistics::Request MakeStatisticsRequest(
+    const http::HttpRequest& request,
+    StatsFormat format,
+    const utils::statistics::Request::AddLabels& common_labels
+) {
     const auto& prefix = request.GetArg("prefix");
     const auto& path = request.GetArg("path");
     if (!path.empty() && !prefix.empty() && path != prefix) {
@@ -87,47 +99,124 @@ std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
         }
     }
 
-    const auto arg_format = ParseFormat(request.GetArg("format"));
+    using utils::statistics::Request;
+    auto add_labels = format == StatsFormat::kSolomon ? Request::AddLabels{} : common_labels;
+    return path.empty() ? Request::MakeWithPrefix(prefix, std::move(add_labels), std::move(labels))
+                        : Request::MakeWithPath(path, std::move(add_labels), std::move(labels));
+}
 
-    if (!default_format_.has_value() && !arg_format.has_value()) {
-        throw handlers::ClientError(handlers::ExternalBody{"No format was provided"});
-    }
+}  // namespace
 
-    const auto format = arg_format.has_value() ? arg_format.value() : default_format_.value();
+struct ServerMonitor::PrometheusCaches final {
+    struct Cache final {
+        explicit Cache(bool typed) : cache(typed) {}
 
-    using utils::statistics::Request;
-    auto common_labels = format == StatsFormat::kSolomon ? Request::AddLabels{} : common_labels_;
-    const auto statistics_request =
-        (path.empty() ? Request::MakeWithPrefix(prefix, std::move(common_labels), std::move(labels))
-                      : Request::MakeWithPath(path, std::move(common_labels), std::move(labels)));
+        engine::Mutex mutex;
+        utils::statistics::PrometheusFormatCache cache;
+    };
+
+    Cache typed{/*typed=*/true};
+    Cache untyped{/*typed=*/false};
+};
+
+ServerMonitor::ServerMonitor(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& component_context
+)
+    : HttpHandlerBase(config, component_context, /*is_monitor = */ true),
+      statistics_storage_(component_context.FindComponent<components::StatisticsStorage>().GetStorage()),
+      common_labels_{config["common-labels"].As<CommonLabels>({})},
+      default_format_{ParseFormat(config["format"].As<std::string>({}))},
+      prometheus_caches_(
+          config["prometheus-cache-enabled"].As<bool>(false) ? std::make_unique<PrometheusCaches>() : nullptr
+      ) {}
+
+ServerMonitor::~ServerMonitor() = default;
+
+std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const {
+    std::string result;
+    FormatMetrics(
+        request,
+        utils::Overloaded{
+            [&result](std::string&& text) { result = std::move(text); },
+            [&result](std::string_view text) { result.assign(text.data(), text.size()); },
+        }
+    );
+    return result;
+}
+
+void ServerMonitor::HandleStreamRequest(
+    const http::HttpRequest& request,
+    request::RequestContext&,
+    http::ResponseBodyStream& stream
+) const {
+    FormatMetrics(request, [&stream](std::string_view text) {
+        stream.SetStatusCode(http::HttpStatus::kOk);
+        stream.SetEndOfHeaders();
+        while (!text.empty()) {
+            const auto chunk = text.substr(0, kStreamChunkSize);
+            stream.PushBodyChunk(std::string{chunk}, {});
+            text.remove_prefix(chunk.size());
+        }
+    });
+}
+
+template <typename Consumer>
+void ServerMonitor::FormatMetrics(const http::HttpRequest& request, Consumer&& consumer) const {
+    const auto format = GetFormat(request, default_format_);
+    const auto statistics_request = MakeStatisticsRequest(request, format, common_labels_);
+
+    const auto format_prometheus = [&](PrometheusCaches::Cache* cached, auto format_func) {
+        if (cached) {
+            // Concurrent requests do not wait for each other
+            std::unique_lock lock{cached->mutex, std::try_to_lock};
+            if (lock.owns_lock()) {
+                consumer(cached->cache.Format(statistics_storage_, statistics_request));
+                return;
+            }
+        }
+        consumer(format_func(statistics_storage_, statistics_request));
+    };
 
     request.GetHttpResponse().SetContentType("text/plain; charset=utf-8");
     switch (format) {
         case StatsFormat::kGraphite:
-            return utils::statistics::ToGraphiteFormat(statistics_storage_, statistics_request);
+            consumer(utils::statistics::ToGraphiteFormat(statistics_storage_, statistics_request));
+            return;
 
         case StatsFormat::kPrometheus:
-            return utils::statistics::ToPrometheusFormat(statistics_storage_, statistics_request);
+            format_prometheus(
+                prometheus_caches_ ? &prometheus_caches_->typed : nullptr, &utils::statistics::ToPrometheusFormat
+            );
+            return;
 
         case StatsFormat::kPrometheusUntyped:
-            return utils::statistics::ToPrometheusFormatUntyped(statistics_storage_, statistics_request);
+            format_prometheus(
+                prometheus_caches_ ? &prometheus_caches_->untyped : nullptr,
+                &utils::statistics::ToPrometheusFormatUntyped
+            );
+            return;
 
         case StatsFormat::kJson:
             request.GetHttpResponse().SetContentType("application/json");
-            return utils::statistics::ToJsonFormat(statistics_storage_, statistics_request);
+            consumer(utils::statistics::ToJsonFormat(statistics_storage_, statistics_request));
+            return;
 
         case StatsFormat::kPretty:
-            return utils::statistics::ToPrettyFormat(statistics_storage_, statistics_request);
+            consumer(utils::statistics::ToPrettyFormat(statistics_storage_, statistics_request));
+            return;
 
         case StatsFormat::kSolomon:
             request.GetHttpResponse().SetContentType("application/json");
-            return utils::statistics::ToSolomonFormat(statistics_storage_, common_labels_, statistics_request);
+            consumer(utils::statistics::ToSolomonFormat(statistics_storage_, common_labels_, statistics_request));
+            return;
 
         case StatsFormat::kInternal:
             request.GetHttpResponse().SetContentType("application/json");
             const auto json = statistics_storage_.GetAsJson();
             UASSERT(utils::statistics::AreAllMetricsNumbers(json));
-            return formats::json::ToString(json);
+            consumer(formats::json::ToString(json));
+            return;
     }
 
     UINVARIANT(false, "Unexpected 'format' value");
@@ -163,6 +252,12 @@ properties:
           - pretty
           - solomon
           - internal
+    prometheus-cache-enabled:
+        type: boolean
+        description: |
+            Keep the text of the metrics between the requests in Prometheus formats
+            and only format the metrics that have changed
+        defaultDescription: false
   )");
 }
 
@@ -0,0 +1,254 @@
+#include <server/http/content_encoding.hpp>
+
+#include <array>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+#include <userver/utils/text_light.hpp>
+#include <userver/utils/trivial_map.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+namespace {
+
+constexpr utils::TrivialBiMap kContentEncodingMap([](auto selector) {
+    return selector().Case(ContentEncoding::kGzip, "gzip").Case(ContentEncoding::kZstd, "zstd");
+});
+
+// qvalue multiplied by 1000, RFC 9110 12.4.2
+constexpr int kMaxQValue = 1000;
+
+std::string_view TrimSpaces(std::string_view value) {
+    while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) value.remove_prefix(1);
+    while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) value.remove_suffix(1);
+    return value;
+}
+
+bool IsCompressibleStatus(HttpStatus status) {
+    const auto code = static_cast<int>(status);
+    // 206 bodies are ranges of the identity representation
+    return code >= 200 && status != HttpStatus::kNoContent && status != HttpStatus::kPartialContent &&
+           status != HttpStatus::kNotModified;
+}
+
+// Media types that are already compressed gain nothing from another pass
+bool IsCompressibleContentType(std::string_view content_type) {
+    if (utils::text::ICaseStartsWith(content_type, "image/")) {
+        return utils::text::ICaseStartsWith(content_type, "image/svg+xml");
+    }
+    for (const std::string_view prefix : {
+             "video/",
+             "audio/",
+             "font/woff",
+             "application/zip",
+             "application/gzip",
+             "application/x-gzip",
+             "application/zstd",
+             "application/octet-stream",
+         }) {
+        if (utils::text::ICaseStartsWith(content_type, prefix)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Calls `func` for each `separator`-delimited element of `list`
+template <typename Func>
+void ForEachListElement(std::string_view list, char separator, Func func) {
+    while (!list.empty()) {
+        const auto pos = list.find(separator);
+        func(list.substr(0, pos));
+        if (pos == std::string_view::npos) {
+            break;
+        }
+        list.remove_prefix(pos + 1);
+    }
+}
+
+// qvalue = ( "0" [ "." 0*3DIGIT ] ) / ( "1" [ "." 0*3("0") ] )
+std::optional<int> ParseQValue(std::string_view value) {
+    if (value.empty() || (value[0] != '0' && value[0] != '1')) {
+        return std::nullopt;
+    }
+    int result = (value[0] - '0') * kMaxQValue;
+    if (value.size() == 1) {
+        return result;
+    }
+    if (value[1] != '.' || value.size() > 5) {
+        return std::nullopt;
+    }
+
+    int multiplier = kMaxQValue / 10;
+    for (const char c : value.substr(2)) {
+        if (c < '0' || c > '9') {
+            return std::nullopt;
+        }
+        result += (c - '0') * multiplier;
+        multiplier /= 10;
+    }
+    if (result > kMaxQValue) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+struct Coding {
+    std::string_view name;
+    int qvalue{kMaxQValue};
+};
+
+std::optional<Coding> ParseCoding(std::string_view element) {
+    const auto params_pos = element.find(';');
+    Coding coding{TrimSpaces(element.substr(0, params_pos))};
+    if (coding.name.empty()) {
+        return std::nullopt;
+    }
+    if (params_pos == std::string_view::npos) {
+        return coding;
+    }
+
+    bool is_valid = true;
+    ForEachListElement(element.substr(params_pos + 1), ';', [&](std::string_view param) {
+        param = TrimSpaces(param);
+        if (param.size() < 2 || (param[0] != 'q' && param[0] != 'Q') || param[1] != '=') {
+            return;
+        }
+        const auto qvalue = ParseQValue(param.substr(2));
+        if (!qvalue) {
+            is_valid = false;
+            return;
+        }
+        coding.qvalue = *qvalue;
+    });
+    if (!is_valid) {
+        return std::nullopt;
+    }
+    return coding;
+}
+
+}  // namespace
+
+std::string_view ToString(ContentEncoding encoding) {
+    const auto result = kContentEncodingMap.TryFindByFirst(encoding);
+    UINVARIANT(result, "Unknown content encoding");
+    return *result;
+}
+
+ContentEncoding Parse(const yaml_config::YamlConfig& value, formats::parse::To<ContentEncoding>) {
+    return utils::ParseFromValueString(value, kContentEncodingMap);
+}
+
+std::optional<ContentEncoding>
+NegotiateContentEncoding(std::string_view accept_encoding, utils::span<const ContentEncoding> supported) {
+    // Absent or empty Accept-Encoding means that the client prefers identity
+    if (accept_encoding.empty() || supported.empty()) {
+        return std::nullopt;
+    }
+
+    constexpr int kNotListed = -1;
+    int wildcard_qvalue = kNotListed;
+    std::array<int, kContentEncodingMap.size()> qvalues{};
+    qvalues.fill(kNotListed);
+
+    const utils::StrIcaseEqual equal;
+    ForEachListElement(accept_encoding, ',', [&](std::string_view element) {
+        const auto coding = ParseCoding(element);
+        if (!coding) {
+            return;
+        }
+        if (coding->name == "*") {
+            wildcard_qvalue = coding->qvalue;
+            return;
+        }
+        for (const auto encoding : supported) {
+            if (equal(coding->name, ToString(encoding))) {
+                qvalues[static_cast<std::size_t>(encoding)] = coding->qvalue;
+            }
+        }
+    });
+
+    std::optional<ContentEncoding> result;
+    int best_qvalue = 0;
+    for (const auto encoding : supported) {
+        auto qvalue = qvalues[static_cast<std::size_t>(encoding)];
+        if (qvalue == kNotListed) {
+            qvalue = wildcard_qvalue;
+        }
+        if (qvalue > best_qvalue) {
+            best_qvalue = qvalue;
+            result = encoding;
+        }
+    }
+    return result;
+}
+
+void AddVaryAcceptEncoding(HttpResponse& response) {
+    const auto& vary = response.GetHeader(USERVER_NAMESPACE::http::headers::kVary);
+    if (vary.empty()) {
+        response.SetHeader(USERVER_NAMESPACE::http::headers::kVary, std::string{"Accept-Encoding"});
+        return;
+    }
+
+    bool is_listed = false;
+    const utils::StrIcaseEqual equal;
+    ForEachListElement(vary, ',', [&](std::string_view field) {
+        field = TrimSpaces(field);
+        is_listed = is_listed || field == "*" || equal(field, USERVER_NAMESPACE::http::headers::kAcceptEncoding);
+    });
+    if (!is_listed) {
+        response.SetHeader(USERVER_NAMESPACE::http::headers::kVary, vary + ", Accept-Encoding");
+    }
+}
+
+bool IsCompressibleResponse(const HttpResponse& response) {
+    return IsCompressibleStatus(response.GetStatus()) &&
+           !response.HasHeader(USERVER_NAMESPACE::http::headers::kContentEncoding) &&
+           IsCompressibleContentType(response.GetHeader(USERVER_NAMESPACE::http::headers::kContentType));
+}
+
+std::string Compress(const BodyCompression& compression, std::string_view data) {
+    switch (compression.encoding) {
+        case ContentEncoding::kGzip:
+            return compression::gzip::Compress(data, compression.level);
+        case ContentEncoding::kZstd:
+            return compression::zstd::Compress(data, compression.level);
+    }
+    UINVARIANT(false, "Unknown content encoding");
+}
+
+namespace {
+
+std::variant<compression::gzip::StreamCompressor, compression::zstd::StreamCompressor> MakeStreamCompressor(
+    const BodyCompression& compression
+) {
+    switch (compression.encoding) {
+        case ContentEncoding::kGzip:
+            return compression::gzip::StreamCompressor{compression.level};
+        case ContentEncoding::kZstd:
+            return compression::zstd::StreamCompressor{compression.level};
+    }
+    UINVARIANT(false, "Unknown content encoding");
+}
+
+}  // namespace
+
+BodyStreamCompressor::BodyStreamCompressor(const BodyCompression& compression)
+    : encoding_(compression.encoding), compressor_(MakeStreamCompressor(compression)) {}
+
+std::string BodyStreamCompressor::Compress(std::string_view chunk) {
+    return std::visit([chunk](auto& compressor) { return compressor.Compress(chunk); }, compressor_);
+}
+
+std::string BodyStreamCompressor::Finish() {
+    return std::visit([](auto& compressor) { return compressor.Finish(); }, compressor_);
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+
+#include <compression/gzip.hpp>
+#include <userver/compression/zstd.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/span.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+class HttpResponse;
+}  // namespace server::http
+
+namespace server::http::impl {
+
+/// Content codings supported for the response bodies, RFC 9110 8.4.1
+enum class ContentEncoding {
+    kGzip,
+    kZstd,
+};
+
+std::string_view ToString(ContentEncoding encoding);
+
+ContentEncoding Parse(const yaml_config::YamlConfig& value, formats::parse::To<ContentEncoding>);
+
+/// Returns the coding from `supported` with the highest qvalue in the
+/// Accept-Encoding header value, ties are resolved in the `supported` order.
+/// Returns std::nullopt if none of the codings is acceptable.
+std::optional<ContentEncoding>
+NegotiateContentEncoding(std::string_view accept_encoding, utils::span<const ContentEncoding> supported);
+
+/// Adds Accept-Encoding to the Vary header of the response, if missing
+void AddVaryAcceptEncoding(HttpResponse& response);
+
+/// Returns false if the body of the response must be sent as is: the status
+/// has no body or it is a range, the body is already encoded or its media
+/// type is compressed. Same for the buffered and the streamed bodies.
+bool IsCompressibleResponse(const HttpResponse& response);
+
+struct BodyCompression {
+    ContentEncoding encoding{ContentEncoding::kGzip};
+    int level{compression::gzip::kDefaultCompressionLevel};
+};
+
+std::string Compress(const BodyCompression& compression, std::string_view data);
+
+/// Compresses the chunks of a streamed response body
+class BodyStreamCompressor final {
+public:
+    explicit BodyStreamCompressor(const BodyCompression& compression);
+
+    ContentEncoding GetEncoding() const noexcept { return encoding_; }
+
+    /// Compresses and flushes the chunk
+    std::string Compress(std::string_view chunk);
+
+    std::string Finish();
+
+private:
+    ContentEncoding encoding_;
+    std::variant<compression::gzip::StreamCompressor, compression::zstd::StreamCompressor> compressor_;
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
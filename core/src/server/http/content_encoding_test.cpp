@@ -0,0 +1,81 @@
+#include <server/http/content_encoding.hpp>
+
+#include <gtest/gtest.h>
+
+#include <server/http/http_request_impl.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::impl::ContentEncoding;
+using server::http::impl::NegotiateContentEncoding;
+
+constexpr ContentEncoding kSupported[] = {ContentEncoding::kZstd, ContentEncoding::kGzip};
+
+}  // namespace
+
+TEST(ContentEncoding, NoAcceptEncoding) {
+    EXPECT_EQ(NegotiateContentEncoding("", kSupported), std::nullopt);
+    EXPECT_EQ(NegotiateContentEncoding("identity", kSupported), std::nullopt);
+    EXPECT_EQ(NegotiateContentEncoding("br", kSupported), std::nullopt);
+}
+
+TEST(ContentEncoding, ServerPreference) {
+    EXPECT_EQ(NegotiateContentEncoding("gzip, zstd", kSupported), ContentEncoding::kZstd);
+    EXPECT_EQ(NegotiateContentEncoding("gzip, deflate, br", kSupported), ContentEncoding::kGzip);
+    EXPECT_EQ(NegotiateContentEncoding("GZIP", kSupported), ContentEncoding::kGzip);
+}
+
+TEST(ContentEncoding, QValues) {
+    EXPECT_EQ(NegotiateContentEncoding("zstd;q=0.5, gzip", kSupported), ContentEncoding::kGzip);
+    EXPECT_EQ(NegotiateContentEncoding("zstd ; q=1.0 , gzip;q=0.999", kSupported), ContentEncoding::kZstd);
+    EXPECT_EQ(NegotiateContentEncoding("zstd;q=0, gzip;q=0", kSupported), std::nullopt);
+    EXPECT_EQ(NegotiateContentEncoding("zstd;q=0, gzip;q=0.001", kSupported), ContentEncoding::kGzip);
+}
+
+TEST(ContentEncoding, Wildcard) {
+    EXPECT_EQ(NegotiateContentEncoding("*", kSupported), ContentEncoding::kZstd);
+    EXPECT_EQ(NegotiateContentEncoding("zstd;q=0, *", kSupported), ContentEncoding::kGzip);
+    EXPECT_EQ(NegotiateContentEncoding("gzip;q=0.5, *;q=0", kSupported), ContentEncoding::kGzip);
+}
+
+TEST(ContentEncoding, Malformed) {
+    EXPECT_EQ(NegotiateContentEncoding("zstd;q=2, gzip", kSupported), ContentEncoding::kGzip);
+    EXPECT_EQ(NegotiateContentEncoding("zstd;q=abc", kSupported), std::nullopt);
+    EXPECT_EQ(NegotiateContentEncoding(",,, ;q=1, gzip", kSupported), ContentEncoding::kGzip);
+}
+
+// Used for both the buffered and the streamed response bodies
+UTEST(ContentEncoding, CompressibleResponse) {
+    using server::http::HttpStatus;
+
+    server::request::ResponseDataAccounter accounter;
+    const server::http::HttpRequestImpl request{accounter, engine::io::Sockaddr{}};
+    auto& response = request.GetHttpResponse();
+
+    response.SetStatus(HttpStatus::kOk);
+    response.SetHeader(http::headers::kContentType, std::string{"text/plain"});
+    EXPECT_TRUE(server::http::impl::IsCompressibleResponse(response));
+
+    for (const auto status : {HttpStatus::kPartialContent, HttpStatus::kNoContent, HttpStatus::kNotModified}) {
+        response.SetStatus(status);
+        EXPECT_FALSE(server::http::impl::IsCompressibleResponse(response)) << static_cast<int>(status);
+    }
+    response.SetStatus(HttpStatus::kNotFound);
+    EXPECT_TRUE(server::http::impl::IsCompressibleResponse(response));
+
+    response.SetStatus(HttpStatus::kOk);
+    response.SetHeader(http::headers::kContentType, std::string{"image/png"});
+    EXPECT_FALSE(server::http::impl::IsCompressibleResponse(response));
+    response.SetHeader(http::headers::kContentType, std::string{"image/svg+xml"});
+    EXPECT_TRUE(server::http::impl::IsCompressibleResponse(response));
+
+    response.SetHeader(http::headers::kContentEncoding, std::string{"br"});
+    EXPECT_FALSE(server::http::impl::IsCompressibleResponse(response));
+}
+
+USERVER_NAMESPACE_END
@@ -18,7 +18,8 @@ namespace server {
 
 inline std::shared_ptr<request::RequestParser> CreateTestParser(
     server::http::HttpRequestParser::OnNewRequestCb&& cb,
-    USERVER_NAMESPACE::http::HttpVersion http_version = USERVER_NAMESPACE::http::HttpVersion::k11
+    USERVER_NAMESPACE::http::HttpVersion http_version = USERVER_NAMESPACE::http::HttpVersion::k11,
+    bool use_fast_parser = false
 ) {
     static const server::http::HandlerInfoIndex kTestHandlerInfoIndex;
     static const server::request::HttpRequestConfig kTestRequestConfig{
@@ -46,7 +47,13 @@ inline std::shared_ptr<request::RequestParser> CreateTestParser(
         );
     } else {
         return std::make_shared<server::http::HttpRequestParser>(
-            kTestHandlerInfoIndex, kTestRequestConfig, std::move(cb), test_stats, test_accounter, engine::io::Sockaddr{}
+            kTestHandlerInfoIndex,
+            kTestRequestConfig,
+            std::move(cb),
+            test_stats,
+            test_accounter,
+            engine::io::Sockaddr{},
+            use_fast_parser
         );
     }
 }
@@ -0,0 +1,46 @@
+#include <server/http/http2_bdp_estimator.hpp>
+
+#include <algorithm>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+BdpEstimator::BdpEstimator(std::uint32_t initial_window, std::uint32_t max_window) noexcept
+    : window_(std::min(initial_window, max_window)), max_window_(max_window) {}
+
+bool BdpEstimator::OnDataReceived(std::size_t size) noexcept {
+    if (is_ping_sent_) {
+        sample_ += size;
+        return false;
+    }
+    if (window_ >= max_window_) {
+        return false;
+    }
+    is_ping_sent_ = true;
+    sample_ = size;
+    return true;
+}
+
+std::optional<std::uint32_t> BdpEstimator::OnPingAck() noexcept {
+    if (!is_ping_sent_) {
+        return std::nullopt;
+    }
+    is_ping_sent_ = false;
+
+    // The peer had to wait for the window updates if it sent almost the whole
+    // window in a round trip
+    if (sample_ * 3 < std::uint64_t{window_} * 2) {
+        return std::nullopt;
+    }
+    const auto window = static_cast<std::uint32_t>(std::min<std::uint64_t>(sample_ * 2, max_window_));
+    if (window <= window_) {
+        return std::nullopt;
+    }
+    window_ = window;
+    return window_;
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
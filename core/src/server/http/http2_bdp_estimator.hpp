@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+/// @brief Estimates the bandwidth-delay product (BDP) of the connection to
+/// grow the HTTP/2 connection receive window.
+///
+/// A PING is sent with the first DATA frame and the data received until the
+/// PING ACK is the BDP sample. If the sample is close to the window, the
+/// window limits the throughput, and it grows to twice the sample.
+class BdpEstimator final {
+public:
+    BdpEstimator(std::uint32_t initial_window, std::uint32_t max_window) noexcept;
+
+    /// Returns true if the BDP PING must be sent
+    bool OnDataReceived(std::size_t size) noexcept;
+
+    /// Returns the new connection window size if it must grow
+    std::optional<std::uint32_t> OnPingAck() noexcept;
+
+    std::uint32_t GetWindow() const noexcept { return window_; }
+
+private:
+    std::uint32_t window_;
+    const std::uint32_t max_window_;
+    std::uint64_t sample_{0};
+    bool is_ping_sent_{false};
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
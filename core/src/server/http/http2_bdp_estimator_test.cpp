@@ -0,0 +1,53 @@
+#include <server/http/http2_bdp_estimator.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::uint32_t kInitialWindow = 1 << 16;
+constexpr std::uint32_t kMaxWindow = 1 << 20;
+
+}  // namespace
+
+TEST(Http2BdpEstimator, PingPerRoundTrip) {
+    server::http::impl::BdpEstimator estimator{kInitialWindow, kMaxWindow};
+    EXPECT_TRUE(estimator.OnDataReceived(100));
+    EXPECT_FALSE(estimator.OnDataReceived(100));
+    EXPECT_FALSE(estimator.OnDataReceived(100));
+    EXPECT_EQ(estimator.OnPingAck(), std::nullopt);
+
+    EXPECT_TRUE(estimator.OnDataReceived(100));
+}
+
+TEST(Http2BdpEstimator, Grows) {
+    server::http::impl::BdpEstimator estimator{kInitialWindow, kMaxWindow};
+    EXPECT_TRUE(estimator.OnDataReceived(kInitialWindow / 2));
+    EXPECT_FALSE(estimator.OnDataReceived(kInitialWindow / 2));
+    EXPECT_EQ(estimator.OnPingAck(), kInitialWindow * 2);
+    EXPECT_EQ(estimator.GetWindow(), kInitialWindow * 2);
+
+    // a small sample does not shrink the window
+    EXPECT_TRUE(estimator.OnDataReceived(1));
+    EXPECT_EQ(estimator.OnPingAck(), std::nullopt);
+    EXPECT_EQ(estimator.GetWindow(), kInitialWindow * 2);
+}
+
+TEST(Http2BdpEstimator, MaxWindow) {
+    server::http::impl::BdpEstimator estimator{kInitialWindow, kMaxWindow};
+    EXPECT_TRUE(estimator.OnDataReceived(kMaxWindow));
+    EXPECT_EQ(estimator.OnPingAck(), kMaxWindow);
+
+    // no more pings once the max window is reached
+    EXPECT_FALSE(estimator.OnDataReceived(kMaxWindow));
+    EXPECT_EQ(estimator.OnPingAck(), std::nullopt);
+}
+
+TEST(Http2BdpEstimator, UnexpectedAck) {
+    server::http::impl::BdpEstimator estimator{kInitialWindow, kMaxWindow};
+    EXPECT_EQ(estimator.OnPingAck(), std::nullopt);
+    EXPECT_EQ(estimator.GetWindow(), kInitialWindow);
+}
+
+USERVER_NAMESPACE_END
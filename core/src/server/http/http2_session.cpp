@@ -1,8 +1,12 @@
 #include <server/http/http2_session.hpp>
 
+#include <cstring>
+
 #include <server/http/http_request_parser.hpp>
 #include <server/net/connection_config.hpp>
 
+#include <boost/container/small_vector.hpp>
+
 #include <userver/crypto/base64.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/http/common_headers.hpp>
@@ -16,6 +20,9 @@ namespace {
 
 constexpr std::size_t kFrameHeaderSize = 9;
 
+// Distinguishes the ACKs of the BDP estimation PINGs
+constexpr std::array<std::uint8_t, 8> kBdpPingData{'u', 's', 'r', 'v', '-', 'b', 'd', 'p'};
+
 void ThrowIfErr(int error_code, std::string_view msg) {
     if (error_code != 0) {
         throw std::runtime_error{fmt::format("{}: {}", msg, nghttp2_strerror(error_code))};
@@ -77,13 +84,36 @@ Http2Session::Http2Session(
     UASSERT(session);
     session_ = SessionPtr(session, nghttp2_session_del);
 
-    std::array<nghttp2_settings_entry, 3> settings{
+    boost::container::small_vector<nghttp2_settings_entry, 4> settings{
         nghttp2_settings_entry{NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS, config.max_concurrent_streams},
         nghttp2_settings_entry{NGHTTP2_SETTINGS_MAX_FRAME_SIZE, config.max_frame_size},
         nghttp2_settings_entry{NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE, config.initial_window_size}};
+    if (config.rfc9218_priorities) {
+#if NGHTTP2_VERSION_NUM >= 0x013100
+        // nghttp2 parses the `priority` header and PRIORITY_UPDATE frames and
+        // schedules the DATA frames by urgency once this is sent
+        settings.push_back(nghttp2_settings_entry{NGHTTP2_SETTINGS_NO_RFC7540_PRIORITIES, 1});
+#else
+        LOG_LIMITED_WARNING() << "RFC 9218 priorities require nghttp2 1.49 or newer, RFC 7540 ones are used";
+#endif
+    }
 
     auto rv = nghttp2_submit_settings(session_.get(), NGHTTP2_FLAG_NONE, settings.data(), settings.size());
     ThrowIfErr(rv, "Error when submit settings");
+
+    // The connection window is not a setting, it is grown by WINDOW_UPDATE
+    if (config.connection_window_size > NGHTTP2_INITIAL_CONNECTION_WINDOW_SIZE) {
+        rv = nghttp2_session_set_local_window_size(
+            session_.get(), NGHTTP2_FLAG_NONE, 0, static_cast<std::int32_t>(config.connection_window_size)
+        );
+        ThrowIfErr(rv, "Error when set connection window size");
+    }
+    if (config.window_auto_tuning) {
+        bdp_estimator_.emplace(
+            std::max<std::uint32_t>(config.connection_window_size, NGHTTP2_INITIAL_CONNECTION_WINDOW_SIZE),
+            config.max_connection_window_size
+        );
+    }
     rv = nghttp2_session_send(session_.get());
     ThrowIfErr(rv, "Error when session send");
 }
@@ -111,7 +141,13 @@ int Http2Session::OnFrameRecv(nghttp2_session* session, const nghttp2_frame* fra
             IncStat(parser.stats_.http2_stats.reset_streams);
         } break;
         case NGHTTP2_PING: {
-            nghttp2_submit_ping(parser.session_.get(), NGHTTP2_FLAG_NONE, nullptr);
+            // nghttp2 answers the PINGs itself, an ACK of our PING may be the
+            // end of the BDP estimation round trip
+            if (frame->hd.flags & NGHTTP2_FLAG_ACK) {
+                parser.OnPingAck(frame->ping.opaque_data);
+            } else {
+                nghttp2_submit_ping(parser.session_.get(), NGHTTP2_FLAG_NONE, nullptr);
+            }
         } break;
         case NGHTTP2_GOAWAY: {
             IncStat(parser.stats_.http2_stats.goaway);
@@ -197,6 +233,11 @@ int Http2Session::OnDataChunkRecv(
     void* user_data
 ) {
     auto& parser = GetParser(user_data);
+    if (parser.bdp_estimator_ && parser.bdp_estimator_->OnDataReceived(len)) {
+        const auto res = nghttp2_submit_ping(parser.session_.get(), NGHTTP2_FLAG_NONE, kBdpPingData.data());
+        UASSERT(res == 0);
+    }
+
     auto& stream = parser.GetStreamChecked(Stream::Id{id});
     try {
         stream.RequestConstructor().AppendBody(reinterpret_cast<const char*>(data), len);
@@ -295,6 +336,24 @@ void Http2Session::SubmitRstStream(Stream::Id id) {
     UASSERT(res == 0);
 }
 
+void Http2Session::OnPingAck(const std::uint8_t* opaque_data) {
+    if (!bdp_estimator_ || std::memcmp(opaque_data, kBdpPingData.data(), kBdpPingData.size()) != 0) {
+        return;
+    }
+    const auto window = bdp_estimator_->OnPingAck();
+    if (!window) {
+        return;
+    }
+    // nghttp2 sends the WINDOW_UPDATE with the difference
+    const auto res =
+        nghttp2_session_set_local_window_size(session_.get(), NGHTTP2_FLAG_NONE, 0, static_cast<std::int32_t>(*window));
+    if (res != 0) {
+        LOG_LIMITED_WARNING() << "Failed to grow the connection window: " << nghttp2_strerror(res);
+        return;
+    }
+    IncStat(stats_.http2_stats.window_updates);
+}
+
 bool Http2Session::Parse(std::string_view req) {
     const int readlen =
         nghttp2_session_mem_recv(session_.get(), reinterpret_cast<const uint8_t*>(req.data()), req.size());
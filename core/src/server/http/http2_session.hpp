@@ -3,6 +3,7 @@
 #include <nghttp2/nghttp2.h>
 #include <boost/pool/object_pool.hpp>
 
+#include <server/http/http2_bdp_estimator.hpp>
 #include <server/http/http2_stream.hpp>
 #include <server/http/http2_writer.hpp>
 #include <server/http/http_request_constructor.hpp>
@@ -106,6 +107,7 @@ private:
     Stream& GetStreamChecked(Stream::Id id);
 
     void SubmitRstStream(Stream::Id stream_id);
+    void OnPingAck(const std::uint8_t* opaque_data);
 
     void FinalizeRequest(Stream& stream);
     bool ConnectionIsOk();
@@ -129,6 +131,8 @@ private:
     engine::io::Sockaddr remote_address_;
     engine::io::RwBase* socket_;
 
+    std::optional<impl::BdpEstimator> bdp_estimator_;
+
     std::shared_ptr<impl::Http2StreamEventQueue> streaming_queue_{nullptr};
     engine::SingleConsumerEvent streaming_event_;
     impl::Http2StreamEventQueue::Consumer streaming_consumer_;
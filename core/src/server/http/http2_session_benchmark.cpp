@@ -0,0 +1,140 @@
+#include <server/http/http2_session.hpp>
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <nghttp2/nghttp2.h>
+
+#include <server/net/connection_config.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kRequestBody =
+    "{\"id\": 12345, \"fields\": [\"name\", \"email\", \"phone\"], \"locale\": \"en-US\", \"debug\": false}";
+
+nghttp2_nv MakeHeader(std::string_view name, std::string_view value) {
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+    return nghttp2_nv{
+        reinterpret_cast<std::uint8_t*>(const_cast<char*>(name.data())),
+        reinterpret_cast<std::uint8_t*>(const_cast<char*>(value.data())),
+        name.size(),
+        value.size(),
+        NGHTTP2_NV_FLAG_NONE};
+    // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+}
+
+ssize_t ReadRequestBody(
+    nghttp2_session*,
+    std::int32_t,
+    std::uint8_t* buf,
+    std::size_t length,
+    std::uint32_t* data_flags,
+    nghttp2_data_source* source,
+    void*
+) {
+    auto& offset = *static_cast<std::size_t*>(source->ptr);
+    const auto size = std::min(length, kRequestBody.size() - offset);
+    std::copy_n(kRequestBody.data() + offset, size, buf);
+    offset += size;
+    if (offset == kRequestBody.size()) {
+        *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+    }
+    return static_cast<ssize_t>(size);
+}
+
+// The client side of a connection with `streams_count` concurrent POST
+// requests, as it is seen by the server
+std::string MakeClientData(std::size_t streams_count) {
+    nghttp2_session_callbacks* callbacks{nullptr};
+    nghttp2_session_callbacks_new(&callbacks);
+    nghttp2_session* session{nullptr};
+    nghttp2_session_client_new(&session, callbacks, nullptr);
+    nghttp2_session_callbacks_del(callbacks);
+    utils::FastScopeGuard delete_guard{[session]() noexcept { nghttp2_session_del(session); }};
+
+    nghttp2_submit_settings(session, NGHTTP2_FLAG_NONE, nullptr, 0);
+
+    const std::array headers{
+        MakeHeader(":method", "POST"),
+        MakeHeader(":scheme", "http"),
+        MakeHeader(":authority", "localhost:11235"),
+        MakeHeader(":path", "/v1/profile?id=12345"),
+        MakeHeader("content-type", "application/json"),
+        MakeHeader("user-agent", "benchmark/1.0"),
+        MakeHeader("x-request-id", "4f1c2b3a-9d8e-4f7a-b6c5-d4e3f2a1b0c9"),
+    };
+    std::vector<std::size_t> offsets(streams_count, 0);
+    for (auto& offset : offsets) {
+        nghttp2_data_provider provider{};
+        provider.source.ptr = &offset;
+        provider.read_callback = ReadRequestBody;
+        nghttp2_submit_request(session, nullptr, headers.data(), headers.size(), &provider, nullptr);
+    }
+
+    std::string data{NGHTTP2_CLIENT_MAGIC, NGHTTP2_CLIENT_MAGIC_LEN};
+    while (true) {
+        const std::uint8_t* chunk{nullptr};
+        const auto len = nghttp2_session_mem_send(session, &chunk);
+        if (len <= 0) {
+            break;
+        }
+        data.append(reinterpret_cast<const char*>(chunk), len);
+    }
+    return data;
+}
+
+}  // namespace
+
+// Parses all the concurrent streams of a new connection, the argument is the
+// number of the streams
+void http2_session_parse_concurrent_streams(benchmark::State& state) {
+    static const server::http::HandlerInfoIndex kTestHandlerInfoIndex;
+    static const server::request::HttpRequestConfig kTestRequestConfig{
+        /*.max_url_size = */ 8192,
+        /*.max_request_size = */ 1024 * 1024,
+        /*.max_headers_size = */ 65536,
+        /*.parse_args_from_body = */ false,
+        /*.testing_mode = */ true,  // non default value
+        /*.decompress_request = */ false,
+        /* set_tracing_headers = */ true,
+        /* deadline_propagation_enabled = */ true,
+        /* deadline_expired_status_code = */ server::http::HttpStatus{498}};
+    server::net::ParserStats stats;
+    server::request::ResponseDataAccounter accounter;
+    const server::net::Http2SessionConfig config;
+
+    const auto streams_count = static_cast<std::size_t>(state.range(0));
+    const auto data = MakeClientData(streams_count);
+    std::size_t requests_count = 0;
+
+    for ([[maybe_unused]] auto _ : state) {
+        server::http::Http2Session session(
+            kTestHandlerInfoIndex,
+            kTestRequestConfig,
+            config,
+            [&requests_count](std::shared_ptr<server::request::RequestBase>&& request) {
+                benchmark::DoNotOptimize(request);
+                ++requests_count;
+            },
+            stats,
+            accounter,
+            engine::io::Sockaddr{}
+        );
+        benchmark::DoNotOptimize(session.Parse(data));
+    }
+
+    if (requests_count != streams_count * state.iterations()) {
+        state.SkipWithError("not all the streams were parsed");
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(requests_count));
+    state.SetBytesProcessed(static_cast<std::int64_t>(data.size() * state.iterations()));
+}
+BENCHMARK(http2_session_parse_concurrent_streams)->Arg(1)->Arg(16)->Arg(100);
+
+USERVER_NAMESPACE_END
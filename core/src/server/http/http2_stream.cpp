@@ -70,6 +70,18 @@ void Stream::PushChunk(std::string&& chunk) {
     chunks_.push_back(std::move(chunk));
 }
 
+void Stream::PushChunk(std::shared_ptr<const std::string> chunk) {
+    if (!chunk || chunk->empty()) return;
+    chunks_.push_back(std::move(chunk));
+}
+
+std::string_view Stream::ToView(const Chunk& chunk) noexcept {
+    if (const auto* shared = std::get_if<std::shared_ptr<const std::string>>(&chunk)) {
+        return **shared;
+    }
+    return std::get<std::string>(chunk);
+}
+
 ssize_t Stream::GetMaxSize(std::size_t max_len, std::uint32_t* flags) {
     auto& stream = *static_cast<Stream*>(nghttp2_provider_.source.ptr);
     if (chunks_.empty() && !stream.is_streaming_) {
@@ -78,7 +90,7 @@ ssize_t Stream::GetMaxSize(std::size_t max_len, std::uint32_t* flags) {
     }
     const std::size_t total =
         std::accumulate(chunks_.begin(), chunks_.end(), std::size_t{0}, [](std::size_t size, const auto& str) {
-            return size + str.size();
+            return size + ToView(str).size();
         });
     if (total == 0 && stream.is_streaming_ && !stream.is_end_) {
         stream.is_deferred_ = true;
@@ -86,10 +98,11 @@ ssize_t Stream::GetMaxSize(std::size_t max_len, std::uint32_t* flags) {
     }
     if (!stream.is_streaming_) {
         UASSERT(chunks_.size() == 1);
-        if (pos_in_first_chunk_ + max_len >= chunks_[0].size()) {
+        const auto chunk_size = ToView(chunks_[0]).size();
+        if (pos_in_first_chunk_ + max_len >= chunk_size) {
             *flags |= NGHTTP2_DATA_FLAG_EOF;
         }
-        return std::min(max_len, chunks_[0].size() - pos_in_first_chunk_);
+        return std::min(max_len, chunk_size - pos_in_first_chunk_);
     }
     UASSERT(total >= pos_in_first_chunk_);
     const auto remaining = total - pos_in_first_chunk_;
@@ -104,13 +117,13 @@ void Stream::Send(engine::io::Socket& socket, std::string_view data_frame_header
     boost::container::small_vector<engine::io::IoData, 16> parts{};
     parts.push_back({data_frame_header.data(), data_frame_header.size()});
     auto budget = max_len;
-    for (const auto& chunk : chunks_) {
+    for (const auto& chunk_data : chunks_) {
         if (budget == 0) {
             break;
         }
+        const auto chunk = ToView(chunk_data);
         UASSERT(chunk.size() > pos_in_first_chunk_);
-        const auto part =
-            std::string_view{chunk}.substr(pos_in_first_chunk_, std::min(chunk.size() - pos_in_first_chunk_, budget));
+        const auto part = chunk.substr(pos_in_first_chunk_, std::min(chunk.size() - pos_in_first_chunk_, budget));
         parts.push_back({part.data(), part.size()});
         pos_in_first_chunk_ += part.size();
         if (pos_in_first_chunk_ >= chunk.size()) {
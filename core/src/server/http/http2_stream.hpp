@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+#include <variant>
+
 #include <nghttp2/nghttp2.h>
 #include <boost/container/small_vector.hpp>
 
@@ -42,17 +45,23 @@ public:
 
     bool CheckUrlComplete();
     void PushChunk(std::string&& chunk);
+    // The data is sent without copying, e.g. the cached static files
+    void PushChunk(std::shared_ptr<const std::string> chunk);
     ssize_t GetMaxSize(std::size_t max_len, std::uint32_t* flags);
     void Send(engine::io::Socket& socket, std::string_view data_frame_header, std::size_t max_len);
     nghttp2_data_provider* GetNativeProvider() { return &nghttp2_provider_; }
 
 private:
+    using Chunk = std::variant<std::string, std::shared_ptr<const std::string>>;
+
+    static std::string_view ToView(const Chunk& chunk) noexcept;
+
     bool url_complete_{false};
     HttpRequestConstructor constructor_;
     const Id id_;
     // Body sending
     nghttp2_data_provider nghttp2_provider_{};
-    boost::container::small_vector<std::string, 16> chunks_{};
+    boost::container::small_vector<Chunk, 16> chunks_{};
     std::size_t pos_in_first_chunk_{0};
     // for the streaming API
     bool is_streaming_{false};
@@ -102,11 +102,15 @@ public:
 
     void WriteHttpResponse() {
         auto data = response_.ExtractData();
+        // The shared data, e.g. a cached static file, is sent without copying
+        const auto& shared_body = response_.GetSharedBody();
+        const bool use_shared_data = shared_body != nullptr;
+        const auto body_size = use_shared_data ? shared_body->size() : data.size();
 
         auto headers = GetHeaders();
         const bool is_body_forbidden = IsBodyForbiddenForStatus(response_.status_);
 
-        if (is_body_forbidden && !data.empty()) {
+        if (is_body_forbidden && body_size != 0) {
             LOG_LIMITED_WARNING() << "Non-empty body provided for response with HTTP2 code "
                                   << static_cast<int>(response_.status_)
                                   << " which does not allow one, it will be dropped";
@@ -114,14 +118,18 @@ public:
 
         const auto stream_id = response_.GetStreamId().value();
         auto& stream = http2_session_.GetStreamChecked(Stream::Id{stream_id});
-        stream.SetStreaming(response_.IsBodyStreamed() && data.empty());
+        stream.SetStreaming(response_.IsBodyStreamed() && body_size == 0);
 
         std::size_t bytes = headers.GetSize();
         nghttp2_data_provider* provider{nullptr};
         if (response_.request_.GetMethod() != HttpMethod::kHead && !is_body_forbidden) {
             if (!stream.IsStreaming()) {
-                bytes += data.size();
-                stream.PushChunk(std::move(data));
+                bytes += body_size;
+                if (use_shared_data) {
+                    stream.PushChunk(shared_body);
+                } else {
+                    stream.PushChunk(std::move(data));
+                }
             }
             provider = stream.GetNativeProvider();
         }
@@ -19,6 +19,10 @@ namespace server::http {
 
 namespace {
 
+// Enough for most of the bodies to arrive without reallocations, while a
+// client sending just the headers can not make the server allocate much
+constexpr std::size_t kMaxBodyReserveSize = 64 * 1024;
+
 inline void Strip(const char*& begin, const char*& end) {
     while (begin < end && isspace(*begin)) ++begin;
     while (begin < end && isspace(end[-1])) --end;
@@ -163,6 +167,16 @@ void HttpRequestConstructor::AppendBody(const char* data, size_t size) {
     request_->request_body_.append(data, size);
 }
 
+void HttpRequestConstructor::ReserveBody(size_t size) {
+    // The requests over the limit are rejected anyway, do not allocate for them
+    if (request_size_ > config_.max_request_size || size > config_.max_request_size - request_size_) {
+        return;
+    }
+    // Content-Length is not trusted until the body arrives, bigger bodies
+    // grow the buffer geometrically in AppendBody
+    request_->request_body_.reserve(std::min(size, kMaxBodyReserveSize));
+}
+
 void HttpRequestConstructor::SetIsFinal(bool is_final) {
     UASSERT(request_);
     request_->is_final_ = is_final;
@@ -54,6 +54,8 @@ public:
     void AppendHeaderField(const char* data, size_t size);
     void AppendHeaderValue(const char* data, size_t size);
     void AppendBody(const char* data, size_t size);
+    // Preallocates the body storage, if the size is known from Content-Length
+    void ReserveBody(size_t size);
 
     void SetIsFinal(bool is_final);
 
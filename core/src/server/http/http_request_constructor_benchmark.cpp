@@ -1,6 +1,9 @@
 #include <benchmark/benchmark.h>
 
+#include <fmt/format.h>
+
 #include <server/http/http_request_constructor.hpp>
+#include <server/http/http_request_fast_parser.hpp>
 #include <utils/gbench_auxilary.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -15,7 +18,61 @@ void http_request_constructor_url_decode(benchmark::State& state) {
 
     for ([[maybe_unused]] auto _ : state) benchmark::DoNotOptimize(USERVER_NAMESPACE::http::parser::UrlDecode(input));
 }
+
+// A request with `state.range(0)` headers
+std::string MakeRequest(benchmark::State& state) {
+    std::string request = "GET /v1/profile?id=12345&fields=name,email HTTP/1.1\r\n";
+    for (int64_t i = 0; i < state.range(0); i++) {
+        request += fmt::format("X-Header-{}: some-reasonably-long-header-value-{}\r\n", i, i);
+    }
+    request += "\r\n";
+    return request;
+}
+
+// Only finds the request parts, nothing is copied
+void http_request_constructor_fast_parse(benchmark::State& state) {
+    const auto request = MakeRequest(state);
+    server::http::impl::ParsedRequest parsed;
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(server::http::impl::ParseRequest(request, parsed));
+    }
+}
+
+// Copies the parsed parts into the request
+void http_request_constructor_from_parsed(benchmark::State& state) {
+    const auto request = MakeRequest(state);
+    server::http::impl::ParsedRequest parsed;
+    if (!server::http::impl::ParseRequest(request, parsed)) {
+        state.SkipWithError("failed to parse the request");
+        return;
+    }
+
+    const server::http::HandlerInfoIndex handler_info_index;
+    server::request::HttpRequestConfig config;
+    config.testing_mode = true;
+    server::request::ResponseDataAccounter data_accounter;
+
+    for ([[maybe_unused]] auto _ : state) {
+        server::http::HttpRequestConstructor constructor(config, handler_info_index, data_accounter, {});
+        constructor.SetMethod(parsed.method);
+        constructor.AppendUrl(parsed.url.data(), parsed.url.size());
+        constructor.SetHttpMajor(1);
+        constructor.SetHttpMinor(parsed.http_minor);
+        constructor.ParseUrl();
+        for (const auto& [field, value] : parsed.headers) {
+            constructor.AppendHeaderField(field.data(), field.size());
+            constructor.AppendHeaderValue(value.data(), value.size());
+        }
+        constructor.AppendHeaderField("", 0);
+        benchmark::DoNotOptimize(constructor.Finalize());
+    }
+}
+
 }  // namespace
 BENCHMARK(http_request_constructor_url_decode)->RangeMultiplier(2)->Range(1, 1024);
+// The argument is the number of headers: small and header-heavy requests
+BENCHMARK(http_request_constructor_fast_parse)->Arg(0)->Arg(4)->Arg(32);
+BENCHMARK(http_request_constructor_from_parsed)->Arg(0)->Arg(4)->Arg(32);
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,263 @@
+#include <server/http/http_request_fast_parser.hpp>
+
+#include <array>
+#include <optional>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <userver/utils/str_icase.hpp>
+#include <userver/utils/trivial_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+namespace {
+
+// CONNECT is an upgrade and is left for llhttp
+constexpr utils::TrivialBiMap kMethods = [](auto selector) {
+    return selector()
+        .Case("GET", HttpMethod::kGet)
+        .Case("POST", HttpMethod::kPost)
+        .Case("PUT", HttpMethod::kPut)
+        .Case("DELETE", HttpMethod::kDelete)
+        .Case("HEAD", HttpMethod::kHead)
+        .Case("PATCH", HttpMethod::kPatch)
+        .Case("OPTIONS", HttpMethod::kOptions);
+};
+
+enum class SpecialHeader {
+    kContentLength,
+    kTransferEncoding,
+    kConnection,
+    kUpgrade,
+};
+
+constexpr std::string_view kContentLength = "Content-Length";
+constexpr std::string_view kTransferEncoding = "Transfer-Encoding";
+constexpr std::string_view kConnection = "Connection";
+constexpr std::string_view kUpgrade = "Upgrade";
+
+constexpr utils::TrivialBiMap kConnectionOptions = [](auto selector) {
+    return selector().Case("close", false).Case("keep-alive", true);
+};
+
+// tchar, RFC 9110 5.6.2
+constexpr auto kTokenChars = [] {
+    std::array<bool, 256> table{};
+    for (char c = '0'; c <= '9'; ++c) table[static_cast<unsigned char>(c)] = true;
+    for (char c = 'a'; c <= 'z'; ++c) table[static_cast<unsigned char>(c)] = true;
+    for (char c = 'A'; c <= 'Z'; ++c) table[static_cast<unsigned char>(c)] = true;
+    for (const char c : std::string_view{"!#$%&'*+-.^_`|~"}) table[static_cast<unsigned char>(c)] = true;
+    return table;
+}();
+
+// More digits may overflow
+constexpr std::size_t kMaxContentLengthDigits = 18;
+
+bool IsControl(char c) noexcept {
+    const auto byte = static_cast<unsigned char>(c);
+    return (byte < 0x20 && byte != '\t') || byte == 0x7f;
+}
+
+// Returns the first control character in [begin, end) or `end`. HTAB is
+// allowed in the header values and is not considered a control character.
+const char* FindControl(const char* begin, const char* end) noexcept {
+#ifdef __SSE2__
+    const auto max_control = _mm_set1_epi8(0x1f);
+    const auto tab = _mm_set1_epi8('\t');
+    const auto del = _mm_set1_epi8(0x7f);
+    for (; end - begin >= 16; begin += 16) {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+        // there is no unsigned comparison in SSE2, min(x, 0x1f) == x is x <= 0x1f
+        const auto is_below_space = _mm_cmpeq_epi8(_mm_min_epu8(chunk, max_control), chunk);
+        const auto is_control = _mm_or_si128(
+            _mm_andnot_si128(_mm_cmpeq_epi8(chunk, tab), is_below_space), _mm_cmpeq_epi8(chunk, del)
+        );
+        const auto mask = _mm_movemask_epi8(is_control);
+        if (mask != 0) {
+            return begin + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+    }
+#endif
+    for (; begin != end; ++begin) {
+        if (IsControl(*begin)) {
+            return begin;
+        }
+    }
+    return end;
+}
+
+// Returns the line without CRLF and moves `pos` to the next line. Returns
+// std::nullopt if the line is incomplete or contains control characters.
+std::optional<std::string_view> ReadLine(const char*& pos, const char* end) noexcept {
+    const char* line_end = FindControl(pos, end);
+    if (end - line_end < 2 || line_end[0] != '\r' || line_end[1] != '\n') {
+        return std::nullopt;
+    }
+    const std::string_view line(pos, line_end - pos);
+    pos = line_end + 2;
+    return line;
+}
+
+bool IsToken(std::string_view value) noexcept {
+    if (value.empty()) {
+        return false;
+    }
+    for (const char c : value) {
+        if (!kTokenChars[static_cast<unsigned char>(c)]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ParseRequestLine(std::string_view line, ParsedRequest& request) noexcept {
+    const auto method_end = line.find(' ');
+    if (method_end == std::string_view::npos) {
+        return false;
+    }
+    const auto method = kMethods.TryFindByFirst(line.substr(0, method_end));
+    if (!method) {
+        return false;
+    }
+    request.method = *method;
+    line.remove_prefix(method_end + 1);
+
+    constexpr std::string_view kVersionPrefix = " HTTP/1.";
+    constexpr std::size_t kVersionSize = kVersionPrefix.size() + 1;
+    if (line.size() <= kVersionSize ||
+        line.substr(line.size() - kVersionSize, kVersionPrefix.size()) != kVersionPrefix) {
+        return false;
+    }
+    const char minor = line.back();
+    if (minor != '0' && minor != '1') {
+        return false;
+    }
+    request.http_minor = minor - '0';
+    request.keep_alive = minor == '1';
+
+    // request-target has no spaces and no control characters, the latter are
+    // already rejected by ReadLine. Non-ASCII is left for llhttp.
+    request.url = line.substr(0, line.size() - kVersionSize);
+    for (const char c : request.url) {
+        if (c == ' ' || static_cast<unsigned char>(c) >= 0x80) {
+            return false;
+        }
+    }
+    return !request.url.empty();
+}
+
+std::optional<std::size_t> ParseContentLength(std::string_view value) noexcept {
+    if (value.empty() || value.size() > kMaxContentLengthDigits) {
+        return std::nullopt;
+    }
+    std::size_t result = 0;
+    for (const char c : value) {
+        if (c < '0' || c > '9') {
+            return std::nullopt;
+        }
+        result = result * 10 + (c - '0');
+    }
+    return result;
+}
+
+// Most of the headers are not special, so the lengths are compared first
+std::optional<SpecialHeader> FindSpecialHeader(std::string_view name) noexcept {
+    const utils::StrIcaseEqual equal;
+    switch (name.size()) {
+        case kContentLength.size():
+            if (equal(name, kContentLength)) return SpecialHeader::kContentLength;
+            break;
+        case kTransferEncoding.size():
+            if (equal(name, kTransferEncoding)) return SpecialHeader::kTransferEncoding;
+            break;
+        case kConnection.size():
+            if (equal(name, kConnection)) return SpecialHeader::kConnection;
+            break;
+        case kUpgrade.size():
+            if (equal(name, kUpgrade)) return SpecialHeader::kUpgrade;
+            break;
+    }
+    return std::nullopt;
+}
+
+bool IsOws(char c) noexcept { return c == ' ' || c == '\t'; }
+
+}  // namespace
+
+bool ParseRequest(std::string_view data, ParsedRequest& request) {
+    const char* pos = data.data();
+    const char* const end = data.data() + data.size();
+
+    const auto request_line = ReadLine(pos, end);
+    if (!request_line || !ParseRequestLine(*request_line, request)) {
+        return false;
+    }
+
+    request.headers.clear();
+    std::optional<std::size_t> content_length;
+    while (true) {
+        const auto line = ReadLine(pos, end);
+        if (!line) {
+            return false;
+        }
+        if (line->empty()) {
+            break;
+        }
+
+        const auto colon = line->find(':');
+        if (colon == std::string_view::npos) {
+            return false;
+        }
+        const auto name = line->substr(0, colon);
+        auto value = line->substr(colon + 1);
+        while (!value.empty() && IsOws(value.front())) value.remove_prefix(1);
+        // Empty values and trailing whitespace are rare, llhttp reports those
+        // differently
+        if (!IsToken(name) || value.empty() || IsOws(value.back())) {
+            return false;
+        }
+
+        if (const auto special = FindSpecialHeader(name)) {
+            switch (*special) {
+                case SpecialHeader::kContentLength:
+                    if (content_length) {
+                        return false;
+                    }
+                    content_length = ParseContentLength(value);
+                    if (!content_length) {
+                        return false;
+                    }
+                    break;
+                case SpecialHeader::kConnection: {
+                    const auto keep_alive = kConnectionOptions.TryFindICaseByFirst(value);
+                    if (!keep_alive) {
+                        return false;
+                    }
+                    request.keep_alive = *keep_alive;
+                    break;
+                }
+                case SpecialHeader::kTransferEncoding:
+                case SpecialHeader::kUpgrade:
+                    return false;
+            }
+        }
+
+        request.headers.emplace_back(name, value);
+    }
+
+    const auto body_size = content_length.value_or(0);
+    if (static_cast<std::size_t>(end - pos) < body_size) {
+        return false;
+    }
+    request.body = std::string_view(pos, body_size);
+    request.size = pos + body_size - data.data();
+    return true;
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
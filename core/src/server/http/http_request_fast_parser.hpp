@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <userver/server/http/http_method.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+/// HTTP/1.x request parsed by ParseRequest, all the views point into the
+/// parsed data
+struct ParsedRequest {
+    HttpMethod method{HttpMethod::kUnknown};
+    unsigned short http_minor{1};
+    std::string_view url;
+    std::vector<std::pair<std::string_view, std::string_view>> headers;
+    std::string_view body;
+    bool keep_alive{true};
+    /// Size of the whole request, including the body
+    std::size_t size{0};
+};
+
+/// @brief Parses the HTTP/1.x request at the beginning of `data` without
+/// copying anything.
+///
+/// Only the common requests are handled: the request head and the body are
+/// complete in `data`, the body length is set by Content-Length, there is
+/// no protocol upgrade and the syntax is strict. Returns false for anything
+/// else, including the malformed requests, so that such data is left for
+/// llhttp that reports the errors.
+///
+/// `request` is reused between the calls to keep the headers storage.
+bool ParseRequest(std::string_view data, ParsedRequest& request);
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,160 @@
+#include <server/http/http_request_fast_parser.hpp>
+
+#include <vector>
+
+#include <server/http/create_parser_test.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kHttpRequestHeaders =
+    "POST /hello?arg=value HTTP/1.1\r\n"
+    "Host: localhost:11235\r\nUser-Agent:curl/7.58.0\r\n"
+    "X-Tabs:\tvalue\twith tabs\r\nContent-Length: 4\r\n\r\n"
+    "body";
+
+std::vector<std::shared_ptr<server::request::RequestBase>> ParseAll(
+    const std::vector<std::string_view>& pieces,
+    bool use_fast_parser,
+    bool expected_result = true
+) {
+    std::vector<std::shared_ptr<server::request::RequestBase>> requests;
+    auto parser = server::CreateTestParser(
+        [&requests](std::shared_ptr<server::request::RequestBase>&& request) {
+            requests.push_back(std::move(request));
+        },
+        USERVER_NAMESPACE::http::HttpVersion::k11,
+        use_fast_parser
+    );
+    for (const auto piece : pieces) {
+        EXPECT_EQ(parser->Parse(piece), expected_result);
+    }
+    return requests;
+}
+
+const server::http::HttpRequestImpl& AsHttpRequest(const server::request::RequestBase& request) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    return static_cast<const server::http::HttpRequestImpl&>(request);
+}
+
+// The fast parser must produce the same requests as llhttp
+void ExpectSameRequests(
+    const std::vector<std::shared_ptr<server::request::RequestBase>>& fast,
+    const std::vector<std::shared_ptr<server::request::RequestBase>>& llhttp
+) {
+    ASSERT_EQ(fast.size(), llhttp.size());
+    for (std::size_t i = 0; i < fast.size(); ++i) {
+        const auto& fast_request = AsHttpRequest(*fast[i]);
+        const auto& llhttp_request = AsHttpRequest(*llhttp[i]);
+        EXPECT_EQ(fast_request.GetMethod(), llhttp_request.GetMethod());
+        EXPECT_EQ(fast_request.GetUrl(), llhttp_request.GetUrl());
+        EXPECT_EQ(fast_request.GetHttpMinor(), llhttp_request.GetHttpMinor());
+        EXPECT_EQ(fast_request.GetHeaders(), llhttp_request.GetHeaders());
+        EXPECT_EQ(fast_request.RequestBody(), llhttp_request.RequestBody());
+        EXPECT_EQ(fast_request.IsFinal(), llhttp_request.IsFinal());
+        EXPECT_EQ(fast_request.ArgCount(), llhttp_request.ArgCount());
+    }
+}
+
+}  // namespace
+
+TEST(HttpRequestFastParser, Headers) {
+    server::http::impl::ParsedRequest request;
+    ASSERT_TRUE(server::http::impl::ParseRequest(kHttpRequestHeaders, request));
+
+    EXPECT_EQ(request.method, server::http::HttpMethod::kPost);
+    EXPECT_EQ(request.url, "/hello?arg=value");
+    EXPECT_EQ(request.http_minor, 1);
+    EXPECT_TRUE(request.keep_alive);
+    EXPECT_EQ(request.body, "body");
+    EXPECT_EQ(request.size, kHttpRequestHeaders.size());
+
+    using Header = std::pair<std::string_view, std::string_view>;
+    const std::vector<Header> expected_headers{
+        {"Host", "localhost:11235"},
+        {"User-Agent", "curl/7.58.0"},
+        {"X-Tabs", "value\twith tabs"},
+        {"Content-Length", "4"},
+    };
+    EXPECT_EQ(request.headers, expected_headers);
+}
+
+TEST(HttpRequestFastParser, KeepAlive) {
+    server::http::impl::ParsedRequest request;
+    ASSERT_TRUE(server::http::impl::ParseRequest("GET / HTTP/1.0\r\n\r\n", request));
+    EXPECT_FALSE(request.keep_alive);
+
+    ASSERT_TRUE(server::http::impl::ParseRequest("GET / HTTP/1.0\r\nConnection: Keep-Alive\r\n\r\n", request));
+    EXPECT_TRUE(request.keep_alive);
+
+    ASSERT_TRUE(server::http::impl::ParseRequest("GET / HTTP/1.1\r\nConnection: close\r\n\r\n", request));
+    EXPECT_FALSE(request.keep_alive);
+}
+
+TEST(HttpRequestFastParser, LeftForLlhttp) {
+    server::http::impl::ParsedRequest request;
+    for (const std::string_view data : {
+             "GET / HTTP/1.1\r\nHost: localhost",
+             "GET / HTTP/1.1\r\nHost: localhost\r\n\r",
+             "POST / HTTP/1.1\r\nContent-Length: 5\r\n\r\nbody",
+             "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n4\r\nbody\r\n0\r\n\r\n",
+             "POST / HTTP/1.1\r\nContent-Length: 4\r\nContent-Length: 4\r\n\r\nbody",
+             "POST / HTTP/1.1\r\nContent-Length: +4\r\n\r\nbody",
+             "GET / HTTP/1.1\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n\r\n",
+             "CONNECT localhost:443 HTTP/1.1\r\n\r\n",
+             "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n",
+             "GET / HTTP/1.1\nHost: localhost\n\n",
+             "GET / HTTP/1.1\r\nHost : localhost\r\n\r\n",
+             "GET / HTTP/1.1\r\nHost: local\x01host\r\n\r\n",
+             "GET / HTTP/1.1\r\nHost: localhost\r\n folded\r\n\r\n",
+             "GET /a b HTTP/1.1\r\n\r\n",
+             "\r\nGET / HTTP/1.1\r\n\r\n",
+         }) {
+        EXPECT_FALSE(server::http::impl::ParseRequest(data, request)) << data;
+    }
+}
+
+UTEST(HttpRequestFastParser, SameAsLlhttp) {
+    const std::vector<std::string_view> pieces{
+        kHttpRequestHeaders,
+        "GET /foo/bar?query1=value1&query2=value2 HTTP/1.1\r\nCookie: a=b; c=d\r\n\r\n",
+        "GET / HTTP/1.0\r\nConnection: keep-alive\r\nHost: localhost\r\n\r\n",
+        "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n4\r\nbody\r\n0\r\n\r\n",
+        "GET / HTTP/1.1\r\nConnection: close\r\n\r\n",
+    };
+    const auto fast = ParseAll(pieces, true);
+    ASSERT_EQ(fast.size(), pieces.size());
+    ExpectSameRequests(fast, ParseAll(pieces, false));
+}
+
+UTEST(HttpRequestFastParser, Pipelined) {
+    const std::string data = fmt::format("{}{}GET /last HTTP/1.1\r\n\r\n", kHttpRequestHeaders, kHttpRequestHeaders);
+    const auto fast = ParseAll({data}, true);
+    ASSERT_EQ(fast.size(), 3);
+    EXPECT_EQ(AsHttpRequest(*fast.back()).GetUrl(), "/last");
+    ExpectSameRequests(fast, ParseAll({data}, false));
+}
+
+UTEST(HttpRequestFastParser, PartialRequests) {
+    // The second request is split between the reads and is parsed by llhttp,
+    // the third one is complete again
+    const std::string first = fmt::format("{}POST / HTTP/1.1\r\nContent-Len", kHttpRequestHeaders);
+    const std::string second = "gth: 4\r\n\r\nbo";
+    const std::string third = fmt::format("dy{}", kHttpRequestHeaders);
+
+    const auto fast = ParseAll({first, second, third}, true);
+    ASSERT_EQ(fast.size(), 3);
+    EXPECT_EQ(AsHttpRequest(*fast[1]).RequestBody(), "body");
+    ExpectSameRequests(fast, ParseAll({first, second, third}, false));
+}
+
+UTEST(HttpRequestFastParser, DataAfterFinalRequest) {
+    const std::string data = fmt::format("GET / HTTP/1.1\r\nConnection: close\r\n\r\n{}", kHttpRequestHeaders);
+    const auto fast = ParseAll({data}, true, false);
+    ASSERT_EQ(fast.size(), 2);
+    EXPECT_TRUE(AsHttpRequest(*fast[0]).IsFinal());
+}
+
+USERVER_NAMESPACE_END
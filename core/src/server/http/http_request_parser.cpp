@@ -87,11 +87,13 @@ HttpRequestParser::HttpRequestParser(
     OnNewRequestCb&& on_new_request_cb,
     net::ParserStats& stats,
     request::ResponseDataAccounter& data_accounter,
-    engine::io::Sockaddr remote_address
+    engine::io::Sockaddr remote_address,
+    bool use_fast_parser
 )
     : handler_info_index_(handler_info_index),
       request_constructor_config_{request_config},
       on_new_request_cb_(std::move(on_new_request_cb)),
+      use_fast_parser_(use_fast_parser),
       stats_(stats),
       data_accounter_(data_accounter),
       remote_address_(std::move(remote_address)) {
@@ -100,6 +102,15 @@ HttpRequestParser::HttpRequestParser(
 }
 
 bool HttpRequestParser::Parse(std::string_view req) {
+    if (use_fast_parser_) {
+        if (!ParseFast(req)) {
+            return false;
+        }
+        if (req.empty()) {
+            return true;
+        }
+    }
+
     const auto err = llhttp_execute(&parser_, req.data(), req.size());
     if (parser_.upgrade && err == HPE_PAUSED_UPGRADE) {
         FinalizeRequest();
@@ -212,6 +223,10 @@ int HttpRequestParser::OnHeadersCompleteImpl(llhttp_t* p) {
         LOG_WARNING() << "can't append header value: " << ex;
         return -1;
     }
+    // The body may arrive in many reads, avoid reallocating it on each of them
+    if (p->flags & F_CONTENT_LENGTH) {
+        request_constructor_->ReserveBody(p->content_length);
+    }
     LOG_TRACE() << "headers complete";
     return 0;
 }
@@ -241,6 +256,54 @@ int HttpRequestParser::OnMessageCompleteImpl(llhttp_t* p) {
     return 0;
 }
 
+bool HttpRequestParser::ParseFast(std::string_view& req) {
+    // llhttp is in the middle of a request, it gets the rest of it
+    if (request_constructor_) {
+        return true;
+    }
+
+    while (!req.empty() && impl::ParseRequest(req, fast_parsed_request_)) {
+        req.remove_prefix(fast_parsed_request_.size);
+        if (!ProcessFastParsedRequest()) {
+            return false;
+        }
+        if (!fast_parsed_request_.keep_alive && !req.empty()) {
+            // llhttp fails on the data after `Connection: close` as well
+            LOG_WARNING() << "data after the final request, size=" << req.size();
+            FinalizeRequest();
+            return false;
+        }
+    }
+    return true;
+}
+
+bool HttpRequestParser::ProcessFastParsedRequest() {
+    const auto& parsed = fast_parsed_request_;
+    CreateRequestConstructor();
+    url_complete_ = true;
+    try {
+        request_constructor_->SetMethod(parsed.method);
+        request_constructor_->AppendUrl(parsed.url.data(), parsed.url.size());
+        request_constructor_->SetHttpMajor(1);
+        request_constructor_->SetHttpMinor(parsed.http_minor);
+        request_constructor_->ParseUrl();
+        for (const auto& [field, value] : parsed.headers) {
+            request_constructor_->AppendHeaderField(field.data(), field.size());
+            request_constructor_->AppendHeaderValue(value.data(), value.size());
+        }
+        request_constructor_->AppendHeaderField("", 0);
+        if (!parsed.body.empty()) {
+            request_constructor_->AppendBody(parsed.body.data(), parsed.body.size());
+        }
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "can't construct request: " << ex;
+        FinalizeRequest();
+        return false;
+    }
+    request_constructor_->SetIsFinal(!parsed.keep_alive);
+    return FinalizeRequest();
+}
+
 void HttpRequestParser::CreateRequestConstructor() {
     stats_.parsing_request_count.Add(1);
     request_constructor_.emplace(request_constructor_config_, handler_info_index_, data_accounter_, remote_address_);
@@ -14,6 +14,7 @@
 #include <userver/server/request/request_config.hpp>
 
 #include "http_request_constructor.hpp"
+#include "http_request_fast_parser.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -29,7 +30,8 @@ public:
         OnNewRequestCb&& on_new_request_cb,
         net::ParserStats& stats,
         request::ResponseDataAccounter& data_accounter,
-        engine::io::Sockaddr remote_address
+        engine::io::Sockaddr remote_address,
+        bool use_fast_parser = false
     );
 
     HttpRequestParser(HttpRequestParser&&) = delete;
@@ -54,6 +56,9 @@ private:
     int OnBodyImpl(llhttp_t* p, const char* data, size_t size);
     int OnMessageCompleteImpl(llhttp_t* p);
 
+    bool ParseFast(std::string_view& request);
+    bool ProcessFastParsedRequest();
+
     void CreateRequestConstructor();
 
     bool CheckUrlComplete(llhttp_t* p);
@@ -71,6 +76,9 @@ private:
     llhttp_t parser_{};
     std::optional<HttpRequestConstructor> request_constructor_;
 
+    const bool use_fast_parser_;
+    impl::ParsedRequest fast_parsed_request_;
+
     static const llhttp_settings_t parser_settings;
     net::ParserStats& stats_;
     request::ResponseDataAccounter& data_accounter_;
@@ -1,4 +1,4 @@
-#include <server/http/http_request_parser.hpp>
+#include <server/http/http_request_parser_benchmark.hpp>
 
 #include <benchmark/benchmark.h>
 
@@ -8,40 +8,17 @@ USERVER_NAMESPACE_BEGIN
 
 namespace {
 
-constexpr std::string_view kHttpRequestDataSmall = "GET / HTTP/1.1\r\n\r\n";
-
-constexpr std::string_view kHttpRequestDataMiddle =
-    "POST /hello HTTP/1.1\r\n"
-    "Host: localhost:11235\r\nUser-Agent: curl/7.58.0\r\nAccept: */*\r\n"
-    "Header1: Value1\r\nHeader2: Value2\r\nHeader3: Value3\r\n"
-    "Content-type: application/json\r\nContent-Length: 18\r\n\r\n"
-    "{\"hello\": \"world\"}";
+using server::http::bench::CreateBenchmarkParser;
+using server::http::bench::kHttpRequestDataHeaderHeavy;
+using server::http::bench::kHttpRequestDataMiddle;
+using server::http::bench::kHttpRequestDataSmall;
 
 constexpr size_t kEntryCount = 1024;
 
-inline server::http::HttpRequestParser CreateBenchmarkParser(server::http::HttpRequestParser::OnNewRequestCb&& cb) {
-    static const server::http::HandlerInfoIndex kTestHandlerInfoIndex;
-    static server::request::HttpRequestConfig kTestRequestConfig{
-        /*.max_url_size = */ 8192,
-        /*.max_request_size = */ 1024 * 1024,
-        /*.max_headers_size = */ 65536,
-        /*.parse_args_from_body = */ false,
-        /*.testing_mode = */ true,  // non default value
-        /*.decompress_request = */ false,
-        /* set_tracing_headers = */ true,
-        /* deadline_propagation_enabled = */ true,
-        /* deadline_expired_status_code = */ server::http::HttpStatus{498}};
-    static server::net::ParserStats test_stats;
-    static server::request::ResponseDataAccounter test_accounter;
-    return server::http::HttpRequestParser(
-        kTestHandlerInfoIndex, kTestRequestConfig, std::move(cb), test_stats, test_accounter, engine::io::Sockaddr{}
-    );
-}
-
 }  // namespace
 
 void http_request_parser_parse_benchmark_small(benchmark::State& state) {
-    auto parser = CreateBenchmarkParser([](std::shared_ptr<server::request::RequestBase>&&) {});
+    auto parser = CreateBenchmarkParser([](std::shared_ptr<server::request::RequestBase>&&) {}, state.range(0));
 
     for ([[maybe_unused]] auto _ : state) {
         parser.Parse(kHttpRequestDataSmall);
@@ -49,15 +26,23 @@ void http_request_parser_parse_benchmark_small(benchmark::State& state) {
 }
 
 void http_request_parser_parse_benchmark_middle(benchmark::State& state) {
-    auto parser = CreateBenchmarkParser([](std::shared_ptr<server::request::RequestBase>&&) {});
+    auto parser = CreateBenchmarkParser([](std::shared_ptr<server::request::RequestBase>&&) {}, state.range(0));
 
     for ([[maybe_unused]] auto _ : state) {
         parser.Parse(kHttpRequestDataMiddle);
     }
 }
 
+void http_request_parser_parse_benchmark_header_heavy(benchmark::State& state) {
+    auto parser = CreateBenchmarkParser([](std::shared_ptr<server::request::RequestBase>&&) {}, state.range(0));
+
+    for ([[maybe_unused]] auto _ : state) {
+        parser.Parse(kHttpRequestDataHeaderHeavy);
+    }
+}
+
 void http_request_parser_parse_benchmark_large_url(benchmark::State& state) {
-    auto parser = CreateBenchmarkParser([](std::shared_ptr<server::request::RequestBase>&&) {});
+    auto parser = CreateBenchmarkParser([](std::shared_ptr<server::request::RequestBase>&&) {}, state.range(0));
 
     std::string large_url;
     for (size_t i = 0; i < kEntryCount; ++i) {
@@ -71,7 +56,7 @@ void http_request_parser_parse_benchmark_large_url(benchmark::State& state) {
 }
 
 void http_request_parser_parse_benchmark_large_body(benchmark::State& state) {
-    auto parser = CreateBenchmarkParser([](std::shared_ptr<server::request::RequestBase>&&) {});
+    auto parser = CreateBenchmarkParser([](std::shared_ptr<server::request::RequestBase>&&) {}, state.range(0));
 
     std::string large_body;
     for (size_t i = 0; i < kEntryCount; ++i) {
@@ -90,7 +75,7 @@ void http_request_parser_parse_benchmark_large_body(benchmark::State& state) {
 }
 
 void http_request_parser_parse_benchmark_many_headers(benchmark::State& state) {
-    auto parser = CreateBenchmarkParser([](std::shared_ptr<server::request::RequestBase>&&) {});
+    auto parser = CreateBenchmarkParser([](std::shared_ptr<server::request::RequestBase>&&) {}, state.range(0));
 
     std::string headers;
     for (size_t i = 0; i < kEntryCount; ++i) {
@@ -107,10 +92,13 @@ void http_request_parser_parse_benchmark_many_headers(benchmark::State& state) {
     }
 }
 
-BENCHMARK(http_request_parser_parse_benchmark_small);
-BENCHMARK(http_request_parser_parse_benchmark_middle);
-BENCHMARK(http_request_parser_parse_benchmark_large_url);
-BENCHMARK(http_request_parser_parse_benchmark_large_body);
-BENCHMARK(http_request_parser_parse_benchmark_many_headers);
+// The argument is whether the fast parser is used
+BENCHMARK(http_request_parser_parse_benchmark_small)->Arg(false)->Arg(true);
+BENCHMARK(http_request_parser_parse_benchmark_middle)->Arg(false)->Arg(true);
+BENCHMARK(http_request_parser_parse_benchmark_header_heavy)->Arg(false)->Arg(true);
+BENCHMARK(http_request_parser_parse_benchmark_large_url)->Arg(false)->Arg(true);
+BENCHMARK(http_request_parser_parse_benchmark_large_body)->Arg(false)->Arg(true);
+BENCHMARK(http_request_parser_parse_benchmark_many_headers)->Arg(false)->Arg(true);
 
 USERVER_NAMESPACE_END
+
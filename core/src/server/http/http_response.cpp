@@ -88,6 +88,67 @@ void AppendToCharArray(char*& data, const std::string_view what) {
 
 const std::string kEmptyString{};
 
+// Small enough for the on-stack iovec array of engine::io::Socket::SendAll
+constexpr std::size_t kMaxChunksPerWrite = 8;
+
+// CRLF that ends the previous chunk, up to 16 hex digits of size and CRLF
+constexpr std::size_t kMaxChunkSizeLineSize = 20;
+
+// Batches the headers and the chunked transfer coding chunks to send them with
+// a single vectored write
+class ChunkedBodyWriter final {
+public:
+    explicit ChunkedBodyWriter(engine::io::RwBase& socket) : socket_(socket) {}
+
+    // `data` must stay alive until Flush()
+    void Add(std::string_view data) {
+        UASSERT(io_data_count_ < io_data_.size());
+        io_data_[io_data_count_++] = {data.data(), data.size()};
+    }
+
+    void AddChunk(std::string&& chunk) {
+        UASSERT(!IsFull());
+        UASSERT(!chunk.empty());
+        auto& size_line = size_lines_[chunks_count_];
+        // The CRLF after the headers is the delimiter for the first chunk
+        auto* const size_line_end = fmt::format_to(
+            size_line.data(), FMT_COMPILE("{}{:x}\r\n"), first_chunk_processed_ ? kCrlf : std::string_view{}, chunk.size()
+        );
+        chunks_[chunks_count_] = std::move(chunk);
+        Add({size_line.data(), static_cast<std::size_t>(size_line_end - size_line.data())});
+        Add(chunks_[chunks_count_]);
+        ++chunks_count_;
+        first_chunk_processed_ = true;
+    }
+
+    void AddTerminatingChunk() {
+        const std::string_view terminating_chunk{first_chunk_processed_ ? "\r\n0\r\n\r\n" : "0\r\n\r\n"};
+        Add(terminating_chunk);
+    }
+
+    bool IsFull() const { return chunks_count_ == kMaxChunksPerWrite; }
+
+    std::size_t Flush() {
+        if (io_data_count_ == 0) {
+            return 0;
+        }
+        const auto sent_bytes = socket_.WriteAll(io_data_.data(), io_data_count_, engine::Deadline{});
+        io_data_count_ = 0;
+        chunks_count_ = 0;
+        return sent_bytes;
+    }
+
+private:
+    engine::io::RwBase& socket_;
+    std::array<std::string, kMaxChunksPerWrite> chunks_;
+    std::array<std::array<char, kMaxChunkSizeLineSize>, kMaxChunksPerWrite> size_lines_{};
+    // headers, size line and data of every chunk, terminating chunk
+    std::array<engine::io::IoData, kMaxChunksPerWrite * 2 + 2> io_data_{};
+    std::size_t io_data_count_{0};
+    std::size_t chunks_count_{0};
+    bool first_chunk_processed_{false};
+};
+
 }  // namespace
 
 namespace server::http {
@@ -219,6 +280,15 @@ const std::string& HttpResponse::GetHeader(const USERVER_NAMESPACE::http::header
     return it->second;
 }
 
+void HttpResponse::SetSharedData(std::shared_ptr<const std::string> data) { SetSharedBody(std::move(data)); }
+
+bool HttpResponse::HasSharedData() const noexcept { return GetSharedBody() != nullptr; }
+
+const std::string& HttpResponse::GetBodyData() const {
+    const auto& shared_body = GetSharedBody();
+    return shared_body ? *shared_body : GetData();
+}
+
 bool HttpResponse::HasHeader(std::string_view header_name) const {
     return headers_.find(header_name) != headers_.end();
 }
@@ -303,11 +373,14 @@ std::size_t
 HttpResponse::SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header) {
     const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
     const bool is_head_request = request_.GetMethod() == HttpMethod::kHead;
-    const auto& data = GetData();
+    const auto& data = GetBodyData();
 
     if (!is_body_forbidden) {
+        const fmt::format_int content_length{data.size()};
         impl::OutputHeader(
-            header, USERVER_NAMESPACE::http::headers::kContentLength, fmt::format(FMT_COMPILE("{}"), data.size())
+            header,
+            USERVER_NAMESPACE::http::headers::kContentLength,
+            std::string_view{content_length.data(), content_length.size()}
         );
     }
     header.append(kCrlf);
@@ -336,36 +409,46 @@ HttpResponse::SetBodyStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::htt
     // headers end marker
     header.append(kCrlf);
 
-    // send HTTP headers
-    size_t sent_bytes = socket.WriteAll(header.data(), header.size(), {});
-    header.clear();
-    header.shrink_to_fit();  // free memory before time-consuming operation
-
     if (is_body_forbidden) {
-        return sent_bytes;
+        return socket.WriteAll(header.data(), header.size(), {});
     }
 
+    // The headers go along with the chunks that are already in the queue, or
+    // right away if there are none, so that the client does not wait for a
+    // slow first chunk
+    ChunkedBodyWriter writer{socket};
+    writer.Add({header.data(), header.size()});
+    std::size_t sent_bytes = 0;
+    const auto flush = [&] {
+        sent_bytes += writer.Flush();
+        if (!header.empty()) {
+            header.clear();
+            header.shrink_to_fit();  // free memory before time-consuming operation
+        }
+    };
+
     // Transmit HTTP response body
     std::string body_part;
-    // First chunk must be sent without kCrlf
-    // because kCrlf was sent with headers
-    bool first_chunk_processed = false;
-    while (body_stream_->Pop(body_part)) {
+    while (true) {
+        if (!body_stream_->PopNoblock(body_part)) {
+            flush();
+            if (!body_stream_->Pop(body_part)) {
+                break;
+            }
+        }
         if (body_part.empty()) {
             LOG_DEBUG() << "Zero size body_part in http_response.cpp";
             continue;
         }
 
-        auto size = first_chunk_processed ? fmt::format("\r\n{:x}\r\n", body_part.size())
-                                          : fmt::format("{:x}\r\n", body_part.size());
-        sent_bytes +=
-            socket.WriteAll({{size.data(), size.size()}, {body_part.data(), body_part.size()}}, engine::Deadline{});
-
-        first_chunk_processed = true;
+        writer.AddChunk(std::move(body_part));
+        if (writer.IsFull()) {
+            flush();
+        }
     }
 
-    const std::string_view terminating_chunk{first_chunk_processed ? "\r\n0\r\n\r\n" : "0\r\n\r\n"};
-    sent_bytes += socket.WriteAll(terminating_chunk.data(), terminating_chunk.size(), {});
+    writer.AddTerminatingChunk();
+    flush();
 
     // TODO: exceptions?
     body_stream_producer_.emplace<std::monostate>();
@@ -1,8 +1,10 @@
 #include <benchmark/benchmark.h>
 
 #include <fmt/compile.h>
+#include <memory>
 #include <sstream>
 
+#include <userver/engine/io/common.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/http/http_status.hpp>
@@ -135,11 +137,68 @@ void HttpResponseSetHeaderBenchmark(benchmark::State& state) {
     }
 }
 
+// Discards everything that is written
+class NullSocket final : public engine::io::RwBase {
+public:
+    bool IsValid() const override { return true; }
+    bool WaitReadable(engine::Deadline) override { return false; }
+    size_t ReadSome(void*, size_t, engine::Deadline) override { return 0; }
+    size_t ReadAll(void*, size_t, engine::Deadline) override { return 0; }
+    bool WaitWriteable(engine::Deadline) override { return true; }
+
+    size_t WriteAll(const void*, size_t len, engine::Deadline) override {
+        ++writes_count_;
+        return len;
+    }
+
+    size_t WriteAll(const engine::io::IoData* list, std::size_t list_size, engine::Deadline) override {
+        ++writes_count_;
+        std::size_t result = 0;
+        for (std::size_t i = 0; i < list_size; ++i) {
+            result += list[i].len;
+        }
+        return result;
+    }
+
+    std::size_t GetWritesCount() const { return writes_count_; }
+
+private:
+    std::size_t writes_count_{0};
+};
+
+// Static files handler use case: the body is owned by a cache
+template <bool IsSharedData>
+void http_response_send_body(benchmark::State& state) {
+    server::request::ResponseDataAccounter accounter{};
+    const server::http::HttpRequestImpl request_impl{accounter, engine::io::Sockaddr{}};
+    const auto body = std::make_shared<const std::string>(state.range(0), 'a');
+    NullSocket socket;
+
+    for ([[maybe_unused]] auto _ : state) {
+        server::http::HttpResponse response{request_impl, accounter};
+        response.SetHeader(USERVER_NAMESPACE::http::headers::kContentType, std::string{"text/html"});
+        if constexpr (IsSharedData) {
+            response.SetData({});
+            response.SetSharedData(body);
+        } else {
+            response.SetData(*body);
+        }
+        response.SendResponse(socket);
+    }
+
+    state.counters["writes_per_response"] = benchmark::Counter(
+        static_cast<double>(socket.GetWritesCount()), benchmark::Counter::kAvgIterations
+    );
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
 }  // namespace
 
 BENCHMARK(http_headers_serialization_inplace);
 BENCHMARK(http_headers_serialization_no_ostreams);
 BENCHMARK(http_headers_serialization_ostreams);
 BENCHMARK(HttpResponseSetHeaderBenchmark);
+BENCHMARK_TEMPLATE(http_response_send_body, false)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(http_response_send_body, true)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
 
 USERVER_NAMESPACE_END
@@ -1,19 +1,41 @@
 #include <userver/server/http/http_response_body_stream.hpp>
 
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/overloaded.hpp>
 
+#include <server/http/content_encoding.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::http {
 
 ResponseBodyStream::ResponseBodyStream(
     server::http::HttpResponse::Producer&& queue_producer,
-    server::http::HttpResponse& http_response
+    server::http::HttpResponse& http_response,
+    std::unique_ptr<impl::BodyStreamCompressor> compressor
 )
-    : queue_producer_(std::move(queue_producer)), http_response_(http_response) {}
+    : queue_producer_(std::move(queue_producer)), http_response_(http_response), compressor_(std::move(compressor)) {}
+
+ResponseBodyStream::ResponseBodyStream(ResponseBodyStream&&) noexcept = default;
 
 ResponseBodyStream::~ResponseBodyStream() {
+    if (headers_ended_ && compressor_) {
+        try {
+            auto tail = compressor_->Finish();
+            // Do not wait for a stalled client forever
+            const auto deadline =
+                last_deadline_.IsReachable() ? last_deadline_ : server::request::GetTaskInheritedDeadline();
+            if (!tail.empty() && !PushChunk(std::move(tail), deadline)) {
+                LOG_WARNING() << "Failed to send the tail of the compressed response body";
+            }
+        } catch (const std::exception& e) {
+            LOG_ERROR() << "Failed to finish the response body compression: " << e;
+        }
+    }
+
     if (http_response_.GetStreamId().has_value()) {
         UASSERT(queue_producer_.index() == 2);
         std::get<impl::Http2StreamEventProducer>(queue_producer_).CloseStream(*http_response_.GetStreamId());
@@ -22,17 +44,29 @@ ResponseBodyStream::~ResponseBodyStream() {
 
 void ResponseBodyStream::PushBodyChunk(std::string&& chunk, engine::Deadline deadline) {
     UASSERT_MSG(headers_ended_, "SetEndOfHeaders() was not called before PushBodyChunk()");
-    std::visit(
+    last_deadline_ = deadline;
+    if (compressor_) {
+        chunk = compressor_->Compress(chunk);
+        if (chunk.empty()) {
+            return;
+        }
+    }
+    [[maybe_unused]] const bool success = PushChunk(std::move(chunk), deadline);
+    UASSERT(success);
+}
+
+bool ResponseBodyStream::PushChunk(std::string&& chunk, engine::Deadline deadline) {
+    return std::visit(
         utils::Overloaded{
             [&chunk, &deadline](HttpResponse::Queue::Producer& queue_producer) mutable {
-                const bool success = queue_producer.Push(std::move(chunk), deadline);
-                UASSERT(success);
+                return queue_producer.Push(std::move(chunk), deadline);
             },
             [this, &chunk, &deadline](impl::Http2StreamEventProducer& queue_producer) mutable {
                 UASSERT(http_response_.GetStreamId().has_value());
                 queue_producer.PushEvent({*http_response_.GetStreamId(), std::move(chunk)}, deadline);
+                return true;
             },
-            [](std::monostate) { UINVARIANT(false, "unreachable"); }},
+            [](std::monostate) -> bool { UINVARIANT(false, "unreachable"); }},
         queue_producer_
     );
 }
@@ -46,6 +80,16 @@ void ResponseBodyStream::SetHeader(std::string_view name, const std::string& val
 }
 
 void ResponseBodyStream::SetEndOfHeaders() {
+    if (compressor_) {
+        // Same rules as for the buffered bodies, except for the size that is unknown
+        if (!impl::IsCompressibleResponse(http_response_)) {
+            compressor_.reset();
+        } else {
+            http_response_.SetContentEncoding(std::string{impl::ToString(compressor_->GetEncoding())});
+            impl::AddVaryAcceptEncoding(http_response_);
+        }
+    }
+
     headers_ended_ = true;
     http_response_.SetHeadersEnd();
 }
@@ -41,6 +41,101 @@ UTEST(HttpResponse, Smoke) {
     EXPECT_EQ(reply.substr(reply.size() - 4 - kBody.size()), fmt::format("\r\n\r\n{}", kBody));
 }
 
+UTEST(HttpResponse, SharedData) {
+    const auto test_deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    server::request::ResponseDataAccounter accounter;
+    server::http::HttpRequestImpl request{accounter, engine::io::Sockaddr{}};
+    server::http::HttpResponse response{request, accounter};
+
+    const auto body = std::make_shared<const std::string>("shared data");
+    response.SetData({});
+    response.SetSharedData(body);
+    EXPECT_EQ(&response.GetBodyData(), body.get());
+
+    auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+    auto send_task = engine::AsyncNoSpan(
+        [](auto&& response, auto&& socket) { response.SendResponse(socket); }, std::ref(response), std::move(server)
+    );
+
+    std::vector<char> buffer(4096, '\0');
+    const auto reply_size = client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+
+    std::string_view reply{buffer.data(), reply_size};
+    const auto expected_content_length = fmt::format("\r\n{}: {}\r\n", http::headers::kContentLength, body->size());
+    EXPECT_TRUE(reply.find(expected_content_length) != std::string_view::npos);
+    EXPECT_EQ(reply.substr(reply.size() - 4 - body->size()), fmt::format("\r\n\r\n{}", *body));
+}
+
+UTEST(HttpResponse, SharedDataDiscardedOnError) {
+    const auto test_deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    server::request::ResponseDataAccounter accounter;
+    const server::http::HttpRequestImpl request{accounter, engine::io::Sockaddr{}};
+    auto& response = request.GetHttpResponse();
+
+    const auto body = std::make_shared<const std::string>("shared data");
+    response.SetSharedData(body);
+    EXPECT_TRUE(response.HasSharedData());
+
+    // What the handler base does when the handler throws after setting the body
+    request.MarkAsInternalServerError();
+    EXPECT_FALSE(response.HasSharedData());
+    EXPECT_EQ(response.GetBodyData(), "");
+
+    auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+    auto send_task = engine::AsyncNoSpan(
+        [](auto&& response, auto&& socket) { response.SendResponse(socket); }, std::ref(response), std::move(server)
+    );
+
+    std::vector<char> buffer(4096, '\0');
+    const auto reply_size = client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+
+    const std::string_view reply{buffer.data(), reply_size};
+    constexpr std::string_view expected_header = "HTTP/1.1 500 Internal Server Error\r\n";
+    ASSERT_EQ(reply.substr(0, expected_header.size()), expected_header);
+    EXPECT_TRUE(reply.find(fmt::format("\r\n{}: 0\r\n", http::headers::kContentLength)) != std::string_view::npos);
+    EXPECT_EQ(reply.find(*body), std::string_view::npos);
+}
+
+UTEST(HttpResponse, StreamedChunks) {
+    const auto test_deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    server::request::ResponseDataAccounter accounter;
+    server::http::HttpRequestImpl request{accounter, engine::io::Sockaddr{}};
+    server::http::HttpResponse response{request, accounter};
+
+    response.SetData({});
+    response.SetStreamBody();
+    {
+        auto producer = std::get<server::http::HttpResponse::Queue::Producer>(response.GetBodyProducer());
+        // More chunks than fit into a single write
+        for (int i = 0; i < 20; ++i) {
+            ASSERT_TRUE(producer.Push(std::string(i + 1, 'a'), test_deadline));
+        }
+    }
+
+    auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+    auto send_task = engine::AsyncNoSpan(
+        [](auto&& response, auto&& socket) { response.SendResponse(socket); }, std::ref(response), std::move(server)
+    );
+
+    std::vector<char> buffer(4096, '\0');
+    const auto reply_size = client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+
+    std::string_view reply{buffer.data(), reply_size};
+    const auto headers_end = reply.find("\r\n\r\n");
+    ASSERT_NE(headers_end, std::string_view::npos);
+    EXPECT_TRUE(reply.substr(0, headers_end).find("Transfer-Encoding: chunked") != std::string_view::npos);
+
+    std::string expected_body;
+    for (int i = 0; i < 20; ++i) {
+        expected_body += fmt::format("{:x}\r\n{}\r\n", i + 1, std::string(i + 1, 'a'));
+    }
+    expected_body += "0\r\n\r\n";
+    EXPECT_EQ(reply.substr(headers_end + 4), expected_body);
+}
+
 UTEST(HttpResponse, AccounterLifetimeIfNotSent) {
     auto accounter = std::make_unique<server::request::ResponseDataAccounter>();
     const server::http::HttpRequestImpl request{*accounter, engine::io::Sockaddr{}};
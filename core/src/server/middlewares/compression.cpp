@@ -0,0 +1,175 @@
+#include <server/middlewares/compression.hpp>
+
+#include <server/request/internal_request_context.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/request/request_context.hpp>
+#include <userver/tracing/scope_time.hpp>
+#include <userver/utils/text_light.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+namespace {
+
+constexpr std::string_view kSettingsSchema = R"(
+type: object
+description: response bodies compression settings
+additionalProperties: false
+properties:
+    enabled:
+        type: boolean
+        description: compress the response bodies if the client accepts it
+        defaultDescription: false
+    min-size:
+        type: integer
+        description: do not compress the response bodies smaller than this
+        defaultDescription: 1024
+        minimum: 0
+    encodings:
+        type: array
+        description: content codings in the order of server preference
+        defaultDescription: '[zstd, gzip]'
+        items:
+            type: string
+            description: content coding
+            enum:
+              - gzip
+              - zstd
+    gzip-level:
+        type: integer
+        description: gzip compression level
+        defaultDescription: 6
+        minimum: 1
+        maximum: 9
+    zstd-level:
+        type: integer
+        description: zstd compression level
+        defaultDescription: 3
+        minimum: 1
+        maximum: 22
+    compress-stream:
+        type: boolean
+        description: |
+            compress the bodies of the handlers with `response-body-stream: true`,
+            every chunk is flushed to the client as is
+        defaultDescription: true
+)";
+
+CompressionSettings ParseSettings(const yaml_config::YamlConfig& config, const CompressionSettings& defaults) {
+    CompressionSettings settings;
+    settings.enabled = config["enabled"].As<bool>(defaults.enabled);
+    settings.min_size = config["min-size"].As<std::size_t>(defaults.min_size);
+    settings.encodings = config["encodings"].As<std::vector<http::impl::ContentEncoding>>(defaults.encodings);
+    settings.gzip_level = config["gzip-level"].As<int>(defaults.gzip_level);
+    settings.zstd_level = config["zstd-level"].As<int>(defaults.zstd_level);
+    settings.compress_stream = config["compress-stream"].As<bool>(defaults.compress_stream);
+    return settings;
+}
+
+// A compressed representation is not byte-for-byte equal to the original one,
+// RFC 9110 8.8.3.3
+void WeakenETag(http::HttpResponse& response) {
+    const auto& etag = response.GetHeader(USERVER_NAMESPACE::http::headers::kETag);
+    if (!etag.empty() && !utils::text::StartsWith(etag, "W/")) {
+        response.SetHeader(USERVER_NAMESPACE::http::headers::kETag, "W/" + etag);
+    }
+}
+
+}  // namespace
+
+Compression::Compression(CompressionSettings settings) : settings_{std::move(settings)} {}
+
+void Compression::HandleRequest(http::HttpRequest& request, request::RequestContext& context) const {
+    if (!settings_.enabled) {
+        Next(request, context);
+        return;
+    }
+
+    const auto compression = NegotiateCompression(request);
+    if (compression && settings_.compress_stream) {
+        // Only used if the handler streams the response body, see
+        // HttpHandlerBase::HandleRequestStream
+        context.GetInternalContext().SetResponseStreamCompression(*compression);
+    }
+
+    Next(request, context);
+
+    auto& response = request.GetHttpResponse();
+    if (!response.IsBodyStreamed()) {
+        CompressResponse(response, compression);
+    }
+}
+
+std::optional<http::impl::BodyCompression> Compression::NegotiateCompression(const http::HttpRequest& request) const {
+    const auto encoding = http::impl::NegotiateContentEncoding(
+        request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding), settings_.encodings
+    );
+    if (!encoding) {
+        return std::nullopt;
+    }
+
+    switch (*encoding) {
+        case http::impl::ContentEncoding::kGzip:
+            return http::impl::BodyCompression{*encoding, settings_.gzip_level};
+        case http::impl::ContentEncoding::kZstd:
+            return http::impl::BodyCompression{*encoding, settings_.zstd_level};
+    }
+    UINVARIANT(false, "Unknown content encoding");
+}
+
+void Compression::CompressResponse(
+    http::HttpResponse& response,
+    const std::optional<http::impl::BodyCompression>& compression
+) const {
+    const auto& data = response.GetBodyData();
+    if (data.size() < settings_.min_size || !http::impl::IsCompressibleResponse(response)) {
+        return;
+    }
+
+    // The representation depends on Accept-Encoding even if the client did not
+    // accept any of our codings
+    http::impl::AddVaryAcceptEncoding(response);
+    if (!compression) {
+        return;
+    }
+
+    const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime("http_compress_response_body");
+    auto compressed = http::impl::Compress(*compression, data);
+    if (compressed.size() >= data.size()) {
+        return;
+    }
+
+    response.SetData(std::move(compressed));
+    response.SetContentEncoding(std::string{http::impl::ToString(compression->encoding)});
+    WeakenETag(response);
+}
+
+CompressionFactory::CompressionFactory(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context
+)
+    : HttpMiddlewareFactoryBase{config, context}, settings_{ParseSettings(config, CompressionSettings{})} {}
+
+std::unique_ptr<HttpMiddlewareBase>
+CompressionFactory::Create(const handlers::HttpHandlerBase&, yaml_config::YamlConfig middleware_config) const {
+    return std::make_unique<Compression>(ParseSettings(middleware_config, settings_));
+}
+
+yaml_config::Schema CompressionFactory::GetMiddlewareConfigSchema() const {
+    return formats::yaml::FromString(std::string{kSettingsSchema}).As<yaml_config::Schema>();
+}
+
+yaml_config::Schema CompressionFactory::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<components::ComponentBase>(std::string{kSettingsSchema});
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <userver/server/middlewares/builtin.hpp>
+#include <userver/server/middlewares/http_middleware_base.hpp>
+
+#include <server/http/content_encoding.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+class HttpResponse;
+}
+
+namespace server::middlewares {
+
+struct CompressionSettings final {
+    bool enabled{false};
+    std::size_t min_size{1024};
+    std::vector<http::impl::ContentEncoding> encodings{
+        http::impl::ContentEncoding::kZstd,
+        http::impl::ContentEncoding::kGzip,
+    };
+    int gzip_level{compression::gzip::kDefaultCompressionLevel};
+    int zstd_level{compression::zstd::kDefaultCompressionLevel};
+    bool compress_stream{true};
+};
+
+/// Compresses the response bodies with the coding negotiated via the
+/// Accept-Encoding request header
+class Compression final : public HttpMiddlewareBase {
+public:
+    static constexpr std::string_view kName = builtin::kCompression;
+
+    explicit Compression(CompressionSettings settings);
+
+private:
+    void HandleRequest(http::HttpRequest& request, request::RequestContext& context) const override;
+
+    std::optional<http::impl::BodyCompression> NegotiateCompression(const http::HttpRequest& request) const;
+
+    void CompressResponse(http::HttpResponse& response, const std::optional<http::impl::BodyCompression>& compression)
+        const;
+
+    const CompressionSettings settings_;
+};
+
+class CompressionFactory final : public HttpMiddlewareFactoryBase {
+public:
+    static constexpr std::string_view kName = Compression::kName;
+
+    CompressionFactory(const components::ComponentConfig&, const components::ComponentContext&);
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    std::unique_ptr<HttpMiddlewareBase>
+    Create(const handlers::HttpHandlerBase&, yaml_config::YamlConfig middleware_config) const override;
+
+    yaml_config::Schema GetMiddlewareConfigSchema() const override;
+
+    const CompressionSettings settings_;
+};
+
+}  // namespace server::middlewares
+
+template <>
+inline constexpr bool components::kHasValidate<server::middlewares::CompressionFactory> = true;
+
+template <>
+inline constexpr auto components::kConfigFileMode<server::middlewares::CompressionFactory> =
+    ConfigFileMode::kNotRequired;
+
+USERVER_NAMESPACE_END
@@ -8,6 +8,7 @@
 
 #include <server/middlewares/auth.hpp>
 #include <server/middlewares/baggage.hpp>
+#include <server/middlewares/compression.hpp>
 #include <server/middlewares/deadline_propagation.hpp>
 #include <server/middlewares/decompression.hpp>
 #include <server/middlewares/exceptions_handling.hpp>
@@ -25,6 +26,9 @@ MiddlewaresList DefaultPipeline() {
     return {
         // Metrics should go before everything else, basically.
         std::string{builtin::kHandlerMetrics},
+        // Compression should go before tracing for the latter to log the
+        // response body as is
+        std::string{builtin::kCompression},
         // Tracing should go before UnknownExceptionsHandlingMiddleware because it
         // adds some headers, which otherwise might be cleared
         std::string{builtin::kTracing},
@@ -67,6 +71,7 @@ components::ComponentList DefaultMiddlewareComponents() {
         .Append<AuthFactory>()
         .Append<DeadlinePropagationFactory>()
         .Append<DecompressionFactory>()
+        .Append<CompressionFactory>()
         .Append<SetAcceptEncodingFactory>()
         .Append<ExceptionsHandlingFactory>()
         .Append<UnknownExceptionsHandlingFactory>()
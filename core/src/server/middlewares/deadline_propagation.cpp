@@ -219,12 +219,12 @@ void DeadlinePropagation::CompleteDeadlinePropagation(
     if (cancelled_by_deadline && !dp_scope.shared_dp_context.IsCancelledByDeadline()) {
         dp_scope.shared_dp_context.SetCancelledByDeadline();
 
-        const auto& original_body = response.GetData();
+        const auto& original_body = response.GetBodyData();
         if (!original_body.empty() && span_opt && span_opt->ShouldLogDefault()) {
             span_opt->AddNonInheritableTag("dp_original_body_size", original_body.size());
             if (dp_scope.need_log_response) {
                 span_opt->AddNonInheritableTag(
-                    "dp_original_body", handler_.GetResponseDataForLoggingChecked(request, context, response.GetData())
+                    "dp_original_body", handler_.GetResponseDataForLoggingChecked(request, context, original_body)
                 );
             }
         }
@@ -140,7 +140,7 @@ void Tracing::EnrichLogs(
                 span.AddNonInheritableTag("response_headers", GetHeadersLogString(response));
             }
             span.AddNonInheritableTag(
-                kTracingBody, handler_.GetResponseDataForLoggingChecked(request, context, response.GetData())
+                kTracingBody, handler_.GetResponseDataForLoggingChecked(request, context, response.GetBodyData())
             );
         }
         span.AddNonInheritableTag(kTracingUri, request.GetUrl());
@@ -402,7 +402,8 @@ std::unique_ptr<request::RequestParser> Connection::MakeParser(USERVER_NAMESPACE
         on_req_cb,
         stats_->parser_stats,
         data_accounter_,
-        remote_address_
+        remote_address_,
+        config_.http1_fast_parser
     );
 }
 
@@ -1,16 +1,41 @@
 #include <server/net/connection_config.hpp>
 
+#include <stdexcept>
+
+#include <fmt/format.h>
+#include <nghttp2/nghttp2.h>
+
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+namespace {
+
+// Window sizes are int32 in nghttp2 and are limited by RFC 9113
+std::uint32_t ParseWindowSize(const yaml_config::YamlConfig& value, std::uint32_t default_value) {
+    const auto window_size = value.As<std::uint32_t>(default_value);
+    if (window_size > NGHTTP2_MAX_WINDOW_SIZE) {
+        throw std::runtime_error(
+            fmt::format("Invalid window size {} in {}, max is {}", window_size, value.GetPath(), NGHTTP2_MAX_WINDOW_SIZE)
+        );
+    }
+    return window_size;
+}
+
+}  // namespace
+
 Http2SessionConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Http2SessionConfig>) {
     Http2SessionConfig conf{};
     conf.max_concurrent_streams = value["max_concurrent_streams"].As<std::uint32_t>(conf.max_concurrent_streams);
     conf.max_frame_size = value["max_frame_size"].As<std::uint32_t>(conf.max_frame_size);
-    conf.initial_window_size = value["initial_window_size"].As<std::uint32_t>(conf.initial_window_size);
+    conf.initial_window_size = ParseWindowSize(value["initial_window_size"], conf.initial_window_size);
+    conf.connection_window_size = ParseWindowSize(value["connection_window_size"], conf.connection_window_size);
+    conf.window_auto_tuning = value["window_auto_tuning"].As<bool>(conf.window_auto_tuning);
+    conf.max_connection_window_size =
+        ParseWindowSize(value["max_connection_window_size"], conf.max_connection_window_size);
+    conf.rfc9218_priorities = value["rfc9218_priorities"].As<bool>(conf.rfc9218_priorities);
     return conf;
 }
 
@@ -28,6 +53,8 @@ ConnectionConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<
 
     config.http_version = value["http-version"].As<USERVER_NAMESPACE::http::HttpVersion>(config.http_version);
 
+    config.http1_fast_parser = value["http1-fast-parser"].As<bool>(config.http1_fast_parser);
+
     config.http2_session_config = value["http2-session"].As<Http2SessionConfig>(config.http2_session_config);
 
     return config;
@@ -22,6 +22,10 @@ struct Http2SessionConfig final {
     std::uint32_t max_concurrent_streams = 100;
     std::uint32_t max_frame_size = 1 << 14;
     std::uint32_t initial_window_size = 1 << 16;
+    std::uint32_t connection_window_size = 1 << 16;
+    bool window_auto_tuning = false;
+    std::uint32_t max_connection_window_size = 1 << 24;
+    bool rfc9218_priorities = false;
 };
 
 struct ConnectionConfig {
@@ -30,6 +34,7 @@ struct ConnectionConfig {
     std::chrono::seconds keepalive_timeout{10 * 60};
     std::chrono::milliseconds abort_check_delay{kDefaultAbortCheckDelay};
     USERVER_NAMESPACE::http::HttpVersion http_version = USERVER_NAMESPACE::http::HttpVersion::k11;
+    bool http1_fast_parser = false;
     Http2SessionConfig http2_session_config;
 };
 
@@ -1,5 +1,12 @@
 #include "create_socket.hpp"
 
+#include <sys/socket.h>
+
+#ifdef __linux__
+#include <linux/filter.h>
+#endif
+
+#include <array>
 #include <string>
 
 #include <fmt/format.h>
@@ -11,6 +18,8 @@
 #include <userver/fs/blocking/write.hpp>
 #include <userver/net/blocking/get_addr_info.hpp>
 
+#include <utils/check_syscall.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
@@ -62,13 +71,46 @@ engine::io::Socket CreateIpv6Socket(const std::string& address, uint16_t port, i
     return socket;
 }
 
+// The kernel passes a new connection to the socket with the index returned by
+// the program in the SO_REUSEPORT group, sockets are indexed in the order
+// they joined the group. Out of range index makes the kernel fall back to the
+// hash based selection.
+void AttachCpuSteeringProgram(engine::io::Socket& socket, std::size_t shards_count) {
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+    std::array<sock_filter, 3> code{{
+        // A = the CPU that processes the connection
+        {BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+        // A %= shards_count
+        {BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<std::uint32_t>(shards_count)},
+        // return A
+        {BPF_RET | BPF_A, 0, 0, 0},
+    }};
+    sock_fprog program{static_cast<unsigned short>(code.size()), code.data()};
+    utils::CheckSyscall(
+        ::setsockopt(socket.Fd(), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, sizeof(program)),
+        "attaching the SO_REUSEPORT CPU steering program, fd={}",
+        socket.Fd()
+    );
+#else
+    static_cast<void>(socket);
+    static_cast<void>(shards_count);
+    throw std::runtime_error("'reuseport-steering: cpu' is not supported on the target platform");
+#endif
+}
+
 }  // namespace
 
-engine::io::Socket CreateSocket(const ListenerConfig& config) {
-    if (config.unix_socket_path.empty())
-        return CreateIpv6Socket(config.address, config.port, config.backlog);
-    else
+engine::io::Socket CreateSocket(const ListenerConfig& config, std::size_t shards_count) {
+    if (!config.unix_socket_path.empty()) {
         return CreateUnixSocket(config.unix_socket_path, config.backlog);
+    }
+
+    auto socket = CreateIpv6Socket(config.address, config.port, config.backlog);
+    if (config.reuseport_steering == ReuseportSteering::kCpu && shards_count > 1) {
+        // Applies to the whole group, the last attached program wins
+        AttachCpuSteeringProgram(socket, shards_count);
+    }
+    return socket;
 }
 
 }  // namespace server::net
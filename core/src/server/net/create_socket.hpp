@@ -7,7 +7,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
-engine::io::Socket CreateSocket(const ListenerConfig& config);
+/// @param shards_count the number of sockets in the SO_REUSEPORT group
+engine::io::Socket CreateSocket(const ListenerConfig& config, std::size_t shards_count);
 
 }  // namespace server::net
 
@@ -18,6 +18,8 @@ struct EndpointInfo {
     const ListenerConfig& listener_config;
     http::HttpRequestHandler& request_handler;
     Connection::Type connection_type{Connection::Type::kRequest};
+    // Each shard listens on its own SO_REUSEPORT socket
+    std::size_t shards_count{1};
 
     std::atomic<size_t> connection_count{0};
 };
@@ -5,11 +5,19 @@
 
 #include <userver/formats/parse/common_containers.hpp>
 #include <userver/fs/blocking/read.hpp>
+#include <userver/utils/trivial_map.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+ReuseportSteering Parse(const yaml_config::YamlConfig& value, formats::parse::To<ReuseportSteering>) {
+    static constexpr utils::TrivialBiMap kMap([](auto selector) {
+        return selector().Case(ReuseportSteering::kHash, "hash").Case(ReuseportSteering::kCpu, "cpu");
+    });
+    return utils::ParseFromValueString(value, kMap);
+}
+
 ListenerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ListenerConfig>) {
     ListenerConfig config;
 
@@ -20,6 +28,7 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Li
     config.unix_socket_path = value["unix-socket"].As<std::string>("");
     config.max_connections = value["max_connections"].As<size_t>(config.max_connections);
     config.shards = value["shards"].As<std::optional<size_t>>(config.shards);
+    config.reuseport_steering = value["reuseport-steering"].As<ReuseportSteering>(config.reuseport_steering);
     config.task_processor = value["task_processor"].As<std::string>();
     config.backlog = value["backlog"].As<int>(config.backlog);
 
@@ -31,6 +40,10 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Li
     if (config.port == 0 && config.unix_socket_path.empty())
         throw std::runtime_error("Either non-zero 'port' or non-empty 'unix-socket' fields must be set");
 
+    if (config.reuseport_steering != ReuseportSteering::kHash && !config.unix_socket_path.empty()) {
+        throw std::runtime_error("'reuseport-steering' is not supported for 'unix-socket' in " + value.GetPath());
+    }
+
     if (config.backlog <= 0) {
         throw std::runtime_error("Invalid backlog value in " + value.GetPath());
     }
@@ -14,6 +14,18 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+/// How the kernel distributes new connections between the listener shards
+enum class ReuseportSteering {
+    /// By the hash of the connection addresses, the kernel default
+    kHash,
+    /// By the CPU that received the connection, see SO_ATTACH_REUSEPORT_CBPF.
+    /// Maps the connections of a CPU to the same shard index, shards are not
+    /// pinned to the CPUs. Linux only.
+    kCpu,
+};
+
+ReuseportSteering Parse(const yaml_config::YamlConfig& value, formats::parse::To<ReuseportSteering>);
+
 struct ListenerConfig {
     ConnectionConfig connection_config;
     request::HttpRequestConfig handler_defaults;
@@ -23,6 +35,7 @@ struct ListenerConfig {
     int backlog = 1024;  // truncated to net.core.somaxconn
     size_t max_connections = 32768;
     std::optional<size_t> shards;
+    ReuseportSteering reuseport_steering{ReuseportSteering::kHash};
     std::string task_processor;
 
     bool tls{false};
@@ -42,6 +42,7 @@ ListenerImpl::ListenerImpl(
                   } catch (const engine::io::IoCancelled&) {
                       break;
                   } catch (const std::exception& ex) {
+                      ++stats_->accept_errors;
                       LOG_ERROR() << "can't accept connection: " << ex;
 
                       // If we're out of files, allow other coroutines to close old
@@ -50,7 +51,7 @@ ListenerImpl::ListenerImpl(
                   }
               }
           },
-          CreateSocket(endpoint_info_->listener_config)
+          CreateSocket(endpoint_info_->listener_config, endpoint_info_->shards_count)
       )) {}
 
 ListenerImpl::~ListenerImpl() {
@@ -65,6 +66,7 @@ StatsAggregation ListenerImpl::GetStats() const { return StatsAggregation{*stats
 
 void ListenerImpl::AcceptConnection(engine::io::Socket& request_socket) {
     auto peer_socket = request_socket.Accept({});
+    ++stats_->connections_accepted;
 
     const auto new_connection_count = ++endpoint_info_->connection_count;
     utils::FastScopeGuard guard{[this]() noexcept { --endpoint_info_->connection_count; }};
@@ -73,6 +75,7 @@ void ListenerImpl::AcceptConnection(engine::io::Socket& request_socket) {
         LOG_LIMITED_WARNING() << endpoint_info_->GetDescription()
                               << " reached max_connections=" << endpoint_info_->listener_config.max_connections
                               << ", dropping connection #" << new_connection_count;
+        ++stats_->connections_dropped;
         return;
     }
 
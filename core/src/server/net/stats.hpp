@@ -18,6 +18,7 @@ struct Http2Stats {
     utils::statistics::RateCounter streams_close{0};
     utils::statistics::RateCounter reset_streams{0};
     utils::statistics::RateCounter goaway{0};
+    utils::statistics::RateCounter window_updates{0};
 };
 
 struct ParserStats {
@@ -34,7 +35,8 @@ struct ParserStatsAggregation final {
           streams_parse_error(stats.http2_stats.streams_parse_error.Load()),
           streams_close(stats.http2_stats.streams_close.Load()),
           reset_streams(stats.http2_stats.reset_streams.Load()),
-          goaway(stats.http2_stats.goaway.Load()) {}
+          goaway(stats.http2_stats.goaway.Load()),
+          window_updates(stats.http2_stats.window_updates.Load()) {}
 
     ParserStatsAggregation& operator+=(const ParserStatsAggregation& other) {
         parsing_request_count += other.parsing_request_count;
@@ -43,6 +45,7 @@ struct ParserStatsAggregation final {
         streams_close += other.streams_close;
         reset_streams += other.reset_streams;
         goaway += other.goaway;
+        window_updates += other.window_updates;
 
         return *this;
     }
@@ -54,6 +57,8 @@ struct ParserStatsAggregation final {
     utils::statistics::Rate streams_close{0};
     utils::statistics::Rate reset_streams{0};
     utils::statistics::Rate goaway{0};
+    // connection window growths by the BDP estimation
+    utils::statistics::Rate window_updates{0};
 };
 
 struct Stats {
@@ -61,6 +66,10 @@ struct Stats {
     std::atomic<size_t> active_connections{0};
     std::atomic<size_t> connections_created{0};
     std::atomic<size_t> connections_closed{0};
+    utils::statistics::RateCounter connections_accepted{0};
+    // over the max_connections limit
+    utils::statistics::RateCounter connections_dropped{0};
+    utils::statistics::RateCounter accept_errors{0};
 
     // per connection
     ParserStats parser_stats;
@@ -75,6 +84,9 @@ struct StatsAggregation final {
         : active_connections{stats.active_connections.load()},
           connections_created{stats.connections_created.load()},
           connections_closed{stats.connections_closed.load()},
+          connections_accepted{stats.connections_accepted.Load()},
+          connections_dropped{stats.connections_dropped.Load()},
+          accept_errors{stats.accept_errors.Load()},
           parser_stats{stats.parser_stats},
           active_request_count{stats.active_request_count.NonNegativeRead()},
           requests_processed_count{stats.requests_processed_count.Read()} {}
@@ -83,6 +95,9 @@ struct StatsAggregation final {
         active_connections += other.active_connections;
         connections_created += other.connections_created;
         connections_closed += other.connections_closed;
+        connections_accepted += other.connections_accepted;
+        connections_dropped += other.connections_dropped;
+        accept_errors += other.accept_errors;
 
         parser_stats += other.parser_stats;
         active_request_count += other.active_request_count;
@@ -94,6 +109,9 @@ struct StatsAggregation final {
     std::size_t active_connections{0};
     std::size_t connections_created{0};
     std::size_t connections_closed{0};
+    utils::statistics::Rate connections_accepted{0};
+    utils::statistics::Rate connections_dropped{0};
+    utils::statistics::Rate accept_errors{0};
 
     // per connection
     ParserStatsAggregation parser_stats;
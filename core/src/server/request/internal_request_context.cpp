@@ -36,6 +36,14 @@ void InternalRequestContext::ResetConfigSnapshot() { config_snapshot_.reset(); }
 
 DeadlinePropagationContext& InternalRequestContext::GetDPContext() { return dp_context_; }
 
+void InternalRequestContext::SetResponseStreamCompression(http::impl::BodyCompression compression) {
+    response_stream_compression_.emplace(compression);
+}
+
+const std::optional<http::impl::BodyCompression>& InternalRequestContext::GetResponseStreamCompression() const {
+    return response_stream_compression_;
+}
+
 }  // namespace server::request::impl
 
 USERVER_NAMESPACE_END
@@ -6,6 +6,8 @@
 
 #include <userver/dynamic_config/snapshot.hpp>
 
+#include <server/http/content_encoding.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::request::impl {
@@ -35,9 +37,13 @@ public:
 
     DeadlinePropagationContext& GetDPContext();
 
+    void SetResponseStreamCompression(http::impl::BodyCompression compression);
+    const std::optional<http::impl::BodyCompression>& GetResponseStreamCompression() const;
+
 private:
     std::optional<dynamic_config::Snapshot> config_snapshot_;
     DeadlinePropagationContext dp_context_{};
+    std::optional<http::impl::BodyCompression> response_stream_compression_;
 };
 
 }  // namespace server::request::impl
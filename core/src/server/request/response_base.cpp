@@ -73,9 +73,15 @@ ResponseBase::~ResponseBase() noexcept {
 void ResponseBase::SetData(std::string data) {
     create_time_ = std::chrono::steady_clock::now();
     data_ = std::move(data);
+    shared_body_.reset();
     guard_.emplace(accounter_, create_time_, data_.size());
 }
 
+void ResponseBase::SetSharedBody(std::shared_ptr<const std::string> data) {
+    SetData({});
+    shared_body_ = std::move(data);
+}
+
 void ResponseBase::SetReady() { SetReady(std::chrono::steady_clock::now()); }
 
 void ResponseBase::SetReady(std::chrono::steady_clock::time_point now) {
@@ -65,6 +65,7 @@ void PortInfo::Init(
 
     const auto& event_thread_pool = task_processor.EventThreadPool();
     size_t listener_shards = listener_config.shards ? *listener_config.shards : event_thread_pool.GetSize();
+    endpoint_info_->shards_count = listener_shards;
 
     listeners_.reserve(listener_shards);
     while (listener_shards--) {
@@ -116,6 +117,7 @@ public:
     std::chrono::milliseconds GetAvgRequestTimeMs() const;
     const http::HttpRequestHandler& GetHttpRequestHandler(bool is_monitor) const;
     net::StatsAggregation GetServerStats() const;
+    std::vector<net::StatsAggregation> GetListenersStats() const;
     const ServerConfig& GetServerConfig() const { return config_; }
     const std::vector<std::string>& GetMiddlewares() const;
 
@@ -258,6 +260,19 @@ const http::HttpRequestHandler& ServerImpl::GetHttpRequestHandler(bool is_monito
     return *main_port_info_.request_handler_;
 }
 
+std::vector<net::StatsAggregation> ServerImpl::GetListenersStats() const {
+    std::vector<net::StatsAggregation> result;
+
+    std::shared_lock lock{on_stop_mutex_};
+    if (is_stopping_) return result;
+    result.reserve(main_port_info_.listeners_.size());
+    for (const auto& listener : main_port_info_.listeners_) {
+        result.push_back(listener.GetStats());
+    }
+
+    return result;
+}
+
 net::StatsAggregation ServerImpl::GetServerStats() const {
     net::StatsAggregation summary;
 
@@ -339,6 +354,16 @@ void Server::WriteMonitorData(utils::statistics::Writer& writer) const {
         conn_stats["active"] = server_stats.active_connections;
         conn_stats["opened"] = server_stats.connections_created;
         conn_stats["closed"] = server_stats.connections_closed;
+        conn_stats["accepted"] = server_stats.connections_accepted;
+        conn_stats["dropped"] = server_stats.connections_dropped;
+        conn_stats["accept-errors"] = server_stats.accept_errors;
+
+        const auto listeners_stats = pimpl->GetListenersStats();
+        for (std::size_t shard = 0; shard < listeners_stats.size(); ++shard) {
+            conn_stats["shards"]["accepted"].ValueWithLabels(
+                listeners_stats[shard].connections_accepted, {"listener_shard", std::to_string(shard)}
+            );
+        }
     }
 
     if (auto request_stats = writer["requests"]) {
@@ -352,6 +377,7 @@ void Server::WriteMonitorData(utils::statistics::Writer& writer) const {
         http2_request_stats["streams-close"] = server_stats.parser_stats.streams_close;
         http2_request_stats["reset-streams"] = server_stats.parser_stats.reset_streams;
         http2_request_stats["goaway"] = server_stats.parser_stats.goaway;
+        http2_request_stats["window-updates"] = server_stats.parser_stats.window_updates;
     }
 }
 
@@ -4,6 +4,7 @@
 #include <userver/http/common_headers.hpp>
 #include <userver/server/http/http_request.hpp>
 #include <userver/tracing/opentelemetry.hpp>
+#include <userver/tracing/tracer.hpp>
 #include <userver/utils/trivial_map.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -16,6 +17,8 @@ constexpr std::string_view kSampledTag = "sampled";
 // default value for Sampled flag is '01' as we always write spans by
 // default
 constexpr std::string_view kDefaultOtelTraceFlags = "01";
+// traceflags for the traces that were not chosen by the head sampling
+constexpr std::string_view kNotSampledOtelTraceFlags = "00";
 
 // The order matter for TryFillSpanBuilderFromRequest as it returns on first
 // success
@@ -56,6 +59,10 @@ bool B3TryFillSpanBuilderFromRequest(const server::http::HttpRequest& request, t
     span_builder.SetTraceId(trace_id);
     span_builder.SetParentSpanId(request.GetHeader(b3::kSpanId));
     span_builder.AddTagFrozen(std::string{kSampledTag}, sampled);
+    if (Tracer::GetSamplingPolicy().use_inbound_decision) {
+        // '1' and 'd' (debug) mean that the trace is sampled
+        span_builder.SetSampled(sampled != "0");
+    }
     return true;
 }
 
@@ -70,10 +77,19 @@ void B3FillWithTracingContext(const tracing::Span& span, T& target) {
     if (sampled && !sampled->empty()) {
         target.SetHeader(b3::kSampled, *sampled);
     } else {
-        target.SetHeader(b3::kSampled, "1");
+        target.SetHeader(b3::kSampled, span.IsSampled() ? "1" : "0");
     }
 }
 
+// The sampled flag is the least significant bit of the hex traceflags byte
+bool IsOpenTelemetrySampled(std::string_view traceflags) {
+    if (traceflags.empty()) {
+        return true;
+    }
+    constexpr std::string_view kOddHexDigits = "13579bdfBDF";
+    return kOddHexDigits.find(traceflags.back()) != std::string_view::npos;
+}
+
 bool OpenTelemetryTryFillSpanBuilderFromRequest(
     const server::http::HttpRequest& request,
     tracing::SpanBuilder& span_builder
@@ -101,6 +117,9 @@ bool OpenTelemetryTryFillSpanBuilderFromRequest(
     if (data.trace_flags.empty()) {
         data.trace_flags = std::string{kDefaultOtelTraceFlags};
     }
+    if (Tracer::GetSamplingPolicy().use_inbound_decision) {
+        span_builder.SetSampled(IsOpenTelemetrySampled(data.trace_flags));
+    }
 
     const auto& tracestate = request.GetHeader(opentelemetry::kTraceState);
     kOTelTracingHeadersInheritedData.Set({
@@ -114,7 +133,7 @@ template <class T>
 void OpenTelemetryFillWithTracingContext(const tracing::Span& span, T& target, const logging::Level log_level) {
     const auto* data = kOTelTracingHeadersInheritedData.GetOptional();
 
-    std::string_view traceflags = kDefaultOtelTraceFlags;
+    std::string_view traceflags = span.IsSampled() ? kDefaultOtelTraceFlags : kNotSampledOtelTraceFlags;
     if (data) {
         traceflags = data->traceflags;
     }
@@ -0,0 +1,34 @@
+#include <userver/tracing/sampling_policy.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+SamplingPolicy Parse(const formats::json::Value& value, formats::parse::To<SamplingPolicy>) {
+    SamplingPolicy result;
+    result.head_probability = value["head-probability"].As<double>(result.head_probability);
+    if (!(result.head_probability >= 0.0 && result.head_probability <= 1.0)) {
+        throw std::runtime_error(
+            fmt::format("Invalid head-probability {}, must be from 0 to 1", result.head_probability)
+        );
+    }
+
+    result.use_inbound_decision = value["use-inbound-decision"].As<bool>(result.use_inbound_decision);
+    result.tail_sampling_enabled = value["tail-sampling-enabled"].As<bool>(result.tail_sampling_enabled);
+    result.tail_latency_threshold = std::chrono::milliseconds{
+        value["tail-latency-threshold-ms"].As<std::int64_t>(result.tail_latency_threshold.count())};
+    result.tail_max_spans = value["tail-max-spans"].As<std::size_t>(result.tail_max_spans);
+
+    return result;
+}
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -7,10 +7,12 @@
 
 #include <engine/task/task_context.hpp>
 #include <logging/log_helper_impl.hpp>
+#include <tracing/tail_sampling_buffer.hpp>
 #include <userver/engine/task/local_variable.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/hex.hpp>
@@ -67,6 +69,12 @@ std::string GenerateSpanId() {
     return utils::encoding::ToHex(&random_value, 8);
 }
 
+bool DecideHeadSampling(double probability) {
+    if (probability >= 1.0) return true;
+    if (probability <= 0.0) return false;
+    return utils::RandRange(1.0) < probability;
+}
+
 }  // namespace
 
 Span::Impl::Impl(
@@ -102,24 +110,38 @@ Span::Impl::Impl(
       span_id_(GenerateSpanId()),
       parent_id_(GetParentIdForLogging(parent)),
       reference_type_(reference_type),
-      source_location_(source_location) {
+      source_location_(source_location),
+      is_root_(parent == nullptr) {
     if (parent) {
         log_extra_inheritable_ = parent->log_extra_inheritable_;
         local_log_level_ = parent->local_log_level_;
+        is_sampled_ = parent->is_sampled_;
+        tail_buffer_ = parent->tail_buffer_;
+    } else {
+        const auto policy = Tracer::GetSamplingPolicy();
+        InitSampling(DecideHeadSampling(policy.head_probability), policy);
     }
 }
 
 Span::Impl::~Impl() {
-    if (!ShouldLog()) {
-        return;
+    if (tail_buffer_ && HasErrorFlag()) {
+        tail_buffer_->MarkFailed();
     }
 
-    {
+    // The spans of a trace that was not head sampled are logged into the tail
+    // sampling buffer, if any
+    if (ShouldLog() && (is_sampled_ || tail_buffer_)) {
         const impl::DetachLocalSpansScope ignore_local_span;
-        logging::LogHelper lh{logging::GetDefaultLogger(), log_level_, source_location_};
+        logging::LoggerRef logger =
+            tail_buffer_ ? static_cast<logging::impl::LoggerBase&>(*tail_buffer_) : logging::GetDefaultLogger();
+        logging::LogHelper lh{logger, log_level_, source_location_};
         lh.MarkAsTrace(logging::LogHelper::InternalTag{});
         std::move(*this).PutIntoLogger(lh.GetTagWriterAfterText({}));
     }
+
+    if (is_root_ && tail_buffer_) {
+        FinishTailSampling();
+    }
 }
 
 void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
@@ -145,7 +167,9 @@ void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
     }
     writer.PutLogExtra(log_extra_inheritable_);
 
-    LogOpenTracing();
+    if (is_sampled_) {
+        LogOpenTracing();
+    }
 }
 
 void Span::Impl::LogTo(logging::impl::TagWriter writer) {
@@ -194,6 +218,35 @@ bool Span::Impl::ShouldLog() const {
            local_log_level_.value_or(logging::Level::kTrace) <= log_level_;
 }
 
+void Span::Impl::SetSampled(bool is_sampled) {
+    UASSERT_MSG(is_root_, "Only the root span of a trace may change the sampling decision");
+    if (is_sampled != is_sampled_) {
+        InitSampling(is_sampled, Tracer::GetSamplingPolicy());
+    }
+}
+
+void Span::Impl::InitSampling(bool is_sampled, const SamplingPolicy& policy) {
+    is_sampled_ = is_sampled;
+    tail_buffer_.reset();
+    if (!is_sampled && policy.tail_sampling_enabled) {
+        tail_buffer_ = std::make_shared<impl::TailSamplingBuffer>(policy.tail_max_spans, policy.tail_latency_threshold);
+    }
+}
+
+bool Span::Impl::HasErrorFlag() const {
+    // AddTag(kErrorFlag, true) stores the flag as int
+    const auto has_flag = [](const logging::LogExtra& log_extra) {
+        const auto* flag = std::get_if<int>(&log_extra.GetValue(kErrorFlag));
+        return flag && *flag != 0;
+    };
+    return has_flag(log_extra_inheritable_) || (log_extra_local_ && has_flag(*log_extra_local_));
+}
+
+void Span::Impl::FinishTailSampling() {
+    const auto duration = std::chrono::steady_clock::now() - start_steady_time_;
+    tail_buffer_->Finish(duration >= tail_buffer_->GetLatencyThreshold() || tail_buffer_->IsFailed());
+}
+
 void Span::OptionalDeleter::operator()(Span::Impl* impl) const noexcept {
     if (do_delete) {
         std::default_delete<Impl>{}(impl);
@@ -376,6 +429,8 @@ void Span::LogTo(logging::impl::TagWriter writer) const& { pimpl_->LogTo(writer)
 
 bool Span::ShouldLogDefault() const noexcept { return pimpl_->ShouldLog(); }
 
+bool Span::IsSampled() const noexcept { return pimpl_->IsSampled(); }
+
 void Span::DetachFromCoroStack() {
     if (pimpl_) pimpl_->DetachFromCoroStack();
 }
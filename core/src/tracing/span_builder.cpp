@@ -44,6 +44,13 @@ void SpanBuilder::AddNonInheritableTag(std::string key, logging::LogExtra::Value
     pimpl_->log_extra_local_->Extend(std::move(key), std::move(value));
 }
 
+void SpanBuilder::SetSampled(bool is_sampled) {
+    // A child span inherits the decision of its trace
+    if (pimpl_->is_root_) {
+        pimpl_->SetSampled(is_sampled);
+    }
+}
+
 void SpanBuilder::SetParentLink(std::string parent_link) { AddTagFrozen(kParentLinkTag, std::move(parent_link)); }
 
 Span SpanBuilder::Build() && { return Span(std::move(pimpl_)); }
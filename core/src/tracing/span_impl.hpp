@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <list>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -13,6 +14,7 @@
 #include <userver/logging/log_extra.hpp>
 #include <userver/logging/log_filepath.hpp>
 #include <userver/logging/log_helper.hpp>
+#include <userver/tracing/sampling_policy.hpp>
 #include <userver/tracing/scope_time.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tracer.hpp>
@@ -24,6 +26,10 @@ USERVER_NAMESPACE_BEGIN
 
 namespace tracing {
 
+namespace impl {
+class TailSamplingBuffer;
+}  // namespace impl
+
 inline const std::string kLinkTag = "link";
 inline const std::string kParentLinkTag = "parent_link";
 
@@ -72,6 +78,11 @@ public:
 
     ReferenceType GetReferenceType() const noexcept { return reference_type_; }
 
+    bool IsSampled() const noexcept { return is_sampled_; }
+
+    // Overrides the head sampling decision of a root span
+    void SetSampled(bool is_sampled);
+
     void DetachFromCoroStack();
     void AttachToCoroStack();
 
@@ -83,6 +94,10 @@ private:
     static std::string GetParentIdForLogging(const Span::Impl* parent);
     bool ShouldLog() const;
 
+    void InitSampling(bool is_sampled, const SamplingPolicy& policy);
+    bool HasErrorFlag() const;
+    void FinishTailSampling();
+
     const std::string name_;
     const bool is_no_log_span_;
     logging::Level log_level_;
@@ -105,6 +120,12 @@ private:
     const ReferenceType reference_type_;
     utils::impl::SourceLocation source_location_;
 
+    const bool is_root_;
+    bool is_sampled_{true};
+    // Set for all the spans of a trace that was not head sampled if the tail
+    // sampling is enabled
+    std::shared_ptr<impl::TailSamplingBuffer> tail_buffer_;
+
     friend class Span;
     friend class SpanBuilder;
     friend class TagScope;
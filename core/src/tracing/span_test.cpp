@@ -7,6 +7,8 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/span_builder.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/regex.hpp>
@@ -688,4 +690,107 @@ UTEST_F(Span, MakeSpanWithParentIdTraceIdLinkWithExisting) {
     }
 }
 
+class SpanSampling : public Span {
+protected:
+    ~SpanSampling() override { tracing::Tracer::SetSamplingPolicy({}); }
+
+    static void SetPolicy(double head_probability, bool tail_sampling_enabled) {
+        tracing::SamplingPolicy policy;
+        policy.head_probability = head_probability;
+        policy.tail_sampling_enabled = tail_sampling_enabled;
+        policy.tail_latency_threshold = std::chrono::milliseconds{10};
+        tracing::Tracer::SetSamplingPolicy(std::move(policy));
+    }
+};
+
+UTEST_F(SpanSampling, HeadSampling) {
+    SetPolicy(0.0, false);
+    {
+        tracing::Span root_span("not_sampled_root");
+        EXPECT_FALSE(root_span.IsSampled());
+        tracing::Span child_span("not_sampled_child");
+        EXPECT_FALSE(child_span.IsSampled());
+    }
+
+    SetPolicy(1.0, false);
+    {
+        tracing::Span root_span("sampled_root");
+        EXPECT_TRUE(root_span.IsSampled());
+    }
+
+    logging::LogFlush();
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("not_sampled_")));
+    EXPECT_THAT(GetStreamString(), HasSubstr("stopwatch_name=sampled_root"));
+}
+
+UTEST_F(SpanSampling, HeadSamplingOverride) {
+    SetPolicy(0.0, false);
+    {
+        tracing::SpanBuilder builder("sampled_by_client");
+        builder.SetSampled(true);
+        auto span = std::move(builder).Build();
+        EXPECT_TRUE(span.IsSampled());
+        tracing::Span child_span("sampled_child");
+        EXPECT_TRUE(child_span.IsSampled());
+    }
+
+    logging::LogFlush();
+    EXPECT_THAT(GetStreamString(), HasSubstr("stopwatch_name=sampled_by_client"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("stopwatch_name=sampled_child"));
+}
+
+UTEST_F(SpanSampling, HeadSamplingOverrideIgnoredForChild) {
+    SetPolicy(1.0, false);
+    {
+        tracing::Span root_span("sampled_root");
+        tracing::SpanBuilder builder("sampled_child");
+        builder.SetSampled(false);
+        auto span = std::move(builder).Build();
+        EXPECT_TRUE(span.IsSampled());
+    }
+
+    logging::LogFlush();
+    EXPECT_THAT(GetStreamString(), HasSubstr("stopwatch_name=sampled_child"));
+}
+
+UTEST_F(SpanSampling, TailSamplingDropsFastTraces) {
+    SetPolicy(0.0, true);
+    {
+        tracing::Span root_span("fast_root");
+        tracing::Span child_span("fast_child");
+    }
+
+    logging::LogFlush();
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("fast_")));
+}
+
+UTEST_F(SpanSampling, TailSamplingKeepsSlowTraces) {
+    SetPolicy(0.0, true);
+    {
+        tracing::Span root_span("slow_root");
+        { tracing::Span child_span("slow_child"); }
+
+        logging::LogFlush();
+        EXPECT_THAT(GetStreamString(), Not(HasSubstr("slow_child")));
+        engine::SleepFor(std::chrono::milliseconds{20});
+    }
+
+    logging::LogFlush();
+    EXPECT_THAT(GetStreamString(), HasSubstr("stopwatch_name=slow_root"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("stopwatch_name=slow_child"));
+}
+
+UTEST_F(SpanSampling, TailSamplingKeepsFailedTraces) {
+    SetPolicy(0.0, true);
+    {
+        tracing::Span root_span("failed_root");
+        tracing::Span child_span("failed_child");
+        child_span.AddTag(tracing::kErrorFlag, true);
+    }
+
+    logging::LogFlush();
+    EXPECT_THAT(GetStreamString(), HasSubstr("stopwatch_name=failed_root"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("stopwatch_name=failed_child"));
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#include <tracing/tail_sampling_buffer.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/logging/impl/tag_writer.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+TailSamplingBuffer::TailSamplingBuffer(std::size_t max_spans, std::chrono::milliseconds latency_threshold)
+    : logging::impl::LoggerBase(logging::Format::kTskv),
+      max_spans_(max_spans),
+      latency_threshold_(latency_threshold) {
+    SetStructured(true);
+    SetLevel(logging::Level::kTrace);
+}
+
+void TailSamplingBuffer::Finish(bool keep) noexcept {
+    std::vector<logging::impl::StructuredRecord> records;
+    {
+        auto data = data_.Lock();
+        if (data->state != State::kBuffering) {
+            return;
+        }
+        data->state = keep ? State::kKept : State::kDropped;
+        records = std::move(data->records);
+    }
+
+    if (!keep) {
+        return;
+    }
+    try {
+        auto& logger = logging::GetDefaultLogger();
+        for (auto& record : records) {
+            logger.LogStructured(std::move(record));
+        }
+    } catch (const std::exception& e) {
+        UASSERT_MSG(false, fmt::format("Failed to log the tail sampled spans: {}", e.what()));
+    }
+}
+
+void TailSamplingBuffer::Log(logging::Level, std::string_view) {
+    UASSERT_MSG(false, "TailSamplingBuffer only accepts structured records");
+}
+
+void TailSamplingBuffer::LogStructured(logging::impl::StructuredRecord&& record) {
+    {
+        auto data = data_.Lock();
+        switch (data->state) {
+            case State::kBuffering:
+                if (data->records.size() < max_spans_) {
+                    data->records.push_back(std::move(record));
+                }
+                return;
+            case State::kDropped:
+                return;
+            case State::kKept:
+                break;
+        }
+    }
+    logging::GetDefaultLogger().LogStructured(std::move(record));
+}
+
+void TailSamplingBuffer::PrependCommonTags(logging::impl::TagWriter writer) const {
+    logging::GetDefaultLogger().PrependCommonTags(writer);
+}
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
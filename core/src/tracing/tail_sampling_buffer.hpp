@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include <userver/concurrent/variable.hpp>
+#include <userver/logging/impl/logger_base.hpp>
+#include <userver/logging/impl/structured_record.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+/// @brief Keeps the span records of a trace that was not head sampled, until
+/// the root span of the trace decides whether to log them.
+///
+/// The spans of the trace are logged into the buffer with logging::LogHelper
+/// as structured records, so that nothing is formatted for the traces that
+/// are dropped. The kept records are passed to the default logger as is.
+class TailSamplingBuffer final : public logging::impl::LoggerBase {
+public:
+    TailSamplingBuffer(std::size_t max_spans, std::chrono::milliseconds latency_threshold);
+
+    std::chrono::milliseconds GetLatencyThreshold() const noexcept { return latency_threshold_; }
+
+    void MarkFailed() noexcept { is_failed_.store(true, std::memory_order_relaxed); }
+    bool IsFailed() const noexcept { return is_failed_.load(std::memory_order_relaxed); }
+
+    /// Logs the buffered records if `keep` is true, drops them otherwise. The
+    /// records of the spans that finish later are logged or dropped at once.
+    void Finish(bool keep) noexcept;
+
+    void Log(logging::Level level, std::string_view msg) override;
+    void LogStructured(logging::impl::StructuredRecord&& record) override;
+    void PrependCommonTags(logging::impl::TagWriter writer) const override;
+
+private:
+    enum class State {
+        kBuffering,
+        kKept,
+        kDropped,
+    };
+
+    struct Data {
+        State state{State::kBuffering};
+        std::vector<logging::impl::StructuredRecord> records;
+    };
+
+    const std::size_t max_spans_;
+    const std::chrono::milliseconds latency_threshold_;
+    std::atomic<bool> is_failed_{false};
+    // Spans of a trace may finish concurrently in different tasks, and the
+    // critical sections never wait
+    concurrent::Variable<Data, std::mutex> data_;
+};
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
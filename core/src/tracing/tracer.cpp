@@ -37,6 +37,11 @@ auto& GlobalNoLogSpans() {
     return spans;
 }
 
+auto& GlobalSamplingPolicy() {
+    static rcu::Variable<SamplingPolicy> policy{};
+    return policy;
+}
+
 auto& GlobalTracer() {
     static rcu::Variable<TracerPtr> tracer(tracing::MakeTracer({}, {}));
     return tracer;
@@ -77,6 +82,10 @@ bool Tracer::IsNoLogSpan(const std::string& name) {
     return ValueMatchesOneOfPrefixes(name, spans->prefixes) || spans->names.find(name) != spans->names.end();
 }
 
+void Tracer::SetSamplingPolicy(SamplingPolicy&& policy) { GlobalSamplingPolicy().Assign(std::move(policy)); }
+
+SamplingPolicy Tracer::GetSamplingPolicy() { return GlobalSamplingPolicy().ReadCopy(); }
+
 void Tracer::SetTracer(std::shared_ptr<Tracer> tracer) { GlobalTracer().Assign(std::move(tracer)); }
 
 std::shared_ptr<Tracer> Tracer::GetTracer() { return GlobalTracer().ReadCopy(); }
@@ -0,0 +1,273 @@
+#include <userver/utils/statistics/exponential_histogram.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <thread>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/histogram_view.hpp>
+#include <userver/utils/statistics/impl/histogram_bucket.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace {
+
+// For best portability, see utils::statistics::Histogram
+constexpr std::size_t kMaxExportedBuckets = 50;
+
+constexpr std::size_t kCountersPerBlock = 8;
+
+// Some threads share a shard if there are more threads than CPUs, that only
+// causes a bit of contention
+constexpr std::size_t kMaxShardCount = 32;
+
+std::atomic<std::size_t> next_thread_index{0};
+
+compiler::ThreadLocal local_thread_index = [] { return next_thread_index.fetch_add(1, std::memory_order_relaxed); };
+
+std::size_t GetShardCount() noexcept {
+    const auto cpu_count = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    return std::clamp<std::size_t>(cpu_count, 1, kMaxShardCount);
+}
+
+std::size_t GetLocalShard(std::size_t shard_count) noexcept {
+    auto thread_index = local_thread_index.Use();
+    return *thread_index % shard_count;
+}
+
+// A floor division that works for negative numbers
+std::int32_t FloorDiv(std::int32_t value, std::int32_t divisor) noexcept {
+    return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+}
+
+// base^power = 2^(power / 2^scale), the whole part is exact
+double PowerOfBase(std::int32_t power, int scale) {
+    const auto whole = FloorDiv(power, 1 << scale);
+    const auto fraction = power - whole * (1 << scale);
+    return std::ldexp(std::exp2(static_cast<double>(fraction) / (1 << scale)), whole);
+}
+
+}  // namespace
+
+double ExponentialHistogramData::GetUpperBoundAt(std::size_t position) const {
+    UASSERT(position < bucket_counts.size());
+    return PowerOfBase(offset + static_cast<std::int32_t>(position) + 1, scale);
+}
+
+std::uint64_t ExponentialHistogramData::GetTotalCount() const noexcept {
+    std::uint64_t total = zero_count + overflow_count;
+    for (const auto count : bucket_counts) {
+        total += count;
+    }
+    return total;
+}
+
+void ExponentialHistogramData::Downscale(int scale_reduction) {
+    UINVARIANT(scale_reduction >= 0 && scale_reduction <= scale, "Invalid exponential histogram scale reduction");
+    if (scale_reduction == 0) {
+        return;
+    }
+    scale -= scale_reduction;
+    if (bucket_counts.empty()) {
+        offset = FloorDiv(offset, 1 << scale_reduction);
+        return;
+    }
+
+    // Bucket i of the new scale consists of the buckets [i * 2^r, (i + 1) * 2^r)
+    // of the old one
+    const auto new_offset = FloorDiv(offset, 1 << scale_reduction);
+    const auto last_index = offset + static_cast<std::int32_t>(bucket_counts.size()) - 1;
+    const auto new_size = static_cast<std::size_t>(FloorDiv(last_index, 1 << scale_reduction) - new_offset + 1);
+
+    std::vector<std::uint64_t> result(new_size, 0);
+    for (std::size_t i = 0; i < bucket_counts.size(); ++i) {
+        const auto index = offset + static_cast<std::int32_t>(i);
+        result[FloorDiv(index, 1 << scale_reduction) - new_offset] += bucket_counts[i];
+    }
+    bucket_counts = std::move(result);
+    offset = new_offset;
+}
+
+void ExponentialHistogramData::Merge(ExponentialHistogramData other) {
+    if (other.scale < scale) {
+        Downscale(scale - other.scale);
+    } else if (other.scale > scale) {
+        other.Downscale(other.scale - scale);
+    }
+
+    zero_count += other.zero_count;
+    overflow_count += other.overflow_count;
+    if (other.bucket_counts.empty()) {
+        return;
+    }
+    if (bucket_counts.empty()) {
+        offset = other.offset;
+        bucket_counts = std::move(other.bucket_counts);
+        return;
+    }
+
+    const auto first = std::min(offset, other.offset);
+    const auto last = std::max(
+        offset + static_cast<std::int32_t>(bucket_counts.size()),
+        other.offset + static_cast<std::int32_t>(other.bucket_counts.size())
+    );
+    if (first < offset || last > offset + static_cast<std::int32_t>(bucket_counts.size())) {
+        std::vector<std::uint64_t> result(static_cast<std::size_t>(last - first), 0);
+        std::copy(bucket_counts.begin(), bucket_counts.end(), result.begin() + (offset - first));
+        bucket_counts = std::move(result);
+        offset = first;
+    }
+    for (std::size_t i = 0; i < other.bucket_counts.size(); ++i) {
+        bucket_counts[other.offset - offset + i] += other.bucket_counts[i];
+    }
+}
+
+ExponentialHistogram::ExponentialHistogram(int scale, int min_exponent, int max_exponent)
+    : scale_(scale),
+      min_index_(min_exponent * (1 << scale)),
+      slot_count_(static_cast<std::size_t>(max_exponent - min_exponent) * (1 << scale) + 2),
+      blocks_per_shard_((slot_count_ + kCountersPerBlock - 1) / kCountersPerBlock),
+      shard_count_(GetShardCount()) {
+    UINVARIANT(scale >= 0 && scale <= kMaxScale, "Exponential histogram scale must be from 0 to kMaxScale");
+    UINVARIANT(
+        min_exponent < max_exponent && min_exponent > std::numeric_limits<double>::min_exponent &&
+            max_exponent < std::numeric_limits<double>::max_exponent,
+        "Invalid exponential histogram exponents range"
+    );
+
+    for (int i = 0; i <= (1 << scale); ++i) {
+        subbucket_bounds_[i] = std::exp2(static_cast<double>(i) / (1 << scale));
+    }
+    // The bounds are more than 1 / 2^(scale + 1) apart, as 2^(1 / 2^scale) - 1
+    // is at least ln(2) / 2^scale
+    for (int range = 0; range < (2 << scale); ++range) {
+        const auto range_begin = 1.0 + static_cast<double>(range) / (2 << scale);
+        while (subbucket_bounds_[subbuckets_below_[range]] < range_begin) {
+            ++subbuckets_below_[range];
+        }
+    }
+    blocks_ = std::make_unique<CounterBlock[]>(blocks_per_shard_ * shard_count_);
+}
+
+ExponentialHistogram::~ExponentialHistogram() = default;
+
+void ExponentialHistogram::Account(double value, std::uint64_t count) noexcept {
+    std::size_t slot = 0;
+    // Also handles NaN
+    if (value > 0) {
+        std::uint64_t bits{};
+        std::memcpy(&bits, &value, sizeof(bits));
+        // value = 2^(exponent - 1) * normalized, normalized is in [1, 2)
+        constexpr int kMantissaBits = 52;
+        constexpr std::uint64_t kMantissaMask = (std::uint64_t{1} << kMantissaBits) - 1;
+        const auto exponent = static_cast<std::int32_t>(bits >> kMantissaBits) - 1022;
+        const auto normalized_bits = (bits & kMantissaMask) | (std::uint64_t{1023} << kMantissaBits);
+        double normalized{};
+        std::memcpy(&normalized, &normalized_bits, sizeof(normalized));
+
+        // The bucket i is (base^i, base^(i+1)], so the exact powers of 2 are the
+        // upper bounds of the buckets. `subbucket` is the count of the bounds
+        // below `normalized`, there is at most one bound within its range.
+        const auto range = (bits & kMantissaMask) >> (kMantissaBits - scale_ - 1);
+        const auto below = subbuckets_below_[range];
+        const auto subbucket = below + (subbucket_bounds_[below] < normalized ? 1 : 0);
+        const auto index = (exponent - 1) * (1 << scale_) - 1 + subbucket;
+
+        // Subnormal values and infinity get out of the range as expected
+        const auto position = static_cast<std::int64_t>(index) - min_index_ + 1;
+        const auto last_slot = static_cast<std::int64_t>(slot_count_) - 1;
+        slot = static_cast<std::size_t>(std::clamp<std::int64_t>(position, 0, last_slot));
+    }
+
+    GetCounter(GetLocalShard(shard_count_), slot).fetch_add(count, std::memory_order_relaxed);
+}
+
+ExponentialHistogramData ExponentialHistogram::GetData() const {
+    std::vector<std::uint64_t> counts(slot_count_, 0);
+    for (std::size_t shard = 0; shard < shard_count_; ++shard) {
+        for (std::size_t slot = 0; slot < slot_count_; ++slot) {
+            counts[slot] += GetCounter(shard, slot).load(std::memory_order_relaxed);
+        }
+    }
+
+    ExponentialHistogramData result;
+    result.scale = scale_;
+    result.zero_count = counts.front();
+    result.overflow_count = counts.back();
+
+    const auto buckets_begin = counts.begin() + 1;
+    const auto buckets_end = counts.end() - 1;
+    const auto is_populated = [](std::uint64_t count) { return count != 0; };
+    const auto first = std::find_if(buckets_begin, buckets_end, is_populated);
+    if (first == buckets_end) {
+        result.offset = min_index_;
+        return result;
+    }
+    const auto last =
+        std::find_if(std::make_reverse_iterator(buckets_end), std::make_reverse_iterator(first), is_populated).base();
+    result.offset = min_index_ + static_cast<std::int32_t>(first - buckets_begin);
+    result.bucket_counts.assign(first, last);
+    return result;
+}
+
+void ResetMetric(ExponentialHistogram& histogram) noexcept {
+    for (std::size_t i = 0; i < histogram.blocks_per_shard_ * histogram.shard_count_; ++i) {
+        for (auto& counter : histogram.blocks_[i].counters) {
+            counter.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+std::atomic<std::uint64_t>& ExponentialHistogram::GetCounter(std::size_t shard, std::size_t slot) noexcept {
+    return blocks_[shard * blocks_per_shard_ + slot / kCountersPerBlock].counters[slot % kCountersPerBlock];
+}
+
+const std::atomic<std::uint64_t>& ExponentialHistogram::GetCounter(std::size_t shard, std::size_t slot) const noexcept {
+    return blocks_[shard * blocks_per_shard_ + slot / kCountersPerBlock].counters[slot % kCountersPerBlock];
+}
+
+void DumpMetric(Writer& writer, const ExponentialHistogram& histogram) {
+    // The exported buckets depend only on the configuration, so that the bounds
+    // are the same in all the dumps. Every 2^reduction adjacent buckets are
+    // merged, aligned the same way as by ExponentialHistogramData::Downscale.
+    const auto first_index = histogram.min_index_;
+    const auto last_index = first_index + static_cast<std::int32_t>(histogram.slot_count_ - 2) - 1;
+    const auto get_group = [](std::int32_t index, int reduction) { return FloorDiv(index, 1 << reduction); };
+    int reduction = 0;
+    while (static_cast<std::size_t>(get_group(last_index, reduction) - get_group(first_index, reduction) + 1) >
+           kMaxExportedBuckets) {
+        ++reduction;
+    }
+    const auto first_group = get_group(first_index, reduction);
+    const auto group_count = static_cast<std::size_t>(get_group(last_index, reduction) - first_group + 1);
+
+    const auto data = histogram.GetData();
+
+    // The first Bucket stores the size and the "infinity" counter
+    auto buckets = std::make_unique<impl::histogram::Bucket[]>(group_count + 1);
+    std::vector<double> bounds(group_count);
+    for (std::size_t i = 0; i < group_count; ++i) {
+        const auto group = first_group + static_cast<std::int32_t>(i);
+        bounds[i] = PowerOfBase((group + 1) * (1 << reduction), data.scale);
+    }
+    impl::histogram::CopyBounds(buckets.get(), bounds);
+
+    buckets[0].counter.store(data.overflow_count, std::memory_order_relaxed);
+    for (std::size_t i = 0; i < data.bucket_counts.size(); ++i) {
+        const auto group = get_group(data.offset + static_cast<std::int32_t>(i), reduction);
+        buckets[group - first_group + 1].counter.fetch_add(data.bucket_counts[i], std::memory_order_relaxed);
+    }
+    buckets[1].counter.fetch_add(data.zero_count, std::memory_order_relaxed);
+
+    writer = impl::histogram::MakeView(buckets.get());
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,188 @@
+#include <userver/utils/statistics/exponential_histogram.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/fmt.hpp>
+#include <userver/utils/statistics/prometheus.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// The reference formula from the OpenTelemetry specification
+std::int32_t ReferenceIndex(double value, int scale) {
+    return static_cast<std::int32_t>(std::ceil(std::log2(value) * (1 << scale))) - 1;
+}
+
+}  // namespace
+
+UTEST(StatisticsExponentialHistogram, Sample) {
+    /// [sample]
+    utils::statistics::Storage storage;
+
+    // Buckets are (2, 4], (4, 8], (8, 16]
+    utils::statistics::ExponentialHistogram histogram{/*scale=*/0, /*min_exponent=*/1, /*max_exponent=*/4};
+
+    auto statistics_holder =
+        storage.RegisterWriter("test", [&](utils::statistics::Writer& writer) { writer = histogram; });
+
+    histogram.Account(3);
+    histogram.Account(4);
+    histogram.Account(10);
+    histogram.Account(0);  // zeros are counted in the first bucket
+
+    const utils::statistics::Snapshot snapshot{storage};
+    EXPECT_EQ(fmt::to_string(snapshot.SingleMetric("test")), "[4]=3,[8]=0,[16]=1,[inf]=0");
+    /// [sample]
+}
+
+UTEST(StatisticsExponentialHistogram, BucketIndex) {
+    for (int scale = 0; scale <= utils::statistics::ExponentialHistogram::kMaxScale; ++scale) {
+        for (const double value : {0.001, 0.3, 0.5, 1.0, 1.5, 2.0, 3.0, 7.99, 8.0, 100.0, 12345.678, 1e9}) {
+            utils::statistics::ExponentialHistogram histogram{scale};
+            histogram.Account(value);
+
+            const auto data = histogram.GetData();
+            ASSERT_EQ(data.bucket_counts.size(), 1) << "value=" << value << " scale=" << scale;
+            EXPECT_EQ(data.offset, ReferenceIndex(value, scale)) << "value=" << value << " scale=" << scale;
+            EXPECT_GE(data.GetUpperBoundAt(0), value);
+        }
+    }
+}
+
+UTEST(StatisticsExponentialHistogram, ZeroAndOverflow) {
+    utils::statistics::ExponentialHistogram histogram{2, -10, 30};
+    histogram.Account(0);
+    histogram.Account(-1);
+    histogram.Account(std::numeric_limits<double>::quiet_NaN());
+    histogram.Account(std::numeric_limits<double>::denorm_min());
+    histogram.Account(1e-9);
+    histogram.Account(1e30, 2);
+    histogram.Account(std::numeric_limits<double>::infinity());
+
+    const auto data = histogram.GetData();
+    EXPECT_TRUE(data.bucket_counts.empty());
+    EXPECT_EQ(data.zero_count, 5);
+    EXPECT_EQ(data.overflow_count, 3);
+    EXPECT_EQ(data.GetTotalCount(), 8);
+}
+
+UTEST(StatisticsExponentialHistogram, DownscaleAndMerge) {
+    utils::statistics::ExponentialHistogram fine{3};
+    utils::statistics::ExponentialHistogram coarse{1};
+    for (const double value : {0.7, 1.1, 1.9, 5.0, 33.0}) {
+        fine.Account(value);
+        coarse.Account(value);
+    }
+
+    auto downscaled = fine.GetData();
+    downscaled.Downscale(2);
+    const auto expected = coarse.GetData();
+    EXPECT_EQ(downscaled.scale, expected.scale);
+    EXPECT_EQ(downscaled.offset, expected.offset);
+    EXPECT_EQ(downscaled.bucket_counts, expected.bucket_counts);
+
+    auto merged = coarse.GetData();
+    merged.Merge(fine.GetData());
+    EXPECT_EQ(merged.scale, 1);
+    EXPECT_EQ(merged.offset, expected.offset);
+    EXPECT_EQ(merged.GetTotalCount(), 10);
+    for (std::size_t i = 0; i < expected.bucket_counts.size(); ++i) {
+        EXPECT_EQ(merged.bucket_counts[i], expected.bucket_counts[i] * 2);
+    }
+}
+
+UTEST(StatisticsExponentialHistogram, Reset) {
+    utils::statistics::ExponentialHistogram histogram;
+    histogram.Account(42);
+    histogram.Account(0);
+    ResetMetric(histogram);
+    EXPECT_EQ(histogram.GetData().GetTotalCount(), 0);
+}
+
+UTEST_MT(StatisticsExponentialHistogram, ConcurrentAccount, 4) {
+    constexpr std::size_t kTasksCount = 8;
+    constexpr std::size_t kIterations = 10000;
+
+    utils::statistics::ExponentialHistogram histogram;
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (std::size_t i = 0; i < kTasksCount; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&histogram, i] {
+            for (std::size_t j = 0; j < kIterations; ++j) {
+                histogram.Account(static_cast<double>(i * kIterations + j));
+            }
+        }));
+    }
+    engine::WaitAllChecked(tasks);
+
+    EXPECT_EQ(histogram.GetData().GetTotalCount(), kTasksCount * kIterations);
+}
+
+UTEST(StatisticsExponentialHistogram, ExportedBucketsLimit) {
+    utils::statistics::Storage storage;
+    utils::statistics::ExponentialHistogram histogram{utils::statistics::ExponentialHistogram::kMaxScale};
+    histogram.Account(0.01);
+    histogram.Account(1e6);
+
+    auto statistics_holder =
+        storage.RegisterWriter("test", [&](utils::statistics::Writer& writer) { writer = histogram; });
+
+    const utils::statistics::Snapshot snapshot{storage};
+    const auto view = snapshot.SingleMetric("test").AsHistogram();
+    EXPECT_LE(view.GetBucketCount(), 50);
+    EXPECT_EQ(view.GetTotalCount(), 2);
+    EXPECT_EQ(view.GetValueAtInf(), 0);
+}
+
+UTEST(StatisticsExponentialHistogram, ExportedBoundsAreStable) {
+    utils::statistics::Storage storage;
+    utils::statistics::ExponentialHistogram histogram;
+
+    auto statistics_holder =
+        storage.RegisterWriter("test", [&](utils::statistics::Writer& writer) { writer = histogram; });
+
+    const auto get_bounds = [&storage] {
+        const utils::statistics::Snapshot snapshot{storage};
+        const auto view = snapshot.SingleMetric("test").AsHistogram();
+        std::vector<double> bounds;
+        for (std::size_t i = 0; i < view.GetBucketCount(); ++i) {
+            bounds.push_back(view.GetUpperBoundAt(i));
+        }
+        return bounds;
+    };
+
+    const auto empty_bounds = get_bounds();
+    EXPECT_LE(empty_bounds.size(), 50);
+    histogram.Account(0.01);
+    EXPECT_EQ(get_bounds(), empty_bounds);
+    histogram.Account(1e6);
+    EXPECT_EQ(get_bounds(), empty_bounds);
+}
+
+UTEST(StatisticsExponentialHistogram, Prometheus) {
+    utils::statistics::Storage storage;
+    utils::statistics::ExponentialHistogram histogram{/*scale=*/0, /*min_exponent=*/0, /*max_exponent=*/2};
+    histogram.Account(1.5);
+    histogram.Account(3, 2);
+    histogram.Account(1e20);
+
+    auto statistics_holder =
+        storage.RegisterWriter("test", [&](utils::statistics::Writer& writer) { writer = histogram; });
+
+    constexpr std::string_view expected = R"(# TYPE test histogram
+test_bucket{le="2"} 1
+test_bucket{le="4"} 3
+test_bucket{le="+Inf"} 4
+test_count{} 4
+)";
+    EXPECT_EQ(utils::statistics::ToPrometheusFormat(storage), expected);
+}
+
+USERVER_NAMESPACE_END
@@ -1,10 +1,13 @@
 #include <userver/utils/statistics/histogram.hpp>
 
+#include <cmath>
+
 #include <benchmark/benchmark.h>
 #include <boost/range/irange.hpp>
 
 #include <userver/utils/algo.hpp>
 #include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/exponential_histogram.hpp>
 #include <utils/gbench_auxilary.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -34,4 +37,51 @@ void HistogramAccount(benchmark::State& state) {
 // poorly (fixed).
 BENCHMARK(HistogramAccount)->DenseRange(10, 50, 10);
 
+namespace {
+
+// Latency-like values, log-uniformly distributed from 0.1 to 10^5
+std::vector<double> MakeLatencies() {
+    auto values = std::vector<double>(1024);
+    for (auto& value : values) {
+        value = std::pow(10.0, utils::RandRange(-1.0, 5.0));
+    }
+    return Launder(std::move(values));
+}
+
+// 2 buckets per power of 10, as commonly used for latencies
+std::vector<double> MakeLatencyBounds() {
+    auto bounds = std::vector<double>{};
+    for (int i = -2; i <= 10; ++i) {
+        bounds.push_back(std::pow(10.0, i / 2.0));
+    }
+    return bounds;
+}
+
+}  // namespace
+
+// All the threads account into a single histogram
+void HistogramAccountLatencies(benchmark::State& state) {
+    static utils::statistics::Histogram histogram{MakeLatencyBounds()};
+    const auto values = MakeLatencies();
+
+    while (state.KeepRunningBatch(values.size())) {
+        for (const auto value : values) {
+            histogram.Account(value);
+        }
+    }
+}
+BENCHMARK(HistogramAccountLatencies)->ThreadRange(1, 8);
+
+void ExponentialHistogramAccountLatencies(benchmark::State& state) {
+    static utils::statistics::ExponentialHistogram histogram;
+    const auto values = MakeLatencies();
+
+    while (state.KeepRunningBatch(values.size())) {
+        for (const auto value : values) {
+            histogram.Account(value);
+        }
+    }
+}
+BENCHMARK(ExponentialHistogramAccountLatencies)->ThreadRange(1, 8);
+
 USERVER_NAMESPACE_END
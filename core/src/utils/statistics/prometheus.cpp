@@ -2,7 +2,9 @@
 
 #include <algorithm>
 #include <iterator>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
@@ -10,6 +12,7 @@
 #include <userver/utils/impl/transparent_hash.hpp>
 #include <userver/utils/overloaded.hpp>
 #include <userver/utils/statistics/fmt.hpp>
+#include <userver/utils/statistics/histogram.hpp>
 #include <userver/utils/statistics/storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -22,57 +25,122 @@ namespace {
 
 enum class Typed { kYes, kNo };
 
-template <Typed IsTyped>
-class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
+// Renders the metrics and keeps the Prometheus names of the metric paths. The
+// names are reused between the passes over the metrics if the Renderer
+// outlives a single pass.
+class Renderer final {
 public:
-    explicit FormatBuilder() = default;
+    explicit Renderer(Typed typed) : typed_(typed) {}
 
-    void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels, const MetricValue& value) override {
+    // Must be called before each pass over the metrics
+    void StartPass() noexcept {
+        ++pass_;
+        used_names_ = 0;
+        last_name_ = nullptr;
+    }
+
+    // Drops the names that were not used during the pass if there are many of them
+    void FinishPass() {
+        if (names_.size() <= 2 * used_names_) return;
+        last_name_ = nullptr;
+        for (auto it = names_.begin(); it != names_.end();) {
+            it = (it->second.used_pass == pass_ ? std::next(it) : names_.erase(it));
+        }
+    }
+
+    // Appends the "# TYPE" line if it is required for the metric, returns the
+    // Prometheus name of the metric.
+    std::string_view DumpMetricType(fmt::memory_buffer& buf, std::string_view path, const MetricValue& value) {
+        auto& name = FindName(path);
+        // Histograms get their type each time, other metrics only on the first occurrence
+        if (value.IsHistogram()) {
+            DumpType(buf, name.prometheus_name, value);
+        } else if (name.typed_pass != pass_) {
+            name.typed_pass = pass_;
+            DumpType(buf, name.prometheus_name, value);
+        }
+        return name.prometheus_name;
+    }
+
+    // Appends the metric lines without the "# TYPE" line
+    void DumpMetric(
+        fmt::memory_buffer& buf,
+        std::string_view prometheus_name,
+        utils::statistics::LabelsSpan labels,
+        const MetricValue& value
+    ) {
         if (value.IsHistogram()) {
-            HandleHistogram(path, labels, value);
+            DumpHistogram(buf, prometheus_name, labels, value.AsHistogram());
             return;
         }
 
-        DumpMetricNameAndType(path, value);
-        DumpLabels(labels);
-        fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), value);
+        buf.append(prometheus_name);
+        DumpLabels(buf, labels);
+        fmt::format_to(std::back_inserter(buf), FMT_COMPILE(" {}\n"), value);
     }
 
-    std::string Release() { return fmt::to_string(buf_); }
-
 private:
+    struct MetricName final {
+        std::string prometheus_name;
+        std::uint64_t typed_pass{0};
+        std::uint64_t used_pass{0};
+    };
+
+    using Names = utils::impl::TransparentMap<std::string, MetricName>;
+
+    MetricName& FindName(std::string_view path) {
+        // Metrics with the same path and different labels usually go one after another
+        if (last_name_ && last_name_->first == path) {
+            return last_name_->second;
+        }
+
+        auto it = utils::impl::FindTransparent(names_, path);
+        if (it == names_.end()) {
+            it = names_.emplace(std::string{path}, MetricName{impl::ToPrometheusName(path)}).first;
+        }
+        if (it->second.used_pass != pass_) {
+            it->second.used_pass = pass_;
+            ++used_names_;
+        }
+        last_name_ = &*it;
+        return it->second;
+    }
+
     void AppendHistogramMetric(
+        fmt::memory_buffer& buf,
         std::string_view metric_suffix,
         std::string_view path,
         const std::string_view& upper_bound,
         std::string_view value,
         utils::statistics::LabelsSpan labels
     ) {
-        fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}_{}{{"), path, metric_suffix);
+        fmt::format_to(std::back_inserter(buf), FMT_COMPILE("{}_{}{{"), path, metric_suffix);
         if (!upper_bound.empty()) {
-            fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("le=\"{}\""), upper_bound);
+            fmt::format_to(std::back_inserter(buf), FMT_COMPILE("le=\"{}\""), upper_bound);
         }
         if (!labels.empty()) {
             if (!upper_bound.empty()) {
-                fmt::format_to(std::back_inserter(buf_), ",");
+                fmt::format_to(std::back_inserter(buf), ",");
             }
-            DumpLabelsRaw(labels);
+            DumpLabelsRaw(buf, labels);
         }
-        fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("}} {}\n"), value);
+        fmt::format_to(std::back_inserter(buf), FMT_COMPILE("}} {}\n"), value);
     }
 
-    void HandleHistogram(std::string_view path, utils::statistics::LabelsSpan labels, const MetricValue& value) {
+    void DumpHistogram(
+        fmt::memory_buffer& buf,
+        std::string_view prometheus_name,
+        utils::statistics::LabelsSpan labels,
+        HistogramView histogram
+    ) {
         static constexpr std::string_view kBucket = "bucket";
 
-        const auto prometheus_name = impl::ToPrometheusName(path);
-        DumpMetricType(prometheus_name, value);
-
-        auto histogram = value.AsHistogram();
         const auto bucket_count = histogram.GetBucketCount();
         std::uint64_t cumulative_sum = 0;
         for (std::size_t i = 0; i < bucket_count; ++i) {
             cumulative_sum += histogram.GetValueAt(i);
             AppendHistogramMetric(
+                buf,
                 kBucket,
                 prometheus_name,
                 fmt::to_string(histogram.GetUpperBoundAt(i)),
@@ -81,8 +149,9 @@ private:
             );
         }
         cumulative_sum += histogram.GetValueAtInf();
-        AppendHistogramMetric(kBucket, prometheus_name, "+Inf", fmt::to_string(cumulative_sum), labels);
+        AppendHistogramMetric(buf, kBucket, prometheus_name, "+Inf", fmt::to_string(cumulative_sum), labels);
         AppendHistogramMetric(
+            buf,
             "count",
             prometheus_name,
             /* upper_bound */ "",
@@ -91,20 +160,8 @@ private:
         );
     }
 
-    void DumpMetricNameAndType(std::string_view name, const MetricValue& value) {
-        if (const auto* const converted = utils::impl::FindTransparentOrNullptr(metrics_, name)) {
-            buf_.append(*converted);
-            return;
-        }
-
-        auto prometheus_name = impl::ToPrometheusName(name);
-        DumpMetricType(prometheus_name, value);
-        buf_.append(prometheus_name);
-        metrics_.emplace(name, std::move(prometheus_name));
-    }
-
-    void DumpMetricType([[maybe_unused]] std::string_view prometheus_name, [[maybe_unused]] const MetricValue& value) {
-        if constexpr (IsTyped == Typed::kNo) {
+    void DumpType(fmt::memory_buffer& buf, std::string_view prometheus_name, const MetricValue& value) const {
+        if (typed_ == Typed::kNo) {
             const bool should_skip = value.Visit(utils::Overloaded{
                 [](std::int64_t) { return true; },
                 [](double) { return true; },
@@ -120,31 +177,173 @@ private:
             [](Rate) -> std::string_view { return "counter"; },
             [](HistogramView) -> std::string_view { return "histogram"; },
         });
-        fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("# TYPE {} {}\n"), prometheus_name, type);
+        fmt::format_to(std::back_inserter(buf), FMT_COMPILE("# TYPE {} {}\n"), prometheus_name, type);
     }
 
-    void DumpLabelsRaw(utils::statistics::LabelsSpan labels) {
+    static void DumpLabelsRaw(fmt::memory_buffer& buf, utils::statistics::LabelsSpan labels) {
         bool sep = false;
         for (const auto& label : labels) {
             if (sep) {
-                buf_.push_back(',');
+                buf.push_back(',');
             }
-            fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}=\""), impl::ToPrometheusLabel(label.Name()));
+            fmt::format_to(std::back_inserter(buf), FMT_COMPILE("{}=\""), impl::ToPrometheusLabel(label.Name()));
             const auto& value = label.Value();
-            std::replace_copy(value.cbegin(), value.cend(), std::back_inserter(buf_), '"', '\'');
-            buf_.push_back('"');
+            std::replace_copy(value.cbegin(), value.cend(), std::back_inserter(buf), '"', '\'');
+            buf.push_back('"');
             sep = true;
         }
     }
 
-    void DumpLabels(utils::statistics::LabelsSpan labels) {
-        buf_.push_back('{');
-        DumpLabelsRaw(labels);
-        buf_.push_back('}');
+    static void DumpLabels(fmt::memory_buffer& buf, utils::statistics::LabelsSpan labels) {
+        buf.push_back('{');
+        DumpLabelsRaw(buf, labels);
+        buf.push_back('}');
     }
 
+    const Typed typed_;
+    Names names_;
+    std::uint64_t pass_{0};
+    std::size_t used_names_{0};
+    Names::value_type* last_name_{nullptr};
+};
+
+class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
+public:
+    explicit FormatBuilder(Typed typed) : renderer_(typed) { renderer_.StartPass(); }
+
+    void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels, const MetricValue& value) override {
+        const auto prometheus_name = renderer_.DumpMetricType(buf_, path, value);
+        renderer_.DumpMetric(buf_, prometheus_name, labels, value);
+    }
+
+    std::string Release() { return fmt::to_string(buf_); }
+
+private:
+    Renderer renderer_;
     fmt::memory_buffer buf_;
-    utils::impl::TransparentMap<std::string, std::string> metrics_;
+};
+
+// Keeps the text of each metric from the previous pass and reuses it if the
+// path, the labels and the value of the metric did not change.
+class CachingFormatBuilder final : public utils::statistics::BaseFormatBuilder {
+public:
+    explicit CachingFormatBuilder(Typed typed) : renderer_(typed) {}
+
+    std::string_view Format(const utils::statistics::Storage& statistics, const utils::statistics::Request& request) {
+        renderer_.StartPass();
+        cursor_ = 0;
+        index_.clear();
+        is_index_built_ = false;
+        new_text_.clear();
+        new_keys_.clear();
+        new_metrics_.clear();
+
+        statistics.VisitMetrics(*this, request);
+        renderer_.FinishPass();
+
+        std::swap(text_, new_text_);
+        std::swap(keys_, new_keys_);
+        std::swap(metrics_, new_metrics_);
+        return {text_.data(), text_.size()};
+    }
+
+    void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels, const MetricValue& value) override {
+        const auto prometheus_name = renderer_.DumpMetricType(new_text_, path, value);
+
+        CachedMetric metric;
+        metric.key_offset = new_keys_.size();
+        AppendKey(new_keys_, path, labels);
+        metric.key_size = new_keys_.size() - metric.key_offset;
+        metric.text_offset = new_text_.size();
+
+        auto* cached = FindCached(std::string_view{new_keys_}.substr(metric.key_offset));
+        if (cached && IsSameValue(*cached, value)) {
+            new_text_.append(std::string_view{text_.data(), text_.size()}.substr(cached->text_offset, cached->text_size)
+            );
+            metric.histogram = std::move(cached->histogram);
+        } else {
+            renderer_.DumpMetric(new_text_, prometheus_name, labels, value);
+            if (value.IsHistogram()) {
+                metric.histogram = std::make_unique<Histogram>(value.AsHistogram());
+            }
+        }
+        if (!value.IsHistogram()) {
+            metric.value = value;
+        }
+        metric.text_size = new_text_.size() - metric.text_offset;
+        new_metrics_.push_back(std::move(metric));
+    }
+
+private:
+    struct CachedMetric final {
+        std::size_t key_offset{0};
+        std::size_t key_size{0};
+        std::size_t text_offset{0};
+        std::size_t text_size{0};
+        MetricValue value;
+        // The copy of the histogram value, as HistogramView does not own the data
+        std::unique_ptr<Histogram> histogram;
+    };
+
+    static void AppendKey(std::string& keys, std::string_view path, utils::statistics::LabelsSpan labels) {
+        keys.append(path);
+        keys.push_back('\0');
+        for (const auto& label : labels) {
+            keys.append(label.Name());
+            keys.push_back('\0');
+            keys.append(label.Value());
+            keys.push_back('\0');
+        }
+    }
+
+    static bool IsSameValue(const CachedMetric& cached, const MetricValue& value) {
+        if (value.IsHistogram()) {
+            return cached.histogram && cached.histogram->GetView() == value.AsHistogram();
+        }
+        return !cached.histogram && cached.value == value;
+    }
+
+    std::string_view GetKey(const CachedMetric& metric) const {
+        return std::string_view{keys_}.substr(metric.key_offset, metric.key_size);
+    }
+
+    CachedMetric* FindCached(std::string_view key) {
+        // The metrics are usually visited in the same order as during the previous pass
+        if (cursor_ < metrics_.size() && GetKey(metrics_[cursor_]) == key) {
+            return &metrics_[cursor_++];
+        }
+
+        if (!is_index_built_) {
+            index_.reserve(metrics_.size());
+            for (std::size_t i = 0; i < metrics_.size(); ++i) {
+                index_.emplace(GetKey(metrics_[i]), i);
+            }
+            is_index_built_ = true;
+        }
+        const auto it = index_.find(key);
+        if (it == index_.end()) {
+            return nullptr;
+        }
+        cursor_ = it->second + 1;
+        return &metrics_[it->second];
+    }
+
+    Renderer renderer_;
+
+    // The results of the previous pass
+    fmt::memory_buffer text_;
+    std::string keys_;
+    std::vector<CachedMetric> metrics_;
+
+    // The results of the current pass
+    fmt::memory_buffer new_text_;
+    std::string new_keys_;
+    std::vector<CachedMetric> new_metrics_;
+
+    std::size_t cursor_{0};
+    // Built on the first mismatch of the order during a pass
+    std::unordered_map<std::string_view, std::size_t> index_;
+    bool is_index_built_{false};
 };
 
 }  // namespace
@@ -183,18 +382,36 @@ std::string ToPrometheusLabel(std::string_view name) {
 
 std::string
 ToPrometheusFormat(const utils::statistics::Storage& statistics, const utils::statistics::Request& request) {
-    impl::FormatBuilder<impl::Typed::kYes> builder{};
+    impl::FormatBuilder builder{impl::Typed::kYes};
     statistics.VisitMetrics(builder, request);
     return builder.Release();
 }
 
 std::string
 ToPrometheusFormatUntyped(const utils::statistics::Storage& statistics, const utils::statistics::Request& request) {
-    impl::FormatBuilder<impl::Typed::kNo> builder{};
+    impl::FormatBuilder builder{impl::Typed::kNo};
     statistics.VisitMetrics(builder, request);
     return builder.Release();
 }
 
+struct PrometheusFormatCache::Impl final {
+    explicit Impl(impl::Typed typed) : builder(typed) {}
+
+    impl::CachingFormatBuilder builder;
+};
+
+PrometheusFormatCache::PrometheusFormatCache(bool typed)
+    : impl_(std::make_unique<Impl>(typed ? impl::Typed::kYes : impl::Typed::kNo)) {}
+
+PrometheusFormatCache::~PrometheusFormatCache() = default;
+
+std::string_view PrometheusFormatCache::Format(
+    const utils::statistics::Storage& statistics,
+    const utils::statistics::Request& request
+) {
+    return impl_->builder.Format(statistics, request);
+}
+
 }  // namespace utils::statistics
 
 USERVER_NAMESPACE_END
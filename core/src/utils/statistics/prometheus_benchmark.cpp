@@ -0,0 +1,94 @@
+#include <userver/utils/statistics/prometheus.hpp>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWritersCount = 1000;
+constexpr std::size_t kSeriesPerWriter = 100;
+
+// A synthetic storage with kWritersCount * kSeriesPerWriter labeled series.
+// Every `changed_stride`-th value changes between the scrapes.
+class SyntheticStorage final {
+public:
+    explicit SyntheticStorage(std::size_t changed_stride) : values_(kWritersCount * kSeriesPerWriter) {
+        for (std::size_t i = 0; i < kSeriesPerWriter / handlers_.size(); ++i) {
+            shards_.push_back(fmt::format("{:02}", i));
+        }
+        for (std::size_t i = 0; i < kWritersCount; ++i) {
+            holders_.push_back(storage_.RegisterWriter(
+                fmt::format("service.component-{}", i),
+                [this, i](utils::statistics::Writer& writer) {
+                    for (std::size_t j = 0; j < kSeriesPerWriter; ++j) {
+                        const auto index = i * kSeriesPerWriter + j;
+                        writer["requests"].ValueWithLabels(
+                            values_[index].load(std::memory_order_relaxed),
+                            {{"handler", handlers_[j % handlers_.size()]}, {"shard", shards_[j / handlers_.size()]}}
+                        );
+                    }
+                },
+                {{"component", fmt::format("component-{}", i)}}
+            ));
+        }
+
+        for (std::size_t i = 0; i < values_.size(); i += changed_stride) {
+            changed_.push_back(i);
+        }
+    }
+
+    const utils::statistics::Storage& Get() const { return storage_; }
+
+    void Update() {
+        for (const auto index : changed_) {
+            values_[index].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    const std::vector<std::string> handlers_{"/v1/get", "/v1/set", "/v1/delete", "/v2/get", "/v2/set"};
+    std::vector<std::string> shards_;
+
+    std::vector<std::atomic<std::int64_t>> values_;
+    std::vector<std::size_t> changed_;
+    utils::statistics::Storage storage_;
+    std::vector<utils::statistics::Entry> holders_;
+};
+
+}  // namespace
+
+void PrometheusFormat(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        SyntheticStorage storage{static_cast<std::size_t>(state.range(0))};
+        for ([[maybe_unused]] auto _ : state) {
+            storage.Update();
+            benchmark::DoNotOptimize(utils::statistics::ToPrometheusFormat(storage.Get()));
+        }
+    });
+}
+// The argument is the stride of the changed values, 1 means that all of them change
+BENCHMARK(PrometheusFormat)->Arg(1)->Arg(100)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+void PrometheusFormatCached(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        SyntheticStorage storage{static_cast<std::size_t>(state.range(0))};
+        utils::statistics::PrometheusFormatCache cache;
+        benchmark::DoNotOptimize(cache.Format(storage.Get()));
+        for ([[maybe_unused]] auto _ : state) {
+            storage.Update();
+            benchmark::DoNotOptimize(cache.Format(storage.Get()));
+        }
+    });
+}
+BENCHMARK(PrometheusFormatCached)->Arg(1)->Arg(100)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+USERVER_NAMESPACE_END
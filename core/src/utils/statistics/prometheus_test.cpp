@@ -3,6 +3,7 @@
 #include <userver/utest/utest.hpp>
 
 #include <userver/formats/json/serialize.hpp>
+#include <userver/utils/statistics/histogram.hpp>
 #include <userver/utils/statistics/metadata.hpp>
 #include <userver/utils/statistics/storage.hpp>
 #include <userver/utils/text.hpp>
@@ -392,6 +393,56 @@ child{application="processing"} 8
     }
 }
 
+UTEST(MetricsPrometheus, FormatCache) {
+    int first = 1;
+    double second = 2.5;
+    bool has_extra = false;
+    utils::statistics::Histogram histogram{std::vector<double>{1, 5}};
+
+    utils::statistics::Storage storage;
+    auto holder = storage.RegisterWriter("test", [&](utils::statistics::Writer& writer) {
+        writer["first"].ValueWithLabels(first, {{"a", "1"}});
+        writer["first"].ValueWithLabels(first + 1, {{"a", "2"}});
+        if (has_extra) {
+            writer["extra"] = utils::statistics::Rate{42};
+        }
+        writer["second"] = second;
+        writer["histogram"] = histogram;
+    });
+    auto legacy_holder = storage.RegisterExtender("legacy", [&](const utils::statistics::StatisticsRequest&) {
+        formats::json::ValueBuilder result;
+        result["value"] = first;
+        return result;
+    });
+
+    utils::statistics::PrometheusFormatCache cache;
+    utils::statistics::PrometheusFormatCache untyped_cache{/*typed=*/false};
+    const auto request = utils::statistics::Request::MakeWithPrefix({}, {{"application", "processing"}});
+    const auto check = [&] {
+        EXPECT_EQ(cache.Format(storage, request), ToPrometheusFormat(storage, request));
+        EXPECT_EQ(untyped_cache.Format(storage, request), ToPrometheusFormatUntyped(storage, request));
+    };
+
+    check();
+    check();
+
+    first = 10;
+    histogram.Account(3);
+    check();
+
+    has_extra = true;
+    check();
+
+    second = 3.5;
+    has_extra = false;
+    histogram.Account(10);
+    check();
+
+    const auto filtered_request = utils::statistics::Request::MakeWithPath("test.first");
+    EXPECT_EQ(cache.Format(storage, filtered_request), ToPrometheusFormat(storage, filtered_request));
+    check();
+}
+
 }  // namespace utils::statistics::impl
 
 USERVER_NAMESPACE_END
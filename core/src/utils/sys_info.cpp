@@ -2,6 +2,13 @@
 
 #include <unistd.h>
 
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/utils/from_string.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::sys_info {
@@ -12,6 +19,77 @@ std::size_t GetPageSize() {
     return kPageSize;
 }
 
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list) {
+    std::vector<std::size_t> result;
+
+    while (!cpu_list.empty() && (cpu_list.back() == '\n' || cpu_list.back() == ' ')) {
+        cpu_list.remove_suffix(1);
+    }
+
+    while (!cpu_list.empty()) {
+        const auto comma_pos = cpu_list.find(',');
+        const auto range = cpu_list.substr(0, comma_pos);
+        cpu_list.remove_prefix(comma_pos == std::string_view::npos ? cpu_list.size() : comma_pos + 1);
+
+        const auto dash_pos = range.find('-');
+        const auto first = utils::FromString<std::size_t>(range.substr(0, dash_pos));
+        const auto last =
+            (dash_pos == std::string_view::npos) ? first : utils::FromString<std::size_t>(range.substr(dash_pos + 1));
+        if (last < first) {
+            throw std::runtime_error(fmt::format("Invalid CPU range '{}'", range));
+        }
+        for (auto cpu = first; cpu <= last; ++cpu) {
+            result.push_back(cpu);
+        }
+    }
+
+    return result;
+}
+
+std::vector<std::size_t> GetNumaNodeCpus(std::size_t numa_node) {
+    const auto path = fmt::format("/sys/devices/system/node/node{}/cpulist", numa_node);
+    if (!fs::blocking::FileExists(path)) {
+        throw std::runtime_error(fmt::format("NUMA node {} does not exist: no '{}'", numa_node, path));
+    }
+
+    auto cpus = ParseCpuList(fs::blocking::ReadFileContents(path));
+    if (cpus.empty()) {
+        throw std::runtime_error(fmt::format("NUMA node {} has no CPUs", numa_node));
+    }
+    return cpus;
+}
+
+namespace {
+
+// Reads a list field of /proc/self/status, e.g. "Cpus_allowed_list:\t0-7"
+std::optional<std::vector<std::size_t>> ReadProcStatusList(std::string_view field) {
+    std::string status;
+    try {
+        // /proc is only available on linux
+        status = fs::blocking::ReadFileContents("/proc/self/status");
+    } catch (const std::exception&) {
+        return std::nullopt;
+    }
+
+    const auto field_pos = status.find(fmt::format("\n{}:", field));
+    if (field_pos == std::string::npos) {
+        return std::nullopt;
+    }
+    std::string_view value{status};
+    value.remove_prefix(field_pos + field.size() + 2);
+    value = value.substr(0, value.find('\n'));
+    while (!value.empty() && (value.front() == '\t' || value.front() == ' ')) {
+        value.remove_prefix(1);
+    }
+    return ParseCpuList(value);
+}
+
+}  // namespace
+
+std::optional<std::vector<std::size_t>> GetAllowedCpus() { return ReadProcStatusList("Cpus_allowed_list"); }
+
+std::optional<std::vector<std::size_t>> GetAllowedNumaNodes() { return ReadProcStatusList("Mems_allowed_list"); }
+
 }  // namespace utils::sys_info
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -8,6 +11,21 @@ namespace utils::sys_info {
 
 std::size_t GetPageSize();
 
-}
+/// Parses the kernel CPU list format, e.g. "0-3,8,10-11"
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list);
+
+/// Returns the CPUs of the NUMA node as reported by sysfs
+/// @throws std::runtime_error if the node does not exist
+std::vector<std::size_t> GetNumaNodeCpus(std::size_t numa_node);
+
+/// Returns the CPUs the process may run on, e.g. restricted by the cgroup
+/// cpuset, or std::nullopt if unknown
+std::optional<std::vector<std::size_t>> GetAllowedCpus();
+
+/// Returns the NUMA nodes the process may allocate memory from, or
+/// std::nullopt if unknown
+std::optional<std::vector<std::size_t>> GetAllowedNumaNodes();
+
+}  // namespace utils::sys_info
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,36 @@
+#include <utils/sys_info.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(SysInfo, ParseCpuList) {
+    using Cpus = std::vector<std::size_t>;
+
+    EXPECT_EQ(utils::sys_info::ParseCpuList(""), Cpus{});
+    EXPECT_EQ(utils::sys_info::ParseCpuList("\n"), Cpus{});
+    EXPECT_EQ(utils::sys_info::ParseCpuList("3\n"), (Cpus{3}));
+    EXPECT_EQ(utils::sys_info::ParseCpuList("0-3"), (Cpus{0, 1, 2, 3}));
+    EXPECT_EQ(utils::sys_info::ParseCpuList("0-1,8,10-11\n"), (Cpus{0, 1, 8, 10, 11}));
+
+    EXPECT_ANY_THROW(utils::sys_info::ParseCpuList("3-1"));
+    EXPECT_ANY_THROW(utils::sys_info::ParseCpuList("a-b"));
+}
+
+TEST(SysInfo, GetNumaNodeCpus) {
+    EXPECT_ANY_THROW(utils::sys_info::GetNumaNodeCpus(100500));
+}
+
+TEST(SysInfo, GetAllowedCpus) {
+    const auto cpus = utils::sys_info::GetAllowedCpus();
+    if (!cpus) {
+        GTEST_SKIP() << "/proc/self/status is not available";
+    }
+    EXPECT_FALSE(cpus->empty());
+
+    const auto numa_nodes = utils::sys_info::GetAllowedNumaNodes();
+    ASSERT_TRUE(numa_nodes);
+    EXPECT_FALSE(numa_nodes->empty());
+}
+
+USERVER_NAMESPACE_END
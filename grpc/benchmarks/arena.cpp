@@ -0,0 +1,75 @@
+#include <string>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/ugrpc/tests/service.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <tests/secret_fields_client.usrv.pb.hpp>
+#include <tests/secret_fields_service.usrv.pb.hpp>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+namespace {
+
+class Messenger final : public sample::ugrpc::MessengerBase {
+public:
+    SendResult SendInPlace(CallContext& /*context*/, sample::ugrpc::SendRequest& request) override {
+        sample::ugrpc::SendResponse response;
+        response.set_delivered(true);
+        response.mutable_reply()->set_text(request.dest());
+        return response;
+    }
+};
+
+class MessengerService final : public tests::ServiceBase {
+public:
+    explicit MessengerService(bool use_arena) {
+        SetServerArenaEnabled(use_arena);
+        RegisterService(service_);
+        StartServer();
+    }
+
+    ~MessengerService() override { StopServer(); }
+
+private:
+    Messenger service_;
+};
+
+// A request with nested messages and strings that do not fit into SSO
+sample::ugrpc::SendRequest MakeRequest() {
+    sample::ugrpc::SendRequest request;
+    request.set_dest(std::string(64, 'd'));
+    request.mutable_creds()->set_login(std::string(32, 'l'));
+    request.mutable_creds()->set_password(std::string(32, 'p'));
+    request.mutable_creds()->set_secret_code(std::string(32, 's'));
+    request.mutable_msg()->set_text(std::string(256, 't'));
+    return request;
+}
+
+}  // namespace
+
+void UnaryRPCArena(benchmark::State& state) {
+    const logging::DefaultLoggerLevelScope level_scope{logging::Level::kError};
+
+    engine::RunStandalone(state.range(0), [&] {
+        MessengerService service{state.range(1) != 0};
+        auto client = service.MakeClient<sample::ugrpc::MessengerClient>();
+        const auto request = MakeRequest();
+
+        for (auto _ : state) {
+            const auto response = client.Send(request).Finish();
+            UINVARIANT(response.reply().text() == request.dest(), "Behavior broken");
+        }
+    });
+}
+
+BENCHMARK(UnaryRPCArena)->ArgsProduct({{1, 2, 4}, {false, true}})->Unit(benchmark::kMicrosecond);
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
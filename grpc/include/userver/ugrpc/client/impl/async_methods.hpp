@@ -6,6 +6,7 @@
 #include <string_view>
 #include <utility>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/client_context.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/impl/codegen/async_stream.h>
@@ -75,6 +76,8 @@ public:
 
     grpc::CompletionQueue& GetQueue() const noexcept;
 
+    google::protobuf::Arena& GetArena();
+
     const RpcConfigValues& GetConfigValues() const noexcept;
 
     const Middlewares& GetMiddlewares() const noexcept;
@@ -136,6 +139,8 @@ public:
     };
 
 private:
+    // Declared first to outlive the messages that gRPC may still write into
+    std::optional<google::protobuf::Arena> arena_;
     std::unique_ptr<grpc::ClientContext> context_;
     std::string client_name_;
     ugrpc::impl::MaybeOwnedString call_name_;
@@ -158,6 +158,19 @@ public:
     /// @returns RPC span
     tracing::Span& GetSpan();
 
+    /// @brief Returns the per-call arena, it is created on the first use
+    ///
+    /// Responses allocated in the arena are freed at once together with the
+    /// RPC object, which saves an allocation per nested message and string:
+    ///
+    /// @code
+    /// auto* response = google::protobuf::Arena::Create<Response>(&call.GetArena());
+    /// call.FinishAsync(*response).Get();
+    /// @endcode
+    ///
+    /// @note Moving an arena message into a heap one copies it
+    google::protobuf::Arena& GetArena();
+
 protected:
     impl::RpcData& GetData();
 
@@ -188,6 +201,17 @@ public:
     /// @throws ugrpc::client::RpcCancelledError on task cancellation
     Response Finish();
 
+    /// @brief Await and read the response into a message allocated in
+    /// @ref CallAnyBase::GetArena "the per-call arena"
+    ///
+    /// `FinishInArena` should not be called together with `Finish` or
+    /// `FinishAsync` for the same RPC.
+    ///
+    /// @returns the response, valid until the RPC object is destroyed
+    /// @throws ugrpc::client::RpcError on an RPC error
+    /// @throws ugrpc::client::RpcCancelledError on task cancellation
+    Response& FinishInArena();
+
     /// @brief Asynchronously finish the call
     ///
     /// `FinishAsync` should not be called multiple times for the same RPC.
@@ -513,6 +537,14 @@ Response UnaryCall<Response>::Finish() {
     return response;
 }
 
+template <typename Response>
+Response& UnaryCall<Response>::FinishInArena() {
+    auto* response = google::protobuf::Arena::Create<Response>(&GetArena());
+    UnaryFuture future = FinishAsync(*response);
+    future.Get();
+    return *response;
+}
+
 template <typename Response>
 UnaryFuture UnaryCall<Response>::FinishAsync(Response& response) {
     UASSERT(reader_);
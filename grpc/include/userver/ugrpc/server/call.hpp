@@ -81,6 +81,22 @@ public:
     /// @endcode
     utils::AnyStorage<StorageContext>& GetStorageContext() { return params_.storage_context; }
 
+    /// @brief Returns the per-call arena, `nullptr` unless `use-arena` is
+    /// enabled for the service
+    ///
+    /// The initial request of the RPC is allocated in the arena. Messages
+    /// created via `google::protobuf::Arena::Create` in it are freed at once
+    /// after the RPC completes, e.g. messages of a stream:
+    ///
+    /// @code
+    /// auto* response = google::protobuf::Arena::Create<Response>(stream.GetArena());
+    /// @endcode
+    ///
+    /// @note Moving an arena message into a heap one copies it. To read the
+    /// initial request in place, override the generated `<Method>InPlace`
+    /// handler, it takes the request by `Request&`.
+    google::protobuf::Arena* GetArena() { return params_.arena; }
+
     /// @brief Useful for generic error reporting via @ref FinishWithError
     virtual bool IsFinished() const = 0;
 
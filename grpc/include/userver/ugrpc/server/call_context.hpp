@@ -3,6 +3,7 @@
 /// @file userver/ugrpc/server/call_context.hpp
 /// @brief @copybrief ugrpc::server::CallContext
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/server_context.h>
 
 #include <userver/ugrpc/server/storage_context.hpp>
@@ -57,6 +58,11 @@ public:
     /// @endcode
     utils::AnyStorage<StorageContext>& GetStorageContext();
 
+    /// @brief Returns the per-call arena, `nullptr` unless `use-arena` is
+    /// enabled for the service
+    /// @see @ref CallAnyBase::GetArena
+    google::protobuf::Arena* GetArena();
+
 protected:
     /// @cond
     const CallAnyBase& GetCall() const;
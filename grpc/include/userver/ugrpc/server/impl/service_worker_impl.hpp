@@ -7,6 +7,7 @@
 #include <type_traits>
 #include <utility>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/impl/service_type.h>
 #include <grpcpp/server_context.h>
@@ -110,6 +111,10 @@ public:
     explicit CallData(const MethodData<GrpcppService, CallTraits>& method_data)
         : wait_token_(method_data.service_data.wait_tokens.GetToken()), method_data_(method_data) {
         UASSERT(method_data.method_id < method_data.service_data.metadata.method_full_names.size());
+        if (method_data.service_data.settings.use_arena) {
+            arena_.emplace();
+        }
+        initial_request_ = MakeInitialRequest();
     }
 
     void operator()() && {
@@ -126,7 +131,7 @@ public:
 
         // the request for an incoming RPC must be performed synchronously
         method_data_.service_data.async_service.template Prepare<CallTraits>(
-            method_data_.method_id, context_, initial_request_, raw_responder_, queue, queue, prepare_.GetTag()
+            method_data_.method_id, context_, *initial_request_, raw_responder_, queue, queue, prepare_.GetTag()
         );
 
         // Note: we ignore task cancellations here. Even if notify_when_done has
@@ -167,6 +172,17 @@ private:
     using RawCall = typename CallTraits::RawCall;
     using Call = typename CallTraits::Call;
 
+    static constexpr bool kHasInitialRequest = !std::is_same_v<InitialRequest, NoInitialRequest>;
+
+    InitialRequest* MakeInitialRequest() {
+        if constexpr (kHasInitialRequest) {
+            if (arena_) {
+                return ::google::protobuf::Arena::Create<InitialRequest>(&*arena_);
+            }
+        }
+        return &initial_request_storage_.emplace();
+    }
+
     void HandleRpc() {
         auto call_name = method_data_.call_name;
         auto service_name = method_data_.service_data.metadata.service_full_name;
@@ -196,21 +212,22 @@ private:
                 *access_tskv_logger,
                 span_->Get(),
                 storage_context,
-                middlewares},
+                middlewares,
+                arena_ ? &*arena_ : nullptr},
             raw_responder_
         );
         auto do_call = [&] {
-            if constexpr (std::is_same_v<InitialRequest, NoInitialRequest>) {
-                (method_data_.service.*(method_data_.service_method))(responder);
+            if constexpr (kHasInitialRequest) {
+                (method_data_.service.*(method_data_.service_method))(responder, std::move(*initial_request_));
             } else {
-                (method_data_.service.*(method_data_.service_method))(responder, std::move(initial_request_));
+                (method_data_.service.*(method_data_.service_method))(responder);
             }
         };
 
         try {
             ::google::protobuf::Message* initial_request = nullptr;
-            if constexpr (!std::is_same_v<InitialRequest, NoInitialRequest>) {
-                initial_request = &initial_request_;
+            if constexpr (kHasInitialRequest) {
+                initial_request = initial_request_;
             }
 
             MiddlewareCallContext middleware_context(
@@ -241,7 +258,12 @@ private:
     MethodData<GrpcppService, CallTraits> method_data_;
 
     typename CallTraits::ContextType context_{};
-    InitialRequest initial_request_{};
+    // Owns the initial request and the messages that the handler puts there,
+    // so it must outlive them
+    std::optional<::google::protobuf::Arena> arena_{};
+    std::optional<InitialRequest> initial_request_storage_{};
+    // Either in 'arena_' or in 'initial_request_storage_'
+    InitialRequest* initial_request_{nullptr};
     RawCall raw_responder_{&context_};
     ugrpc::impl::AsyncMethodInvocation prepare_;
     std::optional<tracing::InPlaceSpan> span_{};
@@ -20,6 +20,10 @@ struct ServiceConfig final {
 
     /// Server middlewares to use for the gRPC service.
     Middlewares middlewares;
+
+    /// Whether to allocate the requests of each RPC in a per-call
+    /// `google::protobuf::Arena`, see @ref CallAnyBase::GetArena.
+    bool use_arena{false};
 };
 
 /// @brief The type-erased base class for all gRPC service implementations
@@ -66,6 +66,9 @@ public:
     /// Client middlewares can be modified before the first RegisterService call.
     void SetClientMiddlewareFactories(client::MiddlewareFactories middleware_factories);
 
+    /// Per-call arena usage can be modified before the first RegisterService call.
+    void SetServerArenaEnabled(bool enabled);
+
     /// Modifies the internal dynamic configs storage. It is used by the server
     /// and clients, and is accessible through @ref GetConfigSource.
     /// Initially, the configs are filled with compile-time defaults.
@@ -95,6 +98,7 @@ private:
     server::Middlewares server_middlewares_;
     client::MiddlewareFactories client_middleware_factories_;
     bool middlewares_change_allowed_{true};
+    bool server_use_arena_{false};
     testsuite::GrpcControl testsuite_;
     std::optional<std::string> endpoint_;
     ugrpc::impl::StatisticsStorage client_statistics_storage_;
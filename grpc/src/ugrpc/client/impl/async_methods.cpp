@@ -134,6 +134,13 @@ grpc::CompletionQueue& RpcData::GetQueue() const noexcept {
     return queue_;
 }
 
+google::protobuf::Arena& RpcData::GetArena() {
+    if (!arena_) {
+        arena_.emplace();
+    }
+    return *arena_;
+}
+
 const RpcConfigValues& RpcData::GetConfigValues() const noexcept {
     UASSERT(context_);
     return config_values_;
@@ -187,6 +187,8 @@ std::string_view CallAnyBase::GetCallName() const {
     return data_->GetCallName();
 }
 
+google::protobuf::Arena& CallAnyBase::GetArena() { return GetData().GetArena(); }
+
 std::string_view CallAnyBase::GetClientName() const {
     UASSERT(data_);
     return data_->GetClientName();
@@ -19,6 +19,7 @@ namespace {
 
 constexpr std::string_view kTaskProcessorKey = "task-processor";
 constexpr std::string_view kMiddlewaresKey = "middlewares";
+constexpr std::string_view kUseArenaKey = "use-arena";
 
 template <typename ParserFunc>
 auto ParseOptional(
@@ -57,6 +58,10 @@ ParseMiddlewares(const yaml_config::YamlConfig& field, const components::Compone
     return field.As<std::vector<std::string>>();
 }
 
+bool ParseUseArena(const yaml_config::YamlConfig& field, const components::ComponentContext& /*context*/) {
+    return field.As<bool>(false);
+}
+
 Middlewares FindMiddlewares(const std::vector<std::string>& names, const components::ComponentContext& context) {
     return utils::AsContainer<Middlewares>(
         names | boost::adaptors::transformed([&](const std::string& name) {
@@ -73,6 +78,7 @@ ParseServiceDefaults(const yaml_config::YamlConfig& value, const components::Com
         /*task_processor=*/ParseOptional(value[kTaskProcessorKey], context, ParseTaskProcessor),
         /*middleware_names=*/
         ParseOptional(value[kMiddlewaresKey], context, ParseMiddlewares),
+        /*use_arena=*/ParseOptional(value[kUseArenaKey], context, ParseUseArena),
     };
 }
 
@@ -87,6 +93,7 @@ server::ServiceConfig ParseServiceConfig(
         FindMiddlewares(
             MergeField(value[kMiddlewaresKey], defaults.middleware_names, context, ParseMiddlewares), context
         ),
+        /*use_arena=*/MergeField(value[kUseArenaKey], defaults.use_arena, context, ParseUseArena),
     };
 }
 
@@ -110,6 +110,9 @@ properties:
                 items:
                     type: string
                     description: middleware component name
+            use-arena:
+                type: boolean
+                description: allocate the requests of each RPC in a per-call protobuf arena
 )");
 }
 
@@ -48,6 +48,10 @@ properties:
         items:
             type: string
             description: middleware component name
+    use-arena:
+        type: boolean
+        description: allocate the requests of each RPC in a per-call protobuf arena
+        defaultDescription: uses grpc-server.service-defaults.use-arena, false if missing
 )");
 }
 
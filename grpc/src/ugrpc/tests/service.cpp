@@ -34,6 +34,7 @@ server::ServiceConfig ServiceBase::MakeServiceConfig() {
     return server::ServiceConfig{
         engine::current_task::GetTaskProcessor(),
         server_middlewares_,
+        server_use_arena_,
     };
 }
 
@@ -81,6 +82,11 @@ void ServiceBase::SetServerMiddlewares(server::Middlewares middlewares) {
     server_middlewares_ = std::move(middlewares);
 }
 
+void ServiceBase::SetServerArenaEnabled(bool enabled) {
+    UINVARIANT(middlewares_change_allowed_, "Set server arena usage after RegisterService call is not allowed");
+    server_use_arena_ = enabled;
+}
+
 void ServiceBase::SetClientMiddlewareFactories(client::MiddlewareFactories middleware_factories) {
     UINVARIANT(
         middlewares_change_allowed_,
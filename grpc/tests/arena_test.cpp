@@ -0,0 +1,124 @@
+#include <userver/utest/utest.hpp>
+
+#include <google/protobuf/arena.h>
+
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class ArenaService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    // Reads the request in place, so that it is not copied out of the arena
+    SayHelloResult SayHelloInPlace(CallContext& context, sample::ugrpc::GreetingRequest& request) override {
+        arena_ = context.GetArena();
+        request_arena_ = request.GetArena();
+
+        // Scratch messages are freed together with the arena
+        if (arena_) {
+            auto* scratch = google::protobuf::Arena::Create<sample::ugrpc::GreetingResponse>(arena_);
+            scratch->set_name("Hello " + request.name());
+            UINVARIANT(scratch->GetArena() == arena_, "The message must be in the arena");
+        }
+
+        sample::ugrpc::GreetingResponse response;
+        response.set_name("Hello " + request.name());
+        return response;
+    }
+
+    ReadManyResult ReadMany(
+        CallContext& context,
+        sample::ugrpc::StreamGreetingRequest&& request,
+        ReadManyWriter& writer
+    ) override {
+        arena_ = context.GetArena();
+        request_arena_ = request.GetArena();
+
+        sample::ugrpc::StreamGreetingResponse response;
+        response.set_name("Hello again " + request.name());
+        for (int i = 0; i < request.number(); ++i) {
+            response.set_number(i);
+            writer.Write(response);
+        }
+        return grpc::Status::OK;
+    }
+
+    google::protobuf::Arena* GetArena() const { return arena_; }
+
+    google::protobuf::Arena* GetRequestArena() const { return request_arena_; }
+
+private:
+    google::protobuf::Arena* arena_{nullptr};
+    google::protobuf::Arena* request_arena_{nullptr};
+};
+
+class GrpcArena : public ugrpc::tests::ServiceFixtureBase, public testing::WithParamInterface<bool> {
+protected:
+    GrpcArena() {
+        SetServerArenaEnabled(GetParam());
+        RegisterService(service_);
+        StartServer();
+    }
+
+    ~GrpcArena() override { StopServer(); }
+
+    const ArenaService& GetService() const { return service_; }
+
+private:
+    ArenaService service_;
+};
+
+}  // namespace
+
+UTEST_P(GrpcArena, UnaryCall) {
+    const auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    sample::ugrpc::GreetingRequest request;
+    request.set_name("userver");
+    EXPECT_EQ(client.SayHello(request).Finish().name(), "Hello userver");
+
+    EXPECT_EQ(GetService().GetArena() != nullptr, GetParam());
+    EXPECT_EQ(GetService().GetRequestArena(), GetService().GetArena());
+}
+
+UTEST_P(GrpcArena, UnaryCallClientArena) {
+    const auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    sample::ugrpc::GreetingRequest request;
+    request.set_name("userver");
+    auto call = client.SayHello(request);
+    const auto& response = call.FinishInArena();
+    EXPECT_EQ(response.name(), "Hello userver");
+    EXPECT_EQ(response.GetArena(), &call.GetArena());
+}
+
+UTEST_P(GrpcArena, ResponseStream) {
+    const auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    sample::ugrpc::StreamGreetingRequest request;
+    request.set_name("userver");
+    request.set_number(3);
+    auto stream = client.ReadMany(request);
+
+    // The response is reused for all the reads and is freed together with the stream
+    auto* response = google::protobuf::Arena::Create<sample::ugrpc::StreamGreetingResponse>(&stream.GetArena());
+    int count = 0;
+    while (stream.Read(*response)) {
+        EXPECT_EQ(response->name(), "Hello again userver");
+        EXPECT_EQ(response->number(), count++);
+    }
+    EXPECT_EQ(count, 3);
+    EXPECT_EQ(response->GetArena(), &stream.GetArena());
+
+    EXPECT_EQ(GetService().GetArena() != nullptr, GetParam());
+    EXPECT_EQ(GetService().GetRequestArena(), GetService().GetArena());
+}
+
+INSTANTIATE_UTEST_SUITE_P(/*no prefix*/, GrpcArena, testing::Bool());
+
+USERVER_NAMESPACE_END
@@ -51,6 +51,7 @@ Logger::Logger(
       queue_(Queue::Create(config_.max_queue_size)),
       queue_producer_(queue_->GetMultiProducer()) {
     SetLevel(config_.log_level);
+    SetStructured(true);
     std::cerr << "OTLP logger has started\n";
 
     sender_task_ = engine::CriticalAsyncNoSpan([this,
@@ -77,12 +78,16 @@ void Logger::PrependCommonTags(logging::impl::TagWriter writer) const {
 
 bool Logger::DoShouldLog(logging::Level level) const noexcept { return logging::impl::default_::DoShouldLog(level); }
 
+bool Logger::ShouldForwardToDefault(SinkType sink) const noexcept {
+    return (sink == SinkType::kDefault || sink == SinkType::kBoth) && default_logger_;
+}
+
 void Logger::Log(logging::Level level, std::string_view msg) {
-    if (config_.logs_sink == SinkType::kDefault || config_.logs_sink == SinkType::kBoth) {
-        if (default_logger_) default_logger_->Log(level, msg);
-        if (config_.logs_sink == SinkType::kDefault) {
-            return;
-        }
+    if (ShouldForwardToDefault(config_.logs_sink)) {
+        default_logger_->Log(level, msg);
+    }
+    if (config_.logs_sink == SinkType::kDefault) {
+        return;
     }
 
     utils::encoding::TskvParser parser{msg};
@@ -94,18 +99,6 @@ void Logger::Log(logging::Level level, std::string_view msg) {
 
     [[maybe_unused]] auto parse_ok =
         utils::encoding::TskvReadRecord(parser, [&](std::string_view key, std::string_view value) {
-            if (key == "text") {
-                log_record.mutable_body()->set_string_value(grpc::string(std::string{value}));
-                return true;
-            }
-            if (key == "trace_id") {
-                log_record.set_trace_id(utils::encoding::FromHex(value));
-                return true;
-            }
-            if (key == "span_id") {
-                log_record.set_span_id(utils::encoding::FromHex(value));
-                return true;
-            }
             if (key == "timestamp") {
                 timestamp = utils::datetime::LocalTimezoneStringtime(std::string{value}, kTimestampFormat);
                 return true;
@@ -114,77 +107,143 @@ void Logger::Log(logging::Level level, std::string_view msg) {
                 log_record.set_severity_text(grpc::string(std::string{value}));
                 return true;
             }
-
-            auto attributes = log_record.add_attributes();
-            attributes->set_key(std::string{MapAttribute(key)});
-            attributes->mutable_value()->set_string_value(std::string{value});
+            AddLogAttribute(log_record, key, value);
             return true;
         });
 
     auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp.time_since_epoch());
     log_record.set_time_unix_nano(nanoseconds.count());
 
-    // Drop a log if overflown
-    auto ok = queue_producer_.PushNoblock(std::move(log_record));
-    if (!ok) {
-        ++stats_.dropped;
-    }
+    PushLogRecord(std::move(log_record));
 }
 
 void Logger::Trace(logging::Level level, std::string_view msg) {
-    if (config_.tracing_sink == SinkType::kDefault || config_.tracing_sink == SinkType::kBoth) {
-        if (default_logger_) default_logger_->Trace(level, msg);
-        if (config_.tracing_sink == SinkType::kDefault) {
-            return;
-        }
+    if (ShouldForwardToDefault(config_.tracing_sink)) {
+        default_logger_->Trace(level, msg);
+    }
+    if (config_.tracing_sink == SinkType::kDefault) {
+        return;
     }
 
     utils::encoding::TskvParser parser{msg};
 
     ::opentelemetry::proto::trace::v1::Span span;
-
-    std::string start_timestamp;
-    std::string total_time;
+    SpanTimes times;
 
     [[maybe_unused]] auto parse_ok =
         utils::encoding::TskvReadRecord(parser, [&](std::string_view key, std::string_view value) {
-            if (key == "trace_id") {
-                span.set_trace_id(utils::encoding::FromHex(value));
-                return true;
-            }
-            if (key == "span_id") {
-                span.set_span_id(utils::encoding::FromHex(value));
-                return true;
-            }
-            if (key == "parent_id") {
-                span.set_parent_span_id(utils::encoding::FromHex(value));
-                return true;
-            }
-            if (key == "stopwatch_name") {
-                span.set_name(std::string(value));
-                return true;
-            }
-            if (key == "total_time") {
-                total_time = value;
-                return true;
-            }
-            if (key == "start_timestamp") {
-                start_timestamp = value;
-                return true;
-            }
-            if (key == "timestamp" || key == "text") {
-                return true;
-            }
-
-            auto attributes = span.add_attributes();
-            attributes->set_key(std::string{MapAttribute(key)});
-            attributes->mutable_value()->set_string_value(std::string{value});
+            AddSpanAttribute(span, times, key, value);
             return true;
         });
 
-    auto start_timestamp_double = std::stod(start_timestamp);
+    PushSpan(std::move(span), times);
+}
+
+void Logger::LogStructured(logging::impl::StructuredRecord&& record) {
+    // The entries are read as is, there is no text to parse back
+    const auto sink = record.is_trace ? config_.tracing_sink : config_.logs_sink;
+    if (sink != SinkType::kDefault) {
+        if (record.is_trace) {
+            ::opentelemetry::proto::trace::v1::Span span;
+            SpanTimes times;
+            logging::impl::ForEachEntry(record, [&](std::string_view key, std::string_view value) {
+                AddSpanAttribute(span, times, key, value);
+            });
+            PushSpan(std::move(span), times);
+        } else {
+            ++stats_.by_level[static_cast<int>(record.level)];
+
+            ::opentelemetry::proto::logs::v1::LogRecord log_record;
+            log_record.set_severity_text(grpc::string(logging::ToUpperCaseString(record.level)));
+            log_record.set_time_unix_nano(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(record.time.time_since_epoch()).count()
+            );
+            logging::impl::ForEachEntry(record, [&](std::string_view key, std::string_view value) {
+                AddLogAttribute(log_record, key, value);
+            });
+            PushLogRecord(std::move(log_record));
+        }
+    }
+
+    if (ShouldForwardToDefault(sink)) {
+        default_logger_->LogStructured(std::move(record));
+    }
+}
+
+void Logger::AddLogAttribute(
+    ::opentelemetry::proto::logs::v1::LogRecord& log_record,
+    std::string_view key,
+    std::string_view value
+) const {
+    if (key == "text") {
+        log_record.mutable_body()->set_string_value(grpc::string(std::string{value}));
+        return;
+    }
+    if (key == "trace_id") {
+        log_record.set_trace_id(utils::encoding::FromHex(value));
+        return;
+    }
+    if (key == "span_id") {
+        log_record.set_span_id(utils::encoding::FromHex(value));
+        return;
+    }
+
+    auto attributes = log_record.add_attributes();
+    attributes->set_key(std::string{MapAttribute(key)});
+    attributes->mutable_value()->set_string_value(std::string{value});
+}
+
+void Logger::AddSpanAttribute(
+    ::opentelemetry::proto::trace::v1::Span& span,
+    SpanTimes& times,
+    std::string_view key,
+    std::string_view value
+) const {
+    if (key == "trace_id") {
+        span.set_trace_id(utils::encoding::FromHex(value));
+        return;
+    }
+    if (key == "span_id") {
+        span.set_span_id(utils::encoding::FromHex(value));
+        return;
+    }
+    if (key == "parent_id") {
+        span.set_parent_span_id(utils::encoding::FromHex(value));
+        return;
+    }
+    if (key == "stopwatch_name") {
+        span.set_name(std::string(value));
+        return;
+    }
+    if (key == "total_time") {
+        times.total_time = value;
+        return;
+    }
+    if (key == "start_timestamp") {
+        times.start_timestamp = value;
+        return;
+    }
+    if (key == "timestamp" || key == "text") {
+        return;
+    }
+
+    auto attributes = span.add_attributes();
+    attributes->set_key(std::string{MapAttribute(key)});
+    attributes->mutable_value()->set_string_value(std::string{value});
+}
+
+void Logger::PushLogRecord(::opentelemetry::proto::logs::v1::LogRecord&& log_record) {
+    // Drop a log if overflown
+    auto ok = queue_producer_.PushNoblock(std::move(log_record));
+    if (!ok) {
+        ++stats_.dropped;
+    }
+}
+
+void Logger::PushSpan(::opentelemetry::proto::trace::v1::Span&& span, const SpanTimes& times) {
+    auto start_timestamp_double = std::stod(times.start_timestamp);
     span.set_start_time_unix_nano(start_timestamp_double * 1'000'000'000);
-    span.set_end_time_unix_nano((start_timestamp_double + std::stod(total_time) / 1'000) * 1'000'000'000LL);
+    span.set_end_time_unix_nano((start_timestamp_double + std::stod(times.total_time) / 1'000) * 1'000'000'000LL);
 
     // Drop a trace if overflown
     auto ok = queue_producer_.PushNoblock(std::move(span));
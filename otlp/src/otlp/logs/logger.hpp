@@ -11,6 +11,7 @@
 #include <userver/formats/yaml.hpp>
 #include <userver/logging/impl/log_stats.hpp>
 #include <userver/logging/impl/logger_base.hpp>
+#include <userver/logging/impl/structured_record.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -45,6 +46,8 @@ public:
 
     void Trace(logging::Level level, std::string_view msg) override;
 
+    void LogStructured(logging::impl::StructuredRecord&& record) override;
+
     void PrependCommonTags(logging::impl::TagWriter writer) const override;
 
     void Stop() noexcept;
@@ -60,8 +63,31 @@ private:
     using Action = std::variant<::opentelemetry::proto::logs::v1::LogRecord, ::opentelemetry::proto::trace::v1::Span>;
     using Queue = concurrent::NonFifoMpscQueue<Action>;
 
+    struct SpanTimes {
+        std::string start_timestamp;
+        std::string total_time;
+    };
+
     void SendingLoop(Queue::Consumer& consumer, LogClient& log_client, TraceClient& trace_client);
 
+    // Returns true if the record must also be written by the default logger
+    bool ShouldForwardToDefault(SinkType sink) const noexcept;
+
+    void AddLogAttribute(
+        ::opentelemetry::proto::logs::v1::LogRecord& log_record,
+        std::string_view key,
+        std::string_view value
+    ) const;
+    void AddSpanAttribute(
+        ::opentelemetry::proto::trace::v1::Span& span,
+        SpanTimes& times,
+        std::string_view key,
+        std::string_view value
+    ) const;
+
+    void PushLogRecord(::opentelemetry::proto::logs::v1::LogRecord&& log_record);
+    void PushSpan(::opentelemetry::proto::trace::v1::Span&& span, const SpanTimes& times);
+
     void FillAttributes(::opentelemetry::proto::resource::v1::Resource& resource);
 
     void DoLog(const opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest& request, LogClient& client);
@@ -1,5 +1,7 @@
+#include <chrono>
 #include <deque>
 #include <string>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -71,6 +73,38 @@ BENCHMARK_INSTANTIATE_TEMPLATE_F(Redis, PipelineGrind, Ping)->RangeMultiplier(2)
 
 BENCHMARK_INSTANTIATE_TEMPLATE_F(Redis, PipelineGrind, Set)->Args({16, 1024})->Args({32, 1024});
 
+BENCHMARK_DEFINE_F(Redis, ConcurrentGets)(benchmark::State& state) {
+    RunStandalone([this, &state] {
+        USERVER_NAMESPACE::redis::CommandsBufferingSettings buffering_settings;
+        buffering_settings.buffering_enabled = true;
+        buffering_settings.watch_command_timer_interval = std::chrono::microseconds{50};
+        buffering_settings.max_merged_gets = state.range(1);
+        GetSentinel()->SetCommandsBufferingSettings(buffering_settings);
+
+        const auto client = GetClient();
+        std::vector<RequestGet> requests;
+        requests.reserve(state.range(0));
+
+        for (auto _ : state) {
+            for (auto i = 0; i < state.range(0); ++i) {
+                requests.push_back(client->Get("key" + std::to_string(i), {}));
+            }
+            for (auto& request : requests) benchmark::DoNotOptimize(request.Get());
+            requests.clear();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    });
+}
+
+// Second argument is max_merged_gets, 0 sends each GET on its own
+BENCHMARK_REGISTER_F(Redis, ConcurrentGets)
+    ->Args({16, 0})
+    ->Args({16, 32})
+    ->Args({128, 0})
+    ->Args({128, 32})
+    ->Args({512, 0})
+    ->Args({512, 32});
+
 }  // namespace storages::redis::bench
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,75 @@
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <hiredis/hiredis.h>
+
+#include <storages/redis/impl/reply_reader.hpp>
+#include <userver/storages/redis/parse_reply.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::bench {
+
+namespace {
+
+using ReaderPtr = std::unique_ptr<redisReader, decltype(&redisReaderFree)>;
+
+// MGET reply of state.range(0) values of state.range(1) bytes each
+std::string MakeMgetReply(const benchmark::State& state) {
+    const std::string value(state.range(1), 'x');
+    const auto value_header = "$" + std::to_string(value.size()) + "\r\n";
+
+    std::string result = "*" + std::to_string(state.range(0)) + "\r\n";
+    for (auto i = 0; i < state.range(0); ++i) {
+        result += value_header;
+        result += value;
+        result += "\r\n";
+    }
+    return result;
+}
+
+template <typename Convert>
+void ParseMget(benchmark::State& state, ReaderPtr (*create_reader)(), Convert convert) {
+    const auto data = MakeMgetReply(state);
+
+    for (auto _ : state) {
+        const auto reader = create_reader();
+        redisReaderFeed(reader.get(), data.data(), data.size());
+
+        void* reply = nullptr;
+        redisReaderGetReply(reader.get(), &reply);
+        auto reply_data = convert(static_cast<redisReply*>(reply));
+        reader->fn->freeObject(reply);
+
+        benchmark::DoNotOptimize(Parse(std::move(reply_data), "mget", To<std::vector<std::optional<std::string>>>{}));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+ReaderPtr CreateHiredisReader() { return {redisReaderCreate(), &redisReaderFree}; }
+
+ReaderPtr CreateReader() {
+    return {redisReaderCreateWithFunctions(USERVER_NAMESPACE::redis::GetReplyObjectFunctions()), &redisReaderFree};
+}
+
+}  // namespace
+
+// Default hiredis replies, copied into ReplyData
+void ParseMgetCopy(benchmark::State& state) {
+    ParseMget(state, &CreateHiredisReader, [](const redisReply* reply) { return ReplyData{reply}; });
+}
+
+// Replies of the userver reader, moved into ReplyData
+void ParseMgetTake(benchmark::State& state) {
+    ParseMget(state, &CreateReader, [](redisReply* reply) { return USERVER_NAMESPACE::redis::TakeReplyData(reply); });
+}
+
+BENCHMARK(ParseMgetCopy)->Args({1024, 1024})->Args({256, 16 * 1024})->Args({16, 1024 * 1024});
+BENCHMARK(ParseMgetTake)->Args({1024, 1024})->Args({256, 16 * 1024})->Args({16, 1024 * 1024});
+
+}  // namespace storages::redis::bench
+
+USERVER_NAMESPACE_END
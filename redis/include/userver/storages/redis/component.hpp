@@ -64,6 +64,12 @@ namespace components {
 /// groups.[].db | name to refer to the cluster in components::Redis::GetClient() | -
 /// groups.[].sharding_strategy | one of RedisCluster, KeyShardCrc32, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver | "KeyShardTaximeterCrc32"
 /// groups.[].allow_reads_from_master | allows read requests from master instance | false
+/// groups.[].client_side_cache.enabled | cache the replies to GET and HGET in the process, the server invalidates them over RESP3 via CLIENT TRACKING, the replies of all the commands are converted to their RESP2 form; requires Redis 6+ and hiredis 1.0+ | false
+/// groups.[].client_side_cache.max_keys | max cached keys | 10000
+/// groups.[].client_side_cache.max_value_size | larger values are not cached, in bytes | 16384
+/// groups.[].client_side_cache.max_hash_fields | max cached fields of a single hash | 64
+/// groups.[].client_side_cache.max_bytes | max total size of the cached keys, values and hash fields, in bytes; the least recently used keys are evicted to stay within the limit | 67108864
+/// groups.[].client_side_cache.prefixes | if not empty, only the keys with these prefixes are cached and tracked in the broadcasting mode | []
 /// subscribe_groups | array of redis clusters to work with in subscribe mode | -
 /// subscribe_groups.[].config_name | key name in secdist with options for this cluster | -
 /// subscribe_groups.[].db | name to refer to the cluster in components::Redis::GetSubscribeClient() | -
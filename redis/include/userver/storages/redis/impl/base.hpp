@@ -115,11 +115,13 @@ struct CommandsBufferingSettings {
     bool buffering_enabled{false};
     size_t commands_buffering_threshold{0};
     std::chrono::microseconds watch_command_timer_interval{0};
+    // Max GET commands to merge into a single MGET, 0 or 1 disables merging
+    size_t max_merged_gets{0};
 
     constexpr bool operator==(const CommandsBufferingSettings& o) const {
         return buffering_enabled == o.buffering_enabled &&
                commands_buffering_threshold == o.commands_buffering_threshold &&
-               watch_command_timer_interval == o.watch_command_timer_interval;
+               watch_command_timer_interval == o.watch_command_timer_interval && max_merged_gets == o.max_merged_gets;
     }
 };
 
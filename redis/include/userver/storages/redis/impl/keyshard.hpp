@@ -9,6 +9,9 @@ namespace redis {
 
 void GetRedisKey(const std::string& key, size_t* key_start, size_t* key_len);
 
+// Hash slot of the key in a redis cluster, honors the hash tags
+size_t GetClusterHashSlot(const std::string& key);
+
 class KeyShard {
 public:
     virtual ~KeyShard() = default;
@@ -101,8 +101,13 @@ UTEST_F(RedisClusterClientTest, DISABLED_MgetCrossSlot) {
     }
 
     {
-        auto req = client->Mget({MakeKey(idx[0]), MakeKey(idx[1])}, kDefaultCc);
-        UASSERT_THROW(req.Get(), redis::ParseReplyException);
+        // The command is split by hash slots
+        auto req = client->Mget({MakeKey(idx[1]), "missing_key", MakeKey(idx[0])}, kDefaultCc);
+        auto reply = req.Get();
+        ASSERT_EQ(reply.size(), 3);
+        EXPECT_EQ(reply[0], std::to_string(add + idx[1]));
+        EXPECT_EQ(reply[1], std::nullopt);
+        EXPECT_EQ(reply[2], std::to_string(add + idx[0]));
     }
 
     for (unsigned long i : idx) {
@@ -111,6 +116,28 @@ UTEST_F(RedisClusterClientTest, DISABLED_MgetCrossSlot) {
     }
 }
 
+UTEST_F(RedisClusterClientTest, DISABLED_MultiKeyCrossSlot) {
+    auto client = GetClient();
+
+    const size_t kNumKeys = 10;
+    std::vector<std::string> keys;
+    std::vector<std::pair<std::string, std::string>> key_values;
+    for (size_t i = 0; i < kNumKeys; ++i) {
+        keys.push_back(MakeKey(i));
+        key_values.emplace_back(MakeKey(i), std::to_string(i));
+    }
+
+    UASSERT_NO_THROW(client->Mset(key_values, kDefaultCc).Get());
+    EXPECT_EQ(client->Exists(keys, kDefaultCc).Get(), kNumKeys);
+
+    const auto values = client->Mget(keys, kDefaultCc).Get();
+    ASSERT_EQ(values.size(), kNumKeys);
+    for (size_t i = 0; i < kNumKeys; ++i) EXPECT_EQ(values[i], std::to_string(i));
+
+    EXPECT_EQ(client->Unlink({MakeKey(0), MakeKey(1)}, kDefaultCc).Get(), 2);
+    EXPECT_EQ(client->Del(keys, kDefaultCc).Get(), kNumKeys - 2);
+}
+
 UTEST_F(RedisClusterClientTest, DISABLED_Transaction) {
     auto client = GetClient();
     auto transaction = client->Multi();
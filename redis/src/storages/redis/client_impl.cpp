@@ -1,7 +1,12 @@
 #include "client_impl.hpp"
 
+#include <algorithm>
+#include <unordered_map>
+
+#include <userver/storages/redis/impl/keyshard.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 
 #include "impl/command_control_impl.hpp"
@@ -10,6 +15,7 @@
 
 USERVER_NAMESPACE_BEGIN
 
+using redis::ClientSideCache;
 using redis::CommandControlImpl;
 
 namespace storages::redis {
@@ -35,6 +41,14 @@ void DoCheckShard(size_t shard, std::optional<size_t> force_shard_idx) {
         );
 }
 
+ReplyPtr MakeCachedReply(std::string command, ClientSideCache::Value value) {
+    return std::make_shared<Reply>(std::move(command), value ? ReplyData{std::move(*value)} : ReplyData::CreateNil());
+}
+
+const std::string& GetKey(const std::string& key) { return key; }
+
+const std::string& GetKey(const std::pair<std::string, std::string>& key_value) { return key_value.first; }
+
 }  // namespace
 
 ClientImpl::ClientImpl(
@@ -52,6 +66,51 @@ bool ClientImpl::IsInClusterMode() const { return redis_client_->IsInClusterMode
 
 size_t ClientImpl::ShardByKey(const std::string& key) const { return redis_client_->ShardByKey(key); }
 
+template <typename T>
+std::vector<std::vector<size_t>> ClientImpl::SplitBySlot(const std::vector<T>& args) const {
+    if (args.size() < 2 || !IsInClusterMode()) return {};
+
+    std::vector<std::vector<size_t>> groups;
+    std::unordered_map<size_t, size_t> group_by_slot;
+    for (size_t i = 0; i < args.size(); ++i) {
+        const auto [it, inserted] =
+            group_by_slot.emplace(USERVER_NAMESPACE::redis::GetClusterHashSlot(GetKey(args[i])), groups.size());
+        if (inserted) groups.emplace_back();
+        groups[it->second].push_back(i);
+    }
+    if (groups.size() < 2) return {};
+    return groups;
+}
+
+template <typename Request, typename T>
+Request ClientImpl::MakeSplitRequest(
+    const char* command,
+    std::vector<T>&& args,
+    const std::vector<std::vector<size_t>>& groups,
+    bool master,
+    const CommandControl& command_control,
+    size_t max_chunk_size
+) {
+    const auto cc = GetCommandControl(command_control);
+    std::vector<USERVER_NAMESPACE::redis::Request> requests;
+    std::vector<std::vector<size_t>> positions;
+
+    for (const auto& group : groups) {
+        // Each request is redirected on MOVED or ASK on its own
+        const auto shard = ShardByKey(GetKey(args[group.front()]), command_control);
+        const auto chunk_size = max_chunk_size ? max_chunk_size : group.size();
+        for (size_t begin = 0; begin < group.size(); begin += chunk_size) {
+            const auto end = std::min(begin + chunk_size, group.size());
+            std::vector<T> args_chunk;
+            args_chunk.reserve(end - begin);
+            for (auto i = begin; i < end; ++i) args_chunk.push_back(std::move(args[group[i]]));
+            requests.push_back(MakeRequest(CmdArgs{command, std::move(args_chunk)}, shard, master, cc));
+            positions.emplace_back(group.begin() + begin, group.begin() + end);
+        }
+    }
+    return CreateSplitRequest<Request>(std::move(requests), std::move(positions));
+}
+
 const std::string& ClientImpl::GetAnyKeyForShard(size_t shard_idx) const {
     return redis_client_->GetAnyKeyForShard(shard_idx);
 }
@@ -138,6 +197,9 @@ RequestDel ClientImpl::Del(std::string key, const CommandControl& command_contro
 
 RequestDel ClientImpl::Del(std::vector<std::string> keys, const CommandControl& command_control) {
     if (keys.empty()) return CreateDummyRequest<RequestDel>(std::make_shared<Reply>("del", 0));
+    if (auto groups = SplitBySlot(keys); !groups.empty()) {
+        return MakeSplitRequest<RequestDel>("del", std::move(keys), groups, true, command_control);
+    }
     auto shard = ShardByKey(keys.at(0), command_control);
     return CreateRequest<RequestDel>(
         MakeRequest(CmdArgs{"del", std::move(keys)}, shard, true, GetCommandControl(command_control))
@@ -153,6 +215,9 @@ RequestUnlink ClientImpl::Unlink(std::string key, const CommandControl& command_
 
 RequestUnlink ClientImpl::Unlink(std::vector<std::string> keys, const CommandControl& command_control) {
     if (keys.empty()) return CreateDummyRequest<RequestUnlink>(std::make_shared<Reply>("unlink", 0));
+    if (auto groups = SplitBySlot(keys); !groups.empty()) {
+        return MakeSplitRequest<RequestUnlink>("unlink", std::move(keys), groups, true, command_control);
+    }
     auto shard = ShardByKey(keys.at(0), command_control);
     return CreateRequest<RequestUnlink>(
         MakeRequest(CmdArgs{"unlink", std::move(keys)}, shard, true, GetCommandControl(command_control))
@@ -208,6 +273,9 @@ RequestExists ClientImpl::Exists(std::string key, const CommandControl& command_
 
 RequestExists ClientImpl::Exists(std::vector<std::string> keys, const CommandControl& command_control) {
     if (keys.empty()) return CreateDummyRequest<RequestExists>(std::make_shared<Reply>("exists", 0));
+    if (auto groups = SplitBySlot(keys); !groups.empty()) {
+        return MakeSplitRequest<RequestExists>("exists", std::move(keys), groups, false, command_control);
+    }
     auto shard = ShardByKey(keys.at(0), command_control);
     return CreateRequest<RequestExists>(
         MakeRequest(CmdArgs{"exists", std::move(keys)}, shard, false, GetCommandControl(command_control))
@@ -348,6 +416,14 @@ RequestGeosearch ClientImpl::Geosearch(
 
 RequestGet ClientImpl::Get(std::string key, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    if (auto cache = GetClientSideCache(key, command_control)) {
+        if (auto cached = cache->Get(key)) return CreateDummyRequest<RequestGet>(MakeCachedReply("get", *cached));
+        auto fill_token = cache->PrepareFill(cache, key, std::nullopt);
+        return CreateCachingRequest<RequestGet>(
+            MakeRequest(CmdArgs{"get", std::move(key)}, shard, false, GetCommandControl(command_control)),
+            std::move(fill_token)
+        );
+    }
     return CreateRequest<RequestGet>(
         MakeRequest(CmdArgs{"get", std::move(key)}, shard, false, GetCommandControl(command_control))
     );
@@ -384,6 +460,18 @@ RequestHexists ClientImpl::Hexists(std::string key, std::string field, const Com
 
 RequestHget ClientImpl::Hget(std::string key, std::string field, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    if (auto cache = GetClientSideCache(key, command_control)) {
+        if (auto cached = cache->Hget(key, field)) {
+            return CreateDummyRequest<RequestHget>(MakeCachedReply("hget", *cached));
+        }
+        auto fill_token = cache->PrepareFill(cache, key, field);
+        return CreateCachingRequest<RequestHget>(
+            MakeRequest(
+                CmdArgs{"hget", std::move(key), std::move(field)}, shard, false, GetCommandControl(command_control)
+            ),
+            std::move(fill_token)
+        );
+    }
     return CreateRequest<RequestHget>(
         MakeRequest(CmdArgs{"hget", std::move(key), std::move(field)}, shard, false, GetCommandControl(command_control))
     );
@@ -567,6 +655,10 @@ RequestLtrim ClientImpl::Ltrim(std::string key, int64_t start, int64_t stop, con
 
 RequestMget ClientImpl::Mget(std::vector<std::string> keys, const CommandControl& command_control) {
     if (keys.empty()) return CreateDummyRequest<RequestMget>(std::make_shared<Reply>("mget", ReplyData::Array{}));
+    if (auto groups = SplitBySlot(keys); !groups.empty()) {
+        const auto max_chunk_size = CommandControlImpl{command_control}.chunk_size;
+        return MakeSplitRequest<RequestMget>("mget", std::move(keys), groups, false, command_control, max_chunk_size);
+    }
     const auto shard = ShardByKey(keys.at(0), command_control);
     auto max_chunk_size = CommandControlImpl{command_control}.chunk_size;
     if (max_chunk_size == 0) {
@@ -589,6 +681,9 @@ ClientImpl::Mset(std::vector<std::pair<std::string, std::string>> key_values, co
         return CreateDummyRequest<RequestMset>(std::make_shared<USERVER_NAMESPACE::redis::Reply>(
             "mset", USERVER_NAMESPACE::redis::ReplyData::CreateStatus("OK")
         ));
+    if (auto groups = SplitBySlot(key_values); !groups.empty()) {
+        return MakeSplitRequest<RequestMset>("mset", std::move(key_values), groups, true, command_control);
+    }
     auto shard = ShardByKey(key_values.at(0).first, command_control);
     return CreateRequest<RequestMset>(
         MakeRequest(CmdArgs{"mset", std::move(key_values)}, shard, true, GetCommandControl(command_control))
@@ -1179,6 +1274,17 @@ CommandControl ClientImpl::GetCommandControl(const CommandControl& cc) const {
     return redis_client_->GetCommandControl(cc);
 }
 
+std::shared_ptr<ClientSideCache>
+ClientImpl::GetClientSideCache(const std::string& key, const CommandControl& cc) const {
+    const auto& cache = redis_client_->GetClientSideCache();
+    if (!cache || !cache->IsCacheable(key)) return nullptr;
+
+    // The user explicitly asked for a fresh reply from a specific server
+    const auto command_control = GetCommandControl(cc);
+    if (command_control.force_request_to_master.value_or(false) || command_control.force_server_id) return nullptr;
+    return cache;
+}
+
 size_t ClientImpl::GetPublishShard(PubShard policy, const USERVER_NAMESPACE::redis::PublishSettings& settings) {
     if (force_shard_idx_) {
         return *force_shard_idx_;
@@ -18,6 +18,7 @@
 USERVER_NAMESPACE_BEGIN
 
 namespace redis {
+class ClientSideCache;
 class Sentinel;
 }  // namespace redis
 
@@ -460,6 +461,25 @@ private:
         return requests;
     }
 
+    // A command to a redis cluster may only address the keys of a single hash
+    // slot. Returns the positions of the keys grouped by their slots if the
+    // keys span several slots, an empty vector otherwise.
+    template <typename T>
+    std::vector<std::vector<size_t>> SplitBySlot(const std::vector<T>& args) const;
+
+    // Sends a command for each group of args, all the commands are in flight
+    // concurrently. A group larger than max_chunk_size (if not 0) is sent in
+    // several commands.
+    template <typename Request, typename T>
+    Request MakeSplitRequest(
+        const char* command,
+        std::vector<T>&& args,
+        const std::vector<std::vector<size_t>>& groups,
+        bool master,
+        const CommandControl& command_control,
+        size_t max_chunk_size = 0
+    );
+
     CommandControl GetCommandControl(const CommandControl& cc) const;
 
     size_t GetPublishShard(PubShard policy, const USERVER_NAMESPACE::redis::PublishSettings& settings);
@@ -468,6 +488,10 @@ private:
 
     void CheckShard(size_t shard, const CommandControl& cc) const;
 
+    // nullptr if the reply to a read of the key must not be cached
+    std::shared_ptr<USERVER_NAMESPACE::redis::ClientSideCache>
+    GetClientSideCache(const std::string& key, const CommandControl& cc) const;
+
     std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> redis_client_;
     std::atomic<int> publish_shard_{0};
     const std::optional<size_t> force_shard_idx_;
@@ -96,6 +96,33 @@ UTEST_F(RedisClientTest, Mget) {
     EXPECT_EQ(*result[1], "bar");
 }
 
+UTEST_F(RedisClientTest, MergedGets) {
+    redis::CommandsBufferingSettings buffering_settings;
+    buffering_settings.buffering_enabled = true;
+    buffering_settings.watch_command_timer_interval = std::chrono::milliseconds{1};
+    buffering_settings.max_merged_gets = 8;
+    GetSentinel()->SetCommandsBufferingSettings(buffering_settings);
+
+    auto client = GetClient();
+    client->Set("key0", "foo", {}).Get();
+
+    std::vector<storages::redis::RequestGet> requests;
+    for (auto i = 0; i < 20; ++i) requests.push_back(client->Get("key" + std::to_string(i % 2), {}));
+    // Other commands are not reordered relative to the GETs
+    auto set_request = client->Set("key1", "bar", {});
+    auto get_request = client->Get("key1", {});
+
+    for (auto i = 0; i < 20; ++i) {
+        if (i % 2 == 0) {
+            EXPECT_EQ(requests[i].Get(), "foo");
+        } else {
+            EXPECT_EQ(requests[i].Get(), std::nullopt);
+        }
+    }
+    set_request.Get();
+    EXPECT_EQ(get_request.Get(), "bar");
+}
+
 UTEST_F(RedisClientTest, Unlink) {
     auto client = GetClient();
     client->Set("key0", "foo", {}).Get();
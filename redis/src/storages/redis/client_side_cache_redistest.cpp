@@ -0,0 +1,94 @@
+#include <storages/redis/util_redistest.hpp>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/sleep.hpp>
+
+#include <storages/redis/impl/client_side_cache.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::chrono::seconds kInvalidationTimeout{10};
+
+// The connections of the client use RESP3 with CLIENT TRACKING
+class RedisClientSideCacheTest : public BaseRedisClientSideCacheTest {
+public:
+    void SetUp() override {
+        BaseRedisClientSideCacheTest::SetUp();
+        if (!CheckVersion({6, 0, 0})) {
+            GTEST_SKIP() << SkipMsgByVersion("CLIENT TRACKING", {6, 0, 0});
+        }
+        if (!GetSentinel()->GetClientSideCache()->IsEnabled()) {
+            GTEST_SKIP() << "hiredis without RESP3 support";
+        }
+
+        GetSentinel()->MakeRequest({"flushdb"}, "none", true).Get();
+    }
+};
+
+template <typename Func>
+auto WaitForValue(const Func& func, const std::optional<std::string>& expected) {
+    const auto deadline = engine::Deadline::FromDuration(kInvalidationTimeout);
+    auto value = func();
+    while (value != expected && !deadline.IsReached()) {
+        engine::SleepFor(std::chrono::milliseconds{10});
+        value = func();
+    }
+    return value;
+}
+
+}  // namespace
+
+UTEST_F(RedisClientSideCacheTest, GetAndHget) {
+    auto client = GetClient();
+
+    EXPECT_EQ(client->Get("key", {}).Get(), std::nullopt);
+    client->Set("key", "value", {}).Get();
+    const auto get = [&client] { return client->Get("key", {}).Get(); };
+    EXPECT_EQ(WaitForValue(get, "value"), "value");
+    // Served from the cache
+    EXPECT_EQ(get(), "value");
+
+    // The server invalidates the cached value
+    client->Set("key", "new_value", {}).Get();
+    EXPECT_EQ(WaitForValue(get, "new_value"), "new_value");
+
+    client->Hset("hash", "field", "value", {}).Get();
+    const auto hget = [&client] { return client->Hget("hash", "field", {}).Get(); };
+    EXPECT_EQ(hget(), "value");
+    EXPECT_EQ(hget(), "value");
+
+    client->Hset("hash", "field", "new_value", {}).Get();
+    EXPECT_EQ(WaitForValue(hget, "new_value"), "new_value");
+    // RESP3 returns a map, it is flattened as in RESP2
+    const std::unordered_map<std::string, std::string> expected_hash{{"field", "new_value"}};
+    EXPECT_EQ(client->Hgetall("hash", {}).Get(), expected_hash);
+
+    client->Hdel("hash", "field", {}).Get();
+    EXPECT_EQ(WaitForValue(hget, std::nullopt), std::nullopt);
+}
+
+UTEST_F(RedisClientSideCacheTest, ZrangeWithScores) {
+    auto client = GetClient();
+
+    // RESP3 returns the member-score pairs as nested arrays
+    client->Zadd("zset", {{2., "two"}, {3., "three"}, {1., "one"}}, {}).Get();
+    const auto result = client->ZrangeWithScores("zset", 0, -1, {}).Get();
+    const std::vector<storages::redis::MemberScore> expected{{"one", 1.}, {"two", 2.}, {"three", 3.}};
+    EXPECT_EQ(result, expected);
+
+    const auto by_score = client->ZrangebyscoreWithScores("zset", 2., 3., {}).Get();
+    const std::vector<storages::redis::MemberScore> expected_by_score{{"two", 2.}, {"three", 3.}};
+    EXPECT_EQ(by_score, expected_by_score);
+}
+
+UTEST_F(RedisClientSideCacheTest, EvalBoolean) {
+    auto client = GetClient();
+
+    // RESP3 booleans are returned as the Lua booleans in RESP2
+    EXPECT_EQ(client->Eval<std::optional<std::string>>("return false", {"key"}, {}, {}).Get(), std::nullopt);
+    EXPECT_EQ(client->Eval<int64_t>("return true", {"key"}, {}, {}).Get(), 1);
+}
+
+USERVER_NAMESPACE_END
@@ -26,6 +26,7 @@
 #include <userver/storages/redis/redis_config.hpp>
 #include <userver/storages/redis/subscribe_client.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/keyshard_impl.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 #include <storages/redis/impl/subscribe_sentinel.hpp>
@@ -65,6 +66,7 @@ struct RedisGroup {
     std::string config_name;
     std::string sharding_strategy;
     bool allow_reads_from_master{false};
+    redis::ClientSideCacheSettings client_side_cache;
 };
 
 RedisGroup Parse(const yaml_config::YamlConfig& value, formats::parse::To<RedisGroup>) {
@@ -73,6 +75,16 @@ RedisGroup Parse(const yaml_config::YamlConfig& value, formats::parse::To<RedisG
     config.config_name = value["config_name"].As<std::string>();
     config.sharding_strategy = value["sharding_strategy"].As<std::string>("");
     config.allow_reads_from_master = value["allow_reads_from_master"].As<bool>(false);
+
+    const auto client_side_cache = value["client_side_cache"];
+    auto& cache_settings = config.client_side_cache;
+    cache_settings.enabled = client_side_cache["enabled"].As<bool>(cache_settings.enabled);
+    cache_settings.max_keys = client_side_cache["max_keys"].As<std::size_t>(cache_settings.max_keys);
+    cache_settings.max_value_size = client_side_cache["max_value_size"].As<std::size_t>(cache_settings.max_value_size);
+    cache_settings.max_hash_fields =
+        client_side_cache["max_hash_fields"].As<std::size_t>(cache_settings.max_hash_fields);
+    cache_settings.max_bytes = client_side_cache["max_bytes"].As<std::size_t>(cache_settings.max_bytes);
+    cache_settings.prefixes = client_side_cache["prefixes"].As<std::vector<std::string>>({});
     return config;
 }
 
@@ -201,6 +213,11 @@ void Redis::Connect(
         redis::CommandControl cc{};
         cc.allow_reads_from_master = redis_group.allow_reads_from_master;
 
+        std::shared_ptr<redis::ClientSideCache> client_side_cache;
+        if (redis_group.client_side_cache.enabled) {
+            client_side_cache = std::make_shared<redis::ClientSideCache>(redis_group.client_side_cache);
+        }
+
         auto sentinel = redis::Sentinel::CreateSentinel(
             thread_pools_,
             settings,
@@ -209,7 +226,8 @@ void Redis::Connect(
             redis_group.db,
             redis::KeyShardFactory{redis_group.sharding_strategy},
             cc,
-            testsuite_redis_control
+            testsuite_redis_control,
+            std::move(client_side_cache)
         );
         if (sentinel) {
             sentinels_.emplace(redis_group.db, sentinel);
@@ -271,6 +289,9 @@ void Redis::WriteStatistics(utils::statistics::Writer& writer) {
     auto settings = metrics_settings_.Read();
     for (const auto& [name, redis] : sentinels_) {
         writer.ValueWithLabels(redis->GetStatistics(*settings), {"redis_database", name});
+        if (const auto& client_side_cache = redis->GetClientSideCache()) {
+            writer["client-side-cache"].ValueWithLabels(*client_side_cache, {"redis_database", name});
+        }
     }
     auto threads_writer = writer["ev_threads"]["cpu_load_percent"];
     threads_writer.ValueWithLabels(*thread_pools_->GetRedisThreadPool(), {});
@@ -363,6 +384,39 @@ properties:
                     type: boolean
                     description: allows read requests from master instance
                     defaultDescription: false
+                client_side_cache:
+                    type: object
+                    description: in-process cache of GET and HGET replies invalidated by the server
+                    additionalProperties: false
+                    properties:
+                        enabled:
+                            type: boolean
+                            description: enables CLIENT TRACKING over RESP3, requires Redis 6+ and hiredis 1.0+
+                            defaultDescription: false
+                        max_keys:
+                            type: integer
+                            description: max cached keys
+                            defaultDescription: 10000
+                            minimum: 1
+                        max_value_size:
+                            type: integer
+                            description: larger values are not cached, in bytes
+                            defaultDescription: 16384
+                        max_hash_fields:
+                            type: integer
+                            description: max cached fields of a single hash
+                            defaultDescription: 64
+                        max_bytes:
+                            type: integer
+                            description: max total size of the cached keys, values and hash fields, in bytes
+                            defaultDescription: 67108864
+                        prefixes:
+                            type: array
+                            description: if not empty, only the keys with the prefixes are cached, tracked in broadcasting mode
+                            defaultDescription: []
+                            items:
+                                type: string
+                                description: key prefix
     metrics_level:
         type: string
         description: set metrics detail level
@@ -0,0 +1,201 @@
+#include <storages/redis/impl/client_side_cache.hpp>
+
+#include <algorithm>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+namespace {
+
+std::size_t GetValueSize(const ClientSideCache::Value& value) noexcept { return value ? value->size() : 0; }
+
+}  // namespace
+
+ClientSideCache::FillToken::FillToken(
+    std::shared_ptr<ClientSideCache> cache,
+    std::string key,
+    std::optional<std::string> field,
+    std::uint64_t ticket
+)
+    : cache_(std::move(cache)), key_(std::move(key)), field_(std::move(field)), ticket_(ticket) {}
+
+void ClientSideCache::FillToken::Store(Value value) && {
+    if (!cache_) return;
+    cache_->Store(key_, field_, ticket_, std::move(value));
+    cache_.reset();
+}
+
+ClientSideCache::ClientSideCache(ClientSideCacheSettings settings)
+    : settings_(std::move(settings)),
+      enabled_(settings_.enabled),
+      entries_(std::max<std::size_t>(settings_.max_keys, 1)) {}
+
+bool ClientSideCache::IsEnabled() const noexcept { return enabled_.load(std::memory_order_relaxed); }
+
+bool ClientSideCache::IsCacheable(const std::string& key) const noexcept {
+    if (!IsEnabled()) return false;
+    if (settings_.prefixes.empty()) return true;
+    return std::any_of(settings_.prefixes.begin(), settings_.prefixes.end(), [&key](const std::string& prefix) {
+        return utils::text::StartsWith(key, prefix);
+    });
+}
+
+std::optional<ClientSideCache::Value> ClientSideCache::Get(const std::string& key) { return Lookup(key, nullptr); }
+
+std::optional<ClientSideCache::Value> ClientSideCache::Hget(const std::string& key, const std::string& field) {
+    return Lookup(key, &field);
+}
+
+ClientSideCache::FillToken
+ClientSideCache::PrepareFill(std::shared_ptr<ClientSideCache> self, std::string key, std::optional<std::string> field) {
+    UASSERT(self.get() == this);
+
+    std::uint64_t ticket = 0;
+    {
+        const std::lock_guard lock(mutex_);
+        auto* entry = entries_.Get(key);
+        if (!entry) {
+            // Emplace evicts the least recently used key if the cache is full
+            if (entries_.GetSize() >= entries_.GetCapacity()) EvictLeastUsed();
+            entry = entries_.Emplace(key);
+            entry->ticket = next_ticket_++;
+            entry->bytes = key.size();
+            bytes_ += entry->bytes;
+        }
+        ticket = entry->ticket;
+    }
+    return FillToken{std::move(self), std::move(key), std::move(field), ticket};
+}
+
+void ClientSideCache::Invalidate(const std::string& key) {
+    {
+        const std::lock_guard lock(mutex_);
+        if (const auto* entry = entries_.Get(key)) {
+            bytes_ -= entry->bytes;
+            entries_.Erase(key);
+        }
+    }
+    ++invalidations_;
+}
+
+void ClientSideCache::InvalidateAll() {
+    {
+        const std::lock_guard lock(mutex_);
+        if (entries_.GetSize() == 0) return;
+        entries_.Clear();
+        bytes_ = 0;
+    }
+    ++flushes_;
+}
+
+void ClientSideCache::Disable() {
+    if (enabled_.exchange(false)) {
+        LOG_ERROR() << "Redis client side cache is disabled, the server does not support tracking over RESP3";
+    }
+    InvalidateAll();
+}
+
+std::optional<ClientSideCache::Value> ClientSideCache::Lookup(const std::string& key, const std::string* field) {
+    std::optional<Value> result;
+    {
+        const std::lock_guard lock(mutex_);
+        auto* entry = entries_.Get(key);
+        if (entry) {
+            if (!field) {
+                result = entry->value;
+            } else {
+                const auto it = entry->hash_fields.find(*field);
+                if (it != entry->hash_fields.end()) result = it->second;
+            }
+        }
+    }
+
+    if (result) {
+        ++hits_;
+    } else {
+        ++misses_;
+    }
+    return result;
+}
+
+void ClientSideCache::Store(
+    const std::string& key,
+    const std::optional<std::string>& field,
+    std::uint64_t ticket,
+    Value value
+) {
+    if (!IsEnabled()) return;
+    if (value && value->size() > settings_.max_value_size) return;
+
+    const std::lock_guard lock(mutex_);
+    auto* entry = entries_.Get(key);
+    // The key was invalidated or evicted since the request was sent
+    if (!entry || entry->ticket != ticket) return;
+
+    const auto old_bytes = entry->bytes;
+    if (!field) {
+        if (entry->value) entry->bytes -= GetValueSize(*entry->value);
+        entry->bytes += GetValueSize(value);
+        entry->value = std::move(value);
+    } else {
+        const auto it = entry->hash_fields.find(*field);
+        if (it != entry->hash_fields.end()) {
+            entry->bytes -= GetValueSize(it->second);
+            entry->bytes += GetValueSize(value);
+            it->second = std::move(value);
+        } else if (entry->hash_fields.size() < settings_.max_hash_fields) {
+            entry->bytes += field->size() + GetValueSize(value);
+            entry->hash_fields.emplace(*field, std::move(value));
+        }
+    }
+    bytes_ = bytes_ - old_bytes + entry->bytes;
+
+    // Do not flush the whole cache for a single oversized key
+    if (entry->bytes > settings_.max_bytes) {
+        bytes_ -= entry->bytes;
+        entries_.Erase(key);
+        return;
+    }
+
+    // The stored key is the most recently used one and goes last
+    while (bytes_ > settings_.max_bytes && entries_.GetSize() != 0) {
+        EvictLeastUsed();
+    }
+}
+
+void ClientSideCache::EvictLeastUsed() {
+    const auto* key = entries_.GetLeastUsedKey();
+    if (!key) return;
+
+    const auto* entry = entries_.GetLeastUsed();
+    UASSERT(entry);
+    UASSERT(bytes_ >= entry->bytes);
+    bytes_ -= entry->bytes;
+    entries_.Erase(std::string{*key});
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const ClientSideCache& cache) {
+    std::size_t size = 0;
+    std::size_t bytes = 0;
+    {
+        const std::lock_guard lock(cache.mutex_);
+        size = cache.entries_.GetSize();
+        bytes = cache.bytes_;
+    }
+    writer["enabled"] = cache.IsEnabled() ? 1 : 0;
+    writer["size"] = size;
+    writer["bytes"] = bytes;
+    writer["hits"] = cache.hits_;
+    writer["misses"] = cache.misses_;
+    writer["invalidations"] = cache.invalidations_;
+    writer["flushes"] = cache.flushes_;
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
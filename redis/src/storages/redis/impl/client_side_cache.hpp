@@ -0,0 +1,144 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+struct ClientSideCacheSettings {
+    bool enabled{false};
+    // Max keys to keep, both strings and hashes
+    std::size_t max_keys{10000};
+    // Larger values are not cached
+    std::size_t max_value_size{16 * 1024};
+    // Max cached fields of a single hash
+    std::size_t max_hash_fields{64};
+    // Max total size of the cached keys, values and hash fields; the least
+    // recently used keys are evicted to stay within the limit
+    std::size_t max_bytes{64 * 1024 * 1024};
+    // If not empty, the server tracks the keys in broadcasting mode and only
+    // the keys with the prefixes are cached
+    std::vector<std::string> prefixes;
+};
+
+/// In-process cache of the GET and HGET replies, kept consistent with the
+/// server by the invalidation messages of `CLIENT TRACKING` over RESP3.
+///
+/// Each connection with tracking enabled reports the invalidated keys via
+/// Invalidate() and calls InvalidateAll() on disconnect, as the tracking state
+/// of the server is lost with the connection. ReplyData converts the RESP3
+/// replies of such connections to their RESP2 form, e.g. flattens the
+/// member-score pairs and returns the booleans as Lua booleans in RESP2.
+///
+/// The cache is bounded both by the count of keys and by the total size of
+/// the cached keys, values and hash fields, in bytes. The per-entry overhead of
+/// the containers is not accounted.
+///
+/// A miss creates a placeholder for the key, the reply is stored only if the
+/// key has not been invalidated since then. That ensures that a reply that
+/// raced with an invalidation is never cached.
+class ClientSideCache final {
+public:
+    // std::nullopt for a nil reply
+    using Value = std::optional<std::string>;
+
+    class FillToken final {
+    public:
+        FillToken(FillToken&&) noexcept = default;
+        FillToken& operator=(FillToken&&) noexcept = default;
+
+        void Store(Value value) &&;
+
+    private:
+        friend class ClientSideCache;
+
+        FillToken(
+            std::shared_ptr<ClientSideCache> cache,
+            std::string key,
+            std::optional<std::string> field,
+            std::uint64_t ticket
+        );
+
+        std::shared_ptr<ClientSideCache> cache_;
+        std::string key_;
+        std::optional<std::string> field_;
+        std::uint64_t ticket_;
+    };
+
+    explicit ClientSideCache(ClientSideCacheSettings settings);
+
+    const ClientSideCacheSettings& GetSettings() const noexcept { return settings_; }
+
+    /// False if disabled by the config or by a connection that failed to
+    /// enable tracking
+    bool IsEnabled() const noexcept;
+
+    /// Whether the key is cached at all, considering the prefixes
+    bool IsCacheable(const std::string& key) const noexcept;
+
+    /// @returns the cached reply to GET, std::nullopt on a miss
+    std::optional<Value> Get(const std::string& key);
+
+    /// @returns the cached reply to HGET, std::nullopt on a miss
+    std::optional<Value> Hget(const std::string& key, const std::string& field);
+
+    /// Call on a miss before sending the request, store the reply via the
+    /// token
+    FillToken PrepareFill(std::shared_ptr<ClientSideCache> self, std::string key, std::optional<std::string> field);
+
+    /// Called from the event threads
+    void Invalidate(const std::string& key);
+    void InvalidateAll();
+
+    /// Permanently disables the cache, e.g. if the server does not support
+    /// tracking
+    void Disable();
+
+private:
+    struct Entry {
+        std::uint64_t ticket{0};
+        // GET reply, if known
+        std::optional<Value> value;
+        // HGET replies
+        std::unordered_map<std::string, Value> hash_fields;
+        // Size of the key, the value and the hash fields
+        std::size_t bytes{0};
+    };
+
+    std::optional<Value> Lookup(const std::string& key, const std::string* field);
+    void Store(const std::string& key, const std::optional<std::string>& field, std::uint64_t ticket, Value value);
+    void EvictLeastUsed();
+
+    friend void DumpMetric(utils::statistics::Writer& writer, const ClientSideCache& cache);
+
+    const ClientSideCacheSettings settings_;
+    std::atomic<bool> enabled_;
+
+    mutable std::mutex mutex_;
+    cache::LruMap<std::string, Entry> entries_;
+    std::size_t bytes_{0};
+    std::uint64_t next_ticket_{1};
+
+    utils::statistics::RateCounter hits_;
+    utils::statistics::RateCounter misses_;
+    utils::statistics::RateCounter invalidations_;
+    utils::statistics::RateCounter flushes_;
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const ClientSideCache& cache);
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
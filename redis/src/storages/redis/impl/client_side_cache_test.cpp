@@ -0,0 +1,144 @@
+#include <storages/redis/impl/client_side_cache.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Value = redis::ClientSideCache::Value;
+
+std::shared_ptr<redis::ClientSideCache> MakeCache(redis::ClientSideCacheSettings settings = {}) {
+    settings.enabled = true;
+    return std::make_shared<redis::ClientSideCache>(std::move(settings));
+}
+
+}  // namespace
+
+TEST(RedisClientSideCache, GetMissThenHit) {
+    auto cache = MakeCache();
+    EXPECT_EQ(cache->Get("key"), std::nullopt);
+
+    cache->PrepareFill(cache, "key", std::nullopt).Store("value");
+    EXPECT_EQ(cache->Get("key"), std::optional<Value>{"value"});
+}
+
+TEST(RedisClientSideCache, Nil) {
+    auto cache = MakeCache();
+    cache->PrepareFill(cache, "key", std::nullopt).Store(std::nullopt);
+
+    const auto cached = cache->Get("key");
+    ASSERT_TRUE(cached);
+    EXPECT_EQ(*cached, std::nullopt);
+}
+
+TEST(RedisClientSideCache, Hget) {
+    auto cache = MakeCache();
+    cache->PrepareFill(cache, "key", "field").Store("value");
+
+    EXPECT_EQ(cache->Hget("key", "field"), std::optional<Value>{"value"});
+    EXPECT_EQ(cache->Hget("key", "other"), std::nullopt);
+    // GET and HGET replies of the same key are cached independently
+    EXPECT_EQ(cache->Get("key"), std::nullopt);
+}
+
+TEST(RedisClientSideCache, InvalidatedBeforeFill) {
+    auto cache = MakeCache();
+    auto fill_token = cache->PrepareFill(cache, "key", std::nullopt);
+
+    // The reply may be stale already
+    cache->Invalidate("key");
+    std::move(fill_token).Store("value");
+    EXPECT_EQ(cache->Get("key"), std::nullopt);
+
+    // A later read caches the fresh value
+    cache->PrepareFill(cache, "key", std::nullopt).Store("new-value");
+    EXPECT_EQ(cache->Get("key"), std::optional<Value>{"new-value"});
+}
+
+TEST(RedisClientSideCache, InvalidateAll) {
+    auto cache = MakeCache();
+    cache->PrepareFill(cache, "a", std::nullopt).Store("1");
+    auto fill_token = cache->PrepareFill(cache, "b", std::nullopt);
+
+    cache->InvalidateAll();
+    std::move(fill_token).Store("2");
+    EXPECT_EQ(cache->Get("a"), std::nullopt);
+    EXPECT_EQ(cache->Get("b"), std::nullopt);
+}
+
+TEST(RedisClientSideCache, Limits) {
+    redis::ClientSideCacheSettings settings;
+    settings.max_keys = 2;
+    settings.max_value_size = 4;
+    settings.max_hash_fields = 1;
+    auto cache = MakeCache(settings);
+
+    cache->PrepareFill(cache, "big", std::nullopt).Store("too-big");
+    EXPECT_EQ(cache->Get("big"), std::nullopt);
+
+    cache->PrepareFill(cache, "hash", "a").Store("1");
+    cache->PrepareFill(cache, "hash", "b").Store("2");
+    EXPECT_EQ(cache->Hget("hash", "a"), std::optional<Value>{"1"});
+    EXPECT_EQ(cache->Hget("hash", "b"), std::nullopt);
+
+    cache->PrepareFill(cache, "a", std::nullopt).Store("1");
+    cache->PrepareFill(cache, "b", std::nullopt).Store("2");
+    // The least recently used key is evicted
+    EXPECT_EQ(cache->Get("hash"), std::nullopt);
+    EXPECT_EQ(cache->Get("a"), std::optional<Value>{"1"});
+    EXPECT_EQ(cache->Get("b"), std::optional<Value>{"2"});
+}
+
+TEST(RedisClientSideCache, MaxBytes) {
+    redis::ClientSideCacheSettings settings;
+    // Two keys of 1 byte with 4-byte values, hash fields are accounted too
+    settings.max_bytes = 10;
+    auto cache = MakeCache(settings);
+
+    cache->PrepareFill(cache, "a", std::nullopt).Store("1111");
+    cache->PrepareFill(cache, "b", std::nullopt).Store("2222");
+    EXPECT_EQ(cache->Get("a"), std::optional<Value>{"1111"});
+    EXPECT_EQ(cache->Get("b"), std::optional<Value>{"2222"});
+
+    // "a" is the least recently used key now
+    cache->PrepareFill(cache, "c", "f").Store("33");
+    EXPECT_EQ(cache->Get("a"), std::nullopt);
+    EXPECT_EQ(cache->Get("b"), std::optional<Value>{"2222"});
+    EXPECT_EQ(cache->Hget("c", "f"), std::optional<Value>{"33"});
+
+    // A key larger than the limit is not kept at all
+    cache->PrepareFill(cache, "big", std::nullopt).Store("12345678");
+    EXPECT_EQ(cache->Get("big"), std::nullopt);
+
+    // Invalidation releases the bytes
+    cache->Invalidate("b");
+    cache->PrepareFill(cache, "d", std::nullopt).Store("4444");
+    EXPECT_EQ(cache->Hget("c", "f"), std::optional<Value>{"33"});
+    EXPECT_EQ(cache->Get("d"), std::optional<Value>{"4444"});
+}
+
+TEST(RedisClientSideCache, Prefixes) {
+    redis::ClientSideCacheSettings settings;
+    settings.prefixes = {"user:", "session:"};
+    auto cache = MakeCache(settings);
+
+    EXPECT_TRUE(cache->IsCacheable("user:1"));
+    EXPECT_TRUE(cache->IsCacheable("session:1"));
+    EXPECT_FALSE(cache->IsCacheable("order:1"));
+}
+
+TEST(RedisClientSideCache, Disable) {
+    auto cache = MakeCache();
+    cache->PrepareFill(cache, "key", std::nullopt).Store("value");
+    auto fill_token = cache->PrepareFill(cache, "other", std::nullopt);
+
+    cache->Disable();
+    std::move(fill_token).Store("value");
+    EXPECT_FALSE(cache->IsEnabled());
+    EXPECT_FALSE(cache->IsCacheable("key"));
+    EXPECT_EQ(cache->Get("key"), std::nullopt);
+    EXPECT_EQ(cache->Get("other"), std::nullopt);
+}
+
+USERVER_NAMESPACE_END
@@ -4,7 +4,6 @@
 
 #include <fmt/format.h>
 #include <boost/container_hash/hash.hpp>
-#include <boost/crc.hpp>
 
 #include <userver/concurrent/variable.hpp>
 #include <userver/logging/log.hpp>
@@ -63,13 +62,6 @@ struct NodeAddressesHasher {
 using NodesAddressesSet = std::unordered_set<NodeAddresses, NodeAddressesHasher>;
 using HostPort = std::string;
 
-size_t HashSlot(const std::string& key) {
-    size_t start = 0;
-    size_t len = 0;
-    GetRedisKey(key, &start, &len);
-    return std::for_each(key.data() + start, key.data() + start + len, boost::crc_optimal<16, 0x1021>())() & 0x3fff;
-}
-
 std::string ParseMovedShard(const std::string& err_string) {
     static const auto kUnknownShard = std::string("");
     size_t pos = err_string.find(' ');  // skip "MOVED" or "ASK"
@@ -157,12 +149,14 @@ public:
         std::string shard_group_name,
         Password password,
         const std::vector<std::string>& /*shards*/,
-        const std::vector<ConnectionInfo>& conns
+        const std::vector<ConnectionInfo>& conns,
+        std::shared_ptr<ClientSideCache> client_side_cache
     )
         : ev_thread_(sentinel_thread_control),
           redis_thread_pool_(redis_thread_pool),
           shard_group_name_(std::move(shard_group_name)),
           password_(std::move(password)),
+          client_side_cache_(std::move(client_side_cache)),
           shards_names_(MakeShardNames()),
           conns_(conns),
           update_topology_timer_(
@@ -365,6 +359,7 @@ private:
 
     std::string shard_group_name_;
     Password password_;
+    const std::shared_ptr<ClientSideCache> client_side_cache_;
     std::shared_ptr<const std::vector<std::string>> shards_names_;
     std::vector<ConnectionInfo> conns_;
     std::shared_ptr<Shard> sentinels_;
@@ -651,7 +646,8 @@ std::shared_ptr<RedisConnectionHolder> ClusterTopologyHolder::CreateRedisInstanc
         password_,
         buffering_settings_ptr->value_or(CommandsBufferingSettings{}),
         *replication_monitoring_settings_ptr,
-        *retry_budget_settings_ptr
+        *retry_budget_settings_ptr,
+        client_side_cache_
     );
 }
 
@@ -765,7 +761,8 @@ ClusterSentinelImpl::ClusterSentinelImpl(
     ReadyChangeCallback ready_callback,
     std::unique_ptr<KeyShard>&& /*key_shard*/,
     dynamic_config::Source dynamic_config_source,
-    ConnectionMode /*mode*/
+    ConnectionMode /*mode*/,
+    std::shared_ptr<ClientSideCache> client_side_cache
 )
     : sentinel_obj_(sentinel),
       ev_thread_(sentinel_thread_control),
@@ -774,9 +771,15 @@ ClusterSentinelImpl::ClusterSentinelImpl(
           [this] { ProcessWaitingCommands(); },
           kSentinelGetHostsCheckInterval
       )),
-      topology_holder_(std::make_shared<
-                       ClusterTopologyHolder>(ev_thread_, redis_thread_pool, shard_group_name, password, shards, conns)
-      ),
+      topology_holder_(std::make_shared<ClusterTopologyHolder>(
+          ev_thread_,
+          redis_thread_pool,
+          shard_group_name,
+          password,
+          shards,
+          conns,
+          std::move(client_side_cache)
+      )),
       shard_group_name_(std::move(shard_group_name)),
       conns_(conns),
       ready_callback_(std::move(ready_callback)),
@@ -973,7 +976,7 @@ void ClusterSentinelImpl::AsyncCommandToSentinel(CommandPtr /*command*/) {
 }
 
 size_t ClusterSentinelImpl::ShardByKey(const std::string& key) const {
-    const auto slot = HashSlot(key);
+    const auto slot = GetClusterHashSlot(key);
     const auto ptr = topology_holder_->GetTopology();
     return ptr->GetShardIndexBySlot(slot);
 }
@@ -34,7 +34,8 @@ public:
         ReadyChangeCallback ready_callback,
         std::unique_ptr<KeyShard>&& key_shard,
         dynamic_config::Source dynamic_config_source,
-        ConnectionMode mode = ConnectionMode::kCommands
+        ConnectionMode mode = ConnectionMode::kCommands,
+        std::shared_ptr<ClientSideCache> client_side_cache = {}
     );
     ~ClusterSentinelImpl() override;
 
@@ -55,6 +55,13 @@ void GetRedisKey(const std::string& key, size_t* key_start, size_t* key_len) {
 KeyShardTaximeterCrc32::KeyShardTaximeterCrc32(size_t shard_count)
     : shard_count_(shard_count), converter_(kRawKeyEncoding, kTaximeterCrcKeyEncoding) {}
 
+size_t GetClusterHashSlot(const std::string& key) {
+    size_t start = 0;
+    size_t len = 0;
+    GetRedisKey(key, &start, &len);
+    return std::for_each(key.data() + start, key.data() + start + len, boost::crc_optimal<16, 0x1021>())() & 0x3fff;
+}
+
 size_t KeyShardCrc32::ShardByKey(const std::string& key) const {
     UASSERT(shard_count_ > 0);
     size_t start = 0;
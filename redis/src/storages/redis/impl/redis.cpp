@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <chrono>
 #include <deque>
+#include <map>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -24,11 +25,14 @@
 #include <userver/utils/retry_budget.hpp>
 #include <userver/utils/swappingsmart.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/command.hpp>
 #include <storages/redis/impl/ev_wrapper.hpp>
 #include <storages/redis/impl/redis_info.hpp>
 #include <storages/redis/impl/redis_stats.hpp>
+#include <storages/redis/impl/reply_reader.hpp>
 #include <storages/redis/impl/tcp_socket.hpp>
+#include <userver/storages/redis/impl/keyshard.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
 
 #include "command_control_impl.hpp"
@@ -113,6 +117,14 @@ inline bool IsExecCommand(const CmdArgs::CmdArgsArray& args) {
     return AreStringsEqualIgnoreCase(args[0], exec_command);
 }
 
+inline bool IsMergeableGet(const CommandPtr& command) {
+    static const std::string get_command{"GET"};
+
+    if (command->asking || command->args.args.size() != 1) return false;
+    const auto& args = command->args.args.front();
+    return args.size() == 2 && AreStringsEqualIgnoreCase(args[0], get_command);
+}
+
 bool IsFinalState(Redis::State state) {
     return state == Redis::State::kDisconnected || state == Redis::State::kDisconnectError;
 }
@@ -189,6 +201,7 @@ private:
     static void OnRedisReply(redisAsyncContext* c, void* r, void* privdata) noexcept;
     static void OnConnect(const redisAsyncContext* c, int status) noexcept;
     static void OnDisconnect(const redisAsyncContext* c, int status) noexcept;
+    static void OnPush(redisAsyncContext* c, void* r) noexcept;
     static void OnTimerPing(struct ev_loop* loop, ev_timer* w, int revents) noexcept;
     static void OnTimerInfo(struct ev_loop* loop, ev_timer* w, int revents) noexcept;
     static void OnConnectTimeout(struct ev_loop* loop, ev_timer* w, int revents) noexcept;
@@ -196,6 +209,7 @@ private:
 
     void OnConnectImpl(int status);
     void OnDisconnectImpl(int status);
+    void OnPushImpl(const redisReply* redis_reply);
     bool InitSecureConnection();
     void InvokeCommand(const CommandPtr& command, ReplyPtr&& reply);
     void InvokeCommandError(
@@ -220,9 +234,15 @@ private:
 
     void SetState(State state);
     void ProcessCommand(const CommandPtr& command);
+    void MergeGets(std::deque<CommandPtr>& commands, size_t max_merged_gets);
+    CommandPtr MakeMergedGet(std::vector<CommandPtr>&& gets);
 
     void Authenticate();
+    void OnAuthenticated();
+    void EnableClientTracking();
+    void OnClientTrackingFailed(std::string_view command, const ReplyPtr& reply);
     void SendReadOnly();
+    void FinishConnecting();
     void FreeCommands();
 
     static void LogSocketErrorReply(const CommandPtr& command, const ReplyPtr& reply);
@@ -278,6 +298,8 @@ private:
     std::atomic_bool forbid_requests_to_syncing_replicas_ = false;
     const bool send_readonly_;
     const ConnectionSecurity connection_security_;
+    const std::shared_ptr<ClientSideCache> client_side_cache_;
+    const bool cluster_mode_;
     std::chrono::milliseconds ping_interval_{2000};
     std::chrono::milliseconds ping_timeout_{4000};
     std::chrono::milliseconds info_replication_interval_{2000};
@@ -370,6 +392,8 @@ Redis::RedisImpl::RedisImpl(
       thread_pool_(thread_pool),
       send_readonly_(redis_settings.send_readonly),
       connection_security_(redis_settings.connection_security),
+      client_side_cache_(redis_settings.client_side_cache),
+      cluster_mode_(redis_settings.cluster_mode),
       server_id_(ServerId::Generate()),
       retry_budget_(utils::RetryBudgetSettings{100, 0.1, false}) {
     SetCommandsBufferingSettings(CommandsBufferingSettings{});
@@ -452,6 +476,8 @@ bool Redis::RedisImpl::Connect(const std::string& host, int port, const Password
         context_ = nullptr;
         return false;
     }
+    // Must be set before the first reply is read
+    context_->c.reader->fn = GetReplyObjectFunctions();
 
     ev_thread_control_.RunInEvLoopBlocking([this, &host]() {
         bool err = false;
@@ -867,7 +893,8 @@ void Redis::RedisImpl::CommandLoopOnTimer(struct ev_loop*, ev_timer* w, int) noe
 }
 
 void Redis::RedisImpl::CommandLoopImpl() {
-    if (WatchCommandTimerEnabled(*commands_buffering_settings_.Get())) {
+    const auto commands_buffering_settings = commands_buffering_settings_.Get();
+    if (WatchCommandTimerEnabled(*commands_buffering_settings)) {
         if (std::exchange(watch_command_timer_started_, false)) {
             ev_thread_control_.Stop(watch_command_timer_);
         }
@@ -879,11 +906,92 @@ void Redis::RedisImpl::CommandLoopImpl() {
         std::swap(commands_, commands);
     }
     LOG_TRACE() << "commands size=" << commands.size();
+    if (commands_buffering_settings->max_merged_gets > 1 && commands.size() > 1) {
+        MergeGets(commands, commands_buffering_settings->max_merged_gets);
+    }
     for (auto& command : commands) {
         ProcessCommand(command);
     }
 }
 
+void Redis::RedisImpl::MergeGets(std::deque<CommandPtr>& commands, size_t max_merged_gets) {
+    // GETs are reordered only relative to each other, so a run of them ends on
+    // any other command. In cluster mode the keys of MGET must be in a single
+    // slot, keys with the same hash tag always are.
+    using GroupKey = std::pair<std::string_view, std::chrono::milliseconds>;
+    std::map<GroupKey, std::vector<CommandPtr>> run;
+    std::deque<CommandPtr> result;
+
+    const auto flush = [this, &result](std::vector<CommandPtr>&& gets) {
+        if (gets.size() == 1) {
+            result.push_back(std::move(gets.front()));
+        } else {
+            result.push_back(MakeMergedGet(std::move(gets)));
+        }
+    };
+    const auto flush_run = [&run, &flush] {
+        for (auto& [group_key, gets] : run) flush(std::move(gets));
+        run.clear();
+    };
+
+    for (auto& command : commands) {
+        if (!IsMergeableGet(command)) {
+            flush_run();
+            result.push_back(std::move(command));
+            continue;
+        }
+
+        std::string_view slot_key;
+        if (cluster_mode_) {
+            const auto& key = command->args.args.front()[1];
+            size_t key_start = 0;
+            size_t key_len = 0;
+            GetRedisKey(key, &key_start, &key_len);
+            slot_key = std::string_view{key}.substr(key_start, key_len);
+        }
+
+        const auto it = run.try_emplace({slot_key, CommandControlImpl{command->control}.timeout_single}).first;
+        it->second.push_back(std::move(command));
+        if (it->second.size() >= max_merged_gets) {
+            flush(std::move(it->second));
+            run.erase(it);
+        }
+    }
+    flush_run();
+
+    commands = std::move(result);
+}
+
+CommandPtr Redis::RedisImpl::MakeMergedGet(std::vector<CommandPtr>&& gets) {
+    std::vector<std::string> keys;
+    keys.reserve(gets.size());
+    for (const auto& get : gets) {
+        get->ResetStartHandlingTime();
+        keys.push_back(get->args.args.front()[1]);
+    }
+
+    // Each GET is accounted in statistics on its own
+    auto control = gets.front()->control;
+    control.account_in_statistics = false;
+
+    return PrepareCommand(
+        CmdArgs{"MGET", std::move(keys)},
+        [this, gets = std::move(gets)](const CommandPtr&, ReplyPtr reply) {
+            const bool is_split =
+                reply->IsOk() && reply->data.IsArray() && reply->data.GetArray().size() == gets.size();
+            for (size_t i = 0; i < gets.size(); ++i) {
+                const auto& name = gets[i]->args.args.front()[0];
+                // Errors, timeouts and redirections are the same for all the keys
+                auto get_reply = is_split ? std::make_shared<Reply>(name, std::move(reply->data.GetArray()[i]))
+                                          : std::make_shared<Reply>(*reply);
+                get_reply->cmd = name;
+                InvokeCommand(gets[i], std::move(get_reply));
+            }
+        },
+        control
+    );
+}
+
 void Redis::RedisImpl::OnConnect(const redisAsyncContext* c, int status) noexcept {
     auto* impl = static_cast<Redis::RedisImpl*>(c->data);
     UASSERT(impl != nullptr);
@@ -904,6 +1012,16 @@ void Redis::RedisImpl::OnDisconnect(const redisAsyncContext* c, int status) noex
     }
 }
 
+void Redis::RedisImpl::OnPush(redisAsyncContext* c, void* r) noexcept {
+    auto* impl = static_cast<Redis::RedisImpl*>(c->data);
+    UASSERT(impl != nullptr);
+    try {
+        if (r) impl->OnPushImpl(static_cast<const redisReply*>(r));
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "OnPushImpl() failed: " << ex;
+    }
+}
+
 void Redis::RedisImpl::OnConnectImpl(int status) {
     ev_thread_control_.Stop(connect_timer_);
 
@@ -940,6 +1058,9 @@ void Redis::RedisImpl::OnDisconnectImpl(int status) {
                                  "https://wiki.yandex-team.ru/taxi/backend/userver/redis/"
                                  "#logiservera).";
     }
+    // The server forgets the tracked keys with the connection, so invalidations
+    // for the keys read from it are no longer delivered
+    if (client_side_cache_) client_side_cache_->InvalidateAll();
     SetState(status == REDIS_OK ? State::kDisconnected : State::kDisconnectError);
     context_ = nullptr;
     self_.reset();
@@ -969,21 +1090,33 @@ bool Redis::RedisImpl::InitSecureConnection() {
 #endif
 }
 
+void Redis::RedisImpl::OnPushImpl(const redisReply* redis_reply) {
+    if (!client_side_cache_) return;
+
+    // ["invalidate", [key, ...]] or ["invalidate", nil] on FLUSHALL/FLUSHDB
+    const ReplyData data(redis_reply);
+    if (!data.IsArray()) return;
+    const auto& array = data.GetArray();
+    if (array.size() != 2 || !array[0].IsString() || array[0].GetString() != "invalidate") return;
+
+    if (array[1].IsArray()) {
+        for (const auto& key : array[1].GetArray()) {
+            if (key.IsString()) client_side_cache_->Invalidate(key.GetString());
+        }
+    } else {
+        client_side_cache_->InvalidateAll();
+    }
+}
+
 void Redis::RedisImpl::Authenticate() {
     if (password_.GetUnderlying().empty()) {
-        if (send_readonly_)
-            SendReadOnly();
-        else
-            SetState(State::kConnected);
+        OnAuthenticated();
     } else {
         ProcessCommand(PrepareCommand(
             CmdArgs{"AUTH", password_.GetUnderlying()},
             [this](const CommandPtr&, ReplyPtr reply) {
                 if (*reply && reply->data.IsStatus()) {
-                    if (send_readonly_)
-                        SendReadOnly();
-                    else
-                        SetState(State::kConnected);
+                    OnAuthenticated();
                 } else {
                     if (*reply) {
                         if (reply->IsUnknownCommandError()) {
@@ -1009,6 +1142,71 @@ void Redis::RedisImpl::Authenticate() {
     }
 }
 
+void Redis::RedisImpl::OnAuthenticated() {
+    if (client_side_cache_ && client_side_cache_->IsEnabled() && !subscriber_) {
+        EnableClientTracking();
+    } else {
+        FinishConnecting();
+    }
+}
+
+void Redis::RedisImpl::EnableClientTracking() {
+#ifdef REDIS_REPLY_PUSH
+    redisAsyncSetPushCallback(context_, OnPush);
+    ProcessCommand(PrepareCommand(CmdArgs{"HELLO", "3"}, [this](const CommandPtr&, ReplyPtr reply) {
+        if (!*reply || !reply->data.IsArray()) {
+            OnClientTrackingFailed("HELLO", reply);
+            return;
+        }
+
+        std::vector<std::string> args{"CLIENT", "TRACKING", "ON"};
+        const auto& prefixes = client_side_cache_->GetSettings().prefixes;
+        if (!prefixes.empty()) {
+            args.emplace_back("BCAST");
+            for (const auto& prefix : prefixes) {
+                args.emplace_back("PREFIX");
+                args.push_back(prefix);
+            }
+        }
+
+        ProcessCommand(PrepareCommand(CmdArgs{std::move(args)}, [this](const CommandPtr&, ReplyPtr reply) {
+            if (*reply && reply->data.IsStatus()) {
+                FinishConnecting();
+            } else {
+                OnClientTrackingFailed("CLIENT TRACKING", reply);
+            }
+        }));
+    }));
+#else
+    LOG_ERROR() << log_extra_ << "Redis client side cache requires hiredis with RESP3 support";
+    client_side_cache_->Disable();
+    FinishConnecting();
+#endif
+}
+
+void Redis::RedisImpl::OnClientTrackingFailed(std::string_view command, const ReplyPtr& reply) {
+    if (!*reply) {
+        LOG_LIMITED_ERROR() << command << " failed with status=" << reply->status << " (" << reply->status_string
+                            << ") " << log_extra_;
+        Disconnect();
+        return;
+    }
+
+    // The server is too old for RESP3 or tracking, the cache would never be
+    // invalidated
+    LOG_ERROR() << log_extra_ << command << " failed: response type=" << reply->data.GetTypeString()
+                << " msg=" << reply->data.ToDebugString();
+    client_side_cache_->Disable();
+    FinishConnecting();
+}
+
+void Redis::RedisImpl::FinishConnecting() {
+    if (send_readonly_)
+        SendReadOnly();
+    else
+        SetState(State::kConnected);
+}
+
 void Redis::RedisImpl::SendReadOnly() {
     LOG_DEBUG() << "Send READONLY command to slave " << GetServerId().GetDescription() << " in cluster mode";
     ProcessCommand(PrepareCommand(CmdArgs{"READONLY"}, [this](const CommandPtr&, ReplyPtr reply) {
@@ -1053,7 +1251,10 @@ void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
     ev_thread_control_.Stop(data->second->timer);
     pcommand = data->second.get();
 
-    auto reply = std::make_shared<Reply>(pcommand->cmd, redis_reply, NativeToReplyStatus(status), errstr ? errstr : "");
+    // The payload is moved out of the hiredis reply, it is freed right after the callback
+    auto reply = std::make_shared<Reply>(pcommand->cmd, TakeReplyData(redis_reply));
+    reply->status = NativeToReplyStatus(status);
+    reply->status_string = errstr ? errstr : "";
 
     // After 'subscribe x' + 'unsubscribe x' + 'subscribe x' requests
     // 'unsubscribe' reply can be received as a reply to the second subscribe
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <unordered_map>
 
 #include <userver/storages/redis/impl/base.hpp>
@@ -8,9 +9,15 @@ USERVER_NAMESPACE_BEGIN
 
 namespace redis {
 
+class ClientSideCache;
+
 struct RedisCreationSettings {
     ConnectionSecurity connection_security = ConnectionSecurity::kNone;
     bool send_readonly{false};
+    // Enables CLIENT TRACKING on the connection if set and enabled
+    std::shared_ptr<ClientSideCache> client_side_cache;
+    // Keys of a single command must be in the same hash slot
+    bool cluster_mode{false};
 };
 
 }  // namespace redis
@@ -19,10 +19,22 @@ ReplyData::ReplyData(const redisReply* reply) {
 
     switch (reply->type) {
         case REDIS_REPLY_STRING:
+#ifdef REDIS_REPLY_MAP
+        // RESP3 scalars are returned as in RESP2
+        case REDIS_REPLY_DOUBLE:
+        case REDIS_REPLY_VERB:
+        case REDIS_REPLY_BIGNUM:
+#endif
             type_ = Type::kString;
             string_ = std::string(reply->str, reply->len);
             break;
         case REDIS_REPLY_ARRAY:
+#ifdef REDIS_REPLY_MAP
+        // RESP3 aggregates, a map is kept flattened as in RESP2
+        case REDIS_REPLY_MAP:
+        case REDIS_REPLY_SET:
+        case REDIS_REPLY_PUSH:
+#endif
             type_ = Type::kArray;
             array_.reserve(reply->elements);
             for (size_t i = 0; i < reply->elements; i++) array_.emplace_back(reply->element[i]);
@@ -31,6 +43,17 @@ ReplyData::ReplyData(const redisReply* reply) {
             type_ = Type::kInteger;
             integer_ = reply->integer;
             break;
+#ifdef REDIS_REPLY_MAP
+        case REDIS_REPLY_BOOL:
+            // As the Lua booleans are returned in RESP2: true is 1, false is nil
+            if (reply->integer) {
+                type_ = Type::kInteger;
+                integer_ = 1;
+            } else {
+                type_ = Type::kNil;
+            }
+            break;
+#endif
         case REDIS_REPLY_NIL:
             type_ = Type::kNil;
             break;
@@ -66,6 +89,13 @@ ReplyData ReplyData::CreateStatus(std::string&& status_msg) {
     return data;
 }
 
+ReplyData ReplyData::CreateInteger(int64_t value) {
+    ReplyData data;
+    data.type_ = Type::kInteger;
+    data.integer_ = value;
+    return data;
+}
+
 ReplyData ReplyData::CreateNil() {
     ReplyData data;
     data.type_ = Type::kNil;
@@ -113,6 +143,17 @@ ReplyData::KeyValues ReplyData::GetKeyValues() const {
 ReplyData::MovableKeyValues ReplyData::GetMovableKeyValues() {
     if (!IsArray())
         throw ParseReplyException("Incorrect ReplyData type: expected kArray, found " + TypeToString(GetType()));
+    // RESP3 returns the pairs of e.g. ZRANGE WITHSCORES as [[member, score], ...]
+    if (!array_.empty() && array_.front().IsArray()) {
+        Array flat;
+        flat.reserve(array_.size() * 2);
+        for (auto& elem : array_) {
+            if (!elem.IsArray() || elem.GetArray().size() != 2)
+                throw ParseReplyException("Non-pair element (" + elem.ToDebugString() + ')');
+            for (auto& item : elem.GetArray()) flat.push_back(std::move(item));
+        }
+        array_ = std::move(flat);
+    }
     if (GetArray().size() & 1) throw ParseReplyException("Array size is odd: " + std::to_string(GetArray().size()));
     for (const auto& elem : GetArray())
         if (!elem.IsString()) throw ParseReplyException("Non-string element (" + elem.GetTypeString() + ')');
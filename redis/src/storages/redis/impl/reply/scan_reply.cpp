@@ -9,9 +9,9 @@ namespace redis {
 ScanReply ScanReply::parse(ReplyPtr reply) {
     reply->ExpectArray();
 
-    const ReplyData& data = reply->data;
+    ReplyData& data = reply->data;
 
-    const ReplyData::Array& top_array = data.GetArray();
+    ReplyData::Array& top_array = data.GetArray();
     if (top_array.size() != 2) {
         throw ParseReplyException(
             "Unexpected SCAN reply size: expected 2 elements, received " + std::to_string(top_array.size())
@@ -26,7 +26,7 @@ ScanReply ScanReply::parse(ReplyPtr reply) {
         );
     }
 
-    const ReplyData& keys_elem = top_array[1];
+    ReplyData& keys_elem = top_array[1];
     if (!keys_elem.IsArray()) {
         throw ParseReplyException(
             "Unexpected SCAN reply format: expected " + ReplyData::TypeToString(ReplyData::Type::kArray) +
@@ -35,11 +35,11 @@ ScanReply ScanReply::parse(ReplyPtr reply) {
     }
 
     const ScanCursor cursor = cursor_elem.GetInt();
-    const ReplyData::Array& keys_data = keys_elem.GetArray();
+    ReplyData::Array& keys_data = keys_elem.GetArray();
 
     std::vector<std::string> keys;
     keys.reserve(keys_data.size());
-    for (const ReplyData& key_data : keys_data) {
+    for (ReplyData& key_data : keys_data) {
         if (!key_data.IsString()) {
             throw ParseReplyException(
                 "Unexpected SCAN reply format: expected keys of type " +
@@ -47,7 +47,7 @@ ScanReply ScanReply::parse(ReplyPtr reply) {
                 key_data.GetTypeString() + " type"
             );
         }
-        keys.emplace_back(key_data.GetString());
+        keys.push_back(std::move(key_data.GetString()));
     }
 
     ScanReply result;
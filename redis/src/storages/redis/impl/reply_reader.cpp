@@ -0,0 +1,210 @@
+#include <storages/redis/impl/reply_reader.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <type_traits>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+namespace {
+
+// hiredis only sees `reply`, `payload` owns the memory of `reply.str`
+struct ReplyNode {
+    redisReply reply{};
+    std::string payload;
+};
+
+static_assert(std::is_standard_layout_v<ReplyNode>);
+static_assert(offsetof(ReplyNode, reply) == 0, "ReplyNode must be pointer-interconvertible with redisReply");
+
+ReplyNode* ToNode(redisReply* reply) noexcept { return reinterpret_cast<ReplyNode*>(reply); }
+
+// Returns nullptr on allocation failure, as expected by hiredis
+ReplyNode* CreateNode(const redisReadTask* task) noexcept {
+    auto* node = new (std::nothrow) ReplyNode{};
+    if (node) node->reply.type = task->type;
+    return node;
+}
+
+void* AttachNode(const redisReadTask* task, ReplyNode* node) noexcept {
+    if (task->parent) {
+        auto* parent = static_cast<redisReply*>(task->parent->obj);
+        UASSERT(parent->element);
+        parent->element[task->idx] = &node->reply;
+    }
+    return &node->reply;
+}
+
+void FreeObject(void* obj) noexcept {
+    auto* reply = static_cast<redisReply*>(obj);
+    if (!reply) return;
+
+    if (reply->element) {
+        for (std::size_t i = 0; i < reply->elements; ++i) FreeObject(reply->element[i]);
+        std::free(reply->element);
+    }
+    delete ToNode(reply);
+}
+
+bool SetPayload(ReplyNode* node, const char* str, std::size_t len) noexcept {
+    try {
+        node->payload.assign(str, len);
+    } catch (const std::bad_alloc&) {
+        return false;
+    }
+    node->reply.str = node->payload.data();
+    node->reply.len = node->payload.size();
+    return true;
+}
+
+void* CreateString(const redisReadTask* task, char* str, std::size_t len) noexcept {
+    auto* node = CreateNode(task);
+    if (!node) return nullptr;
+
+#ifdef REDIS_REPLY_MAP
+    if (task->type == REDIS_REPLY_VERB) {
+        // "txt:payload", the format is kept apart as hiredis does
+        UASSERT(len >= 4);
+        std::memcpy(node->reply.vtype, str, 3);
+        node->reply.vtype[3] = '\0';
+        str += 4;
+        len -= 4;
+    }
+#endif
+    if (!SetPayload(node, str, len)) {
+        delete node;
+        return nullptr;
+    }
+    return AttachNode(task, node);
+}
+
+// The number of elements is int in hiredis 0.x and size_t in 1.x
+template <typename Size>
+void* CreateArray(const redisReadTask* task, Size elements) noexcept {
+    auto* node = CreateNode(task);
+    if (!node) return nullptr;
+
+    if (elements > 0) {
+        node->reply.element = static_cast<redisReply**>(std::calloc(elements, sizeof(redisReply*)));
+        if (!node->reply.element) {
+            delete node;
+            return nullptr;
+        }
+    }
+    node->reply.elements = elements;
+    return AttachNode(task, node);
+}
+
+void* CreateInteger(const redisReadTask* task, long long value) noexcept {
+    auto* node = CreateNode(task);
+    if (!node) return nullptr;
+    node->reply.integer = value;
+    return AttachNode(task, node);
+}
+
+void* CreateNil(const redisReadTask* task) noexcept {
+    auto* node = CreateNode(task);
+    if (!node) return nullptr;
+    return AttachNode(task, node);
+}
+
+#ifdef REDIS_REPLY_MAP
+void* CreateDouble(const redisReadTask* task, double value, char* str, std::size_t len) noexcept {
+    auto* node = CreateNode(task);
+    if (!node) return nullptr;
+    node->reply.dval = value;
+    if (!SetPayload(node, str, len)) {
+        delete node;
+        return nullptr;
+    }
+    return AttachNode(task, node);
+}
+
+void* CreateBool(const redisReadTask* task, int value) noexcept {
+    auto* node = CreateNode(task);
+    if (!node) return nullptr;
+    node->reply.integer = value != 0;
+    return AttachNode(task, node);
+}
+#endif
+
+redisReplyObjectFunctions MakeReplyObjectFunctions() noexcept {
+    redisReplyObjectFunctions functions{};
+    functions.createString = &CreateString;
+    functions.createArray = &CreateArray;
+    functions.createInteger = &CreateInteger;
+    functions.createNil = &CreateNil;
+#ifdef REDIS_REPLY_MAP
+    functions.createDouble = &CreateDouble;
+    functions.createBool = &CreateBool;
+#endif
+    functions.freeObject = &FreeObject;
+    return functions;
+}
+
+std::string TakePayload(redisReply* reply) noexcept {
+    auto payload = std::move(ToNode(reply)->payload);
+    reply->str = nullptr;
+    reply->len = 0;
+    return payload;
+}
+
+}  // namespace
+
+redisReplyObjectFunctions* GetReplyObjectFunctions() noexcept {
+    // hiredis wants a non-const pointer, but never modifies the functions
+    static redisReplyObjectFunctions functions = MakeReplyObjectFunctions();
+    return &functions;
+}
+
+ReplyData TakeReplyData(redisReply* reply) {
+    if (!reply) return ReplyData{nullptr};
+
+    switch (reply->type) {
+        case REDIS_REPLY_STRING:
+#ifdef REDIS_REPLY_MAP
+        case REDIS_REPLY_DOUBLE:
+        case REDIS_REPLY_VERB:
+        case REDIS_REPLY_BIGNUM:
+#endif
+            return ReplyData{TakePayload(reply)};
+        case REDIS_REPLY_ARRAY:
+#ifdef REDIS_REPLY_MAP
+        case REDIS_REPLY_MAP:
+        case REDIS_REPLY_SET:
+        case REDIS_REPLY_PUSH:
+#endif
+        {
+            ReplyData::Array array;
+            array.reserve(reply->elements);
+            for (std::size_t i = 0; i < reply->elements; ++i) array.push_back(TakeReplyData(reply->element[i]));
+            return ReplyData{std::move(array)};
+        }
+        case REDIS_REPLY_INTEGER:
+            return ReplyData::CreateInteger(reply->integer);
+#ifdef REDIS_REPLY_MAP
+        case REDIS_REPLY_BOOL:
+            // As the Lua booleans are returned in RESP2: true is 1, false is nil
+            return reply->integer ? ReplyData::CreateInteger(1) : ReplyData::CreateNil();
+#endif
+        case REDIS_REPLY_NIL:
+            return ReplyData::CreateNil();
+        case REDIS_REPLY_STATUS:
+            return ReplyData::CreateStatus(TakePayload(reply));
+        case REDIS_REPLY_ERROR:
+            return ReplyData::CreateError(TakePayload(reply));
+        default:
+            return ReplyData{nullptr};
+    }
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <hiredis/hiredis.h>
+
+#include <userver/storages/redis/impl/reply.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+/// Reply object functions for the hiredis reader that keep the payload of
+/// each string reply in a std::string owned by the reply.
+///
+/// The replies are plain redisReply objects for hiredis, so the async layer
+/// may inspect them as usual (push, subscribe and error replies). The
+/// functions must be installed before the first reply is read, e.g. right
+/// after redisAsyncConnect().
+redisReplyObjectFunctions* GetReplyObjectFunctions() noexcept;
+
+/// Builds ReplyData from a reply created by GetReplyObjectFunctions(),
+/// moving the payloads instead of copying them. The reply is left without
+/// payload and may only be freed afterwards.
+ReplyData TakeReplyData(redisReply* reply);
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,97 @@
+#include <storages/redis/impl/reply_reader.hpp>
+
+#include <memory>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct ReplyDeleter {
+    void operator()(void* reply) const { redis::GetReplyObjectFunctions()->freeObject(reply); }
+};
+
+using ReplyHolder = std::unique_ptr<redisReply, ReplyDeleter>;
+
+ReplyHolder Read(std::string_view data) {
+    const std::unique_ptr<redisReader, decltype(&redisReaderFree)> reader(
+        redisReaderCreateWithFunctions(redis::GetReplyObjectFunctions()), &redisReaderFree
+    );
+    EXPECT_EQ(redisReaderFeed(reader.get(), data.data(), data.size()), REDIS_OK);
+
+    void* reply = nullptr;
+    EXPECT_EQ(redisReaderGetReply(reader.get(), &reply), REDIS_OK);
+    return ReplyHolder{static_cast<redisReply*>(reply)};
+}
+
+}  // namespace
+
+TEST(RedisReplyReader, Scalars) {
+    EXPECT_EQ(redis::TakeReplyData(Read("$5\r\nvalue\r\n").get()).GetString(), "value");
+    EXPECT_EQ(redis::TakeReplyData(Read("+OK\r\n").get()).GetStatus(), "OK");
+    EXPECT_EQ(redis::TakeReplyData(Read("-ERR failed\r\n").get()).GetError(), "ERR failed");
+    EXPECT_EQ(redis::TakeReplyData(Read(":-42\r\n").get()).GetInt(), -42);
+    EXPECT_TRUE(redis::TakeReplyData(Read("$-1\r\n").get()).IsNil());
+    EXPECT_TRUE(redis::TakeReplyData(Read("*-1\r\n").get()).IsNil());
+}
+
+TEST(RedisReplyReader, NestedArrays) {
+    const auto reply = Read("*3\r\n$1\r\na\r\n*2\r\n:1\r\n$-1\r\n*0\r\n");
+    // The reply is still a regular redisReply for hiredis
+    ASSERT_EQ(reply->type, REDIS_REPLY_ARRAY);
+    ASSERT_EQ(reply->elements, 3);
+    EXPECT_EQ(std::string_view(reply->element[0]->str, reply->element[0]->len), "a");
+
+    auto data = redis::TakeReplyData(reply.get());
+    ASSERT_TRUE(data.IsArray());
+    ASSERT_EQ(data.GetSize(), 3);
+    EXPECT_EQ(data[0].GetString(), "a");
+    ASSERT_TRUE(data[1].IsArray());
+    EXPECT_EQ(data[1][0].GetInt(), 1);
+    EXPECT_TRUE(data[1][1].IsNil());
+    ASSERT_TRUE(data[2].IsArray());
+    EXPECT_EQ(data[2].GetSize(), 0);
+
+    // The payload is moved out
+    EXPECT_EQ(reply->element[0]->str, nullptr);
+}
+
+TEST(RedisReplyReader, LargeString) {
+    const std::string value(1 << 20, 'x');
+    const auto data = redis::TakeReplyData(Read("$" + std::to_string(value.size()) + "\r\n" + value + "\r\n").get());
+    EXPECT_EQ(data.GetString(), value);
+}
+
+#ifdef REDIS_REPLY_MAP
+TEST(RedisReplyReader, Resp3) {
+    const auto data = redis::TakeReplyData(Read("%2\r\n+a\r\n#t\r\n+b\r\n,1.5\r\n").get());
+    // A map is flattened as in RESP2
+    ASSERT_TRUE(data.IsArray());
+    ASSERT_EQ(data.GetSize(), 4);
+    EXPECT_EQ(data[0].GetStatus(), "a");
+    EXPECT_EQ(data[1].GetInt(), 1);
+    EXPECT_EQ(data[2].GetStatus(), "b");
+    EXPECT_EQ(data[3].GetString(), "1.5");
+
+    EXPECT_EQ(redis::TakeReplyData(Read("=7\r\ntxt:abc\r\n").get()).GetString(), "abc");
+    EXPECT_TRUE(redis::TakeReplyData(Read("_\r\n").get()).IsNil());
+}
+
+TEST(RedisReplyReader, Resp3Booleans) {
+    // As the Lua booleans are returned in RESP2
+    const auto true_data = redis::TakeReplyData(Read("#t\r\n").get());
+    ASSERT_TRUE(true_data.IsInt());
+    EXPECT_EQ(true_data.GetInt(), 1);
+    EXPECT_TRUE(redis::TakeReplyData(Read("#f\r\n").get()).IsNil());
+
+    const auto array = redis::TakeReplyData(Read("*2\r\n#f\r\n#t\r\n").get());
+    ASSERT_TRUE(array.IsArray());
+    ASSERT_EQ(array.GetSize(), 2);
+    EXPECT_TRUE(array[0].IsNil());
+    EXPECT_EQ(array[1].GetInt(), 1);
+}
+#endif
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include <userver/storages/redis/impl/reply.hpp>
 
 #include <gtest/gtest.h>
+#include <hiredis/hiredis.h>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -22,4 +23,35 @@ TEST(Reply, IsUnusableInstanceErrorERR) {
     EXPECT_FALSE(data.IsUnusableInstanceError());
 }
 
+TEST(Reply, KeyValuesFromResp3Pairs) {
+    using Array = redis::ReplyData::Array;
+    // ZRANGE WITHSCORES in RESP3
+    redis::ReplyData data{Array{
+        redis::ReplyData{Array{redis::ReplyData{"a"}, redis::ReplyData{"1.5"}}},
+        redis::ReplyData{Array{redis::ReplyData{"b"}, redis::ReplyData{"2"}}},
+    }};
+
+    std::vector<std::pair<std::string, std::string>> result;
+    for (auto elem : data.GetMovableKeyValues()) {
+        result.emplace_back(std::move(elem.Key()), std::move(elem.Value()));
+    }
+    const std::vector<std::pair<std::string, std::string>> expected{{"a", "1.5"}, {"b", "2"}};
+    EXPECT_EQ(result, expected);
+}
+
+#ifdef REDIS_REPLY_BOOL
+TEST(Reply, Resp3BooleanAsLuaInResp2) {
+    redisReply reply{};
+    reply.type = REDIS_REPLY_BOOL;
+
+    reply.integer = 1;
+    const redis::ReplyData true_data{&reply};
+    ASSERT_TRUE(true_data.IsInt());
+    EXPECT_EQ(true_data.GetInt(), 1);
+
+    reply.integer = 0;
+    EXPECT_TRUE(redis::ReplyData{&reply}.IsNil());
+}
+#endif
+
 USERVER_NAMESPACE_END
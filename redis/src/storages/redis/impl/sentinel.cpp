@@ -71,11 +71,13 @@ Sentinel::Sentinel(
     std::unique_ptr<KeyShard>&& key_shard,
     CommandControl command_control,
     const testsuite::RedisControl& testsuite_redis_control,
-    ConnectionMode mode
+    ConnectionMode mode,
+    std::shared_ptr<ClientSideCache> client_side_cache
 )
     : thread_pools_(thread_pools),
       secdist_default_command_control_(command_control),
-      testsuite_redis_control_(testsuite_redis_control) {
+      testsuite_redis_control_(testsuite_redis_control),
+      client_side_cache_(std::move(client_side_cache)) {
     config_default_command_control_.Set(std::make_shared<CommandControl>(secdist_default_command_control_));
 
     if (!thread_pools_) {
@@ -99,7 +101,8 @@ Sentinel::Sentinel(
                 std::move(ready_callback),
                 std::move(key_shard),
                 dynamic_config_source,
-                mode
+                mode,
+                client_side_cache_
             );
         } else {
             impl_ = std::make_unique<SentinelImpl>(
@@ -115,7 +118,8 @@ Sentinel::Sentinel(
                 std::move(ready_callback),
                 std::move(key_shard),
                 dynamic_config_source,
-                mode
+                mode,
+                client_side_cache_
             );
         }
     });
@@ -146,7 +150,8 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
     const std::string& client_name,
     KeyShardFactory key_shard_factory,
     const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control
+    const testsuite::RedisControl& testsuite_redis_control,
+    std::shared_ptr<ClientSideCache> client_side_cache
 ) {
     auto ready_callback = [](size_t shard, const std::string& shard_name, bool ready) {
         LOG_INFO() << "redis: ready_callback:"
@@ -162,7 +167,8 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
         std::move(ready_callback),
         std::move(key_shard_factory),
         command_control,
-        testsuite_redis_control
+        testsuite_redis_control,
+        std::move(client_side_cache)
     );
 }
 
@@ -175,7 +181,8 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
     Sentinel::ReadyChangeCallback ready_callback,
     KeyShardFactory key_shard_factory,
     const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control
+    const testsuite::RedisControl& testsuite_redis_control,
+    std::shared_ptr<ClientSideCache> client_side_cache
 ) {
     const auto& password = settings.password;
 
@@ -212,7 +219,9 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
             dynamic_config_source,
             std::move(key_shard),
             command_control,
-            testsuite_redis_control
+            testsuite_redis_control,
+            ConnectionMode::kCommands,
+            std::move(client_side_cache)
         );
         client->Start();
     }
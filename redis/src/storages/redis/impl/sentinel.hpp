@@ -40,6 +40,7 @@ const auto kProcessWaitingCommandsInterval = std::chrono::seconds(3);
 const auto kCheckRedisConnectedInterval = std::chrono::seconds(3);
 
 // Forward declarations
+class ClientSideCache;
 class SentinelImplBase;
 class SentinelImpl;
 class Shard;
@@ -73,7 +74,8 @@ public:
         std::unique_ptr<KeyShard>&& key_shard = nullptr,
         CommandControl command_control = {},
         const testsuite::RedisControl& testsuite_redis_control = {},
-        ConnectionMode mode = ConnectionMode::kCommands
+        ConnectionMode mode = ConnectionMode::kCommands,
+        std::shared_ptr<ClientSideCache> client_side_cache = {}
     );
     virtual ~Sentinel();
 
@@ -103,7 +105,8 @@ public:
         const std::string& client_name,
         KeyShardFactory key_shard_factory,
         const CommandControl& command_control = {},
-        const testsuite::RedisControl& testsuite_redis_control = {}
+        const testsuite::RedisControl& testsuite_redis_control = {},
+        std::shared_ptr<ClientSideCache> client_side_cache = {}
     );
     static std::shared_ptr<redis::Sentinel> CreateSentinel(
         const std::shared_ptr<ThreadPools>& thread_pools,
@@ -114,7 +117,8 @@ public:
         ReadyChangeCallback ready_callback,
         KeyShardFactory key_shard_factory,
         const CommandControl& command_control = {},
-        const testsuite::RedisControl& testsuite_redis_control = {}
+        const testsuite::RedisControl& testsuite_redis_control = {},
+        std::shared_ptr<ClientSideCache> client_side_cache = {}
     );
 
     void Restart();
@@ -141,6 +145,9 @@ public:
 
     SentinelStatistics GetStatistics(const MetricsSettings& settings) const;
 
+    /// nullptr if client side caching is not configured
+    const std::shared_ptr<ClientSideCache>& GetClientSideCache() const { return client_side_cache_; }
+
     void SetCommandsBufferingSettings(CommandsBufferingSettings commands_buffering_settings);
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings);
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings);
@@ -234,6 +241,7 @@ private:
     utils::SwappingSmart<CommandControl> config_default_command_control_;
     std::atomic_int publish_shard_{0};
     testsuite::RedisControl testsuite_redis_control_;
+    std::shared_ptr<ClientSideCache> client_side_cache_;
 };
 
 }  // namespace redis
@@ -4,7 +4,6 @@
 #include <sstream>
 #include <thread>
 
-#include <boost/crc.hpp>
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
@@ -67,7 +66,8 @@ SentinelImpl::SentinelImpl(
     ReadyChangeCallback ready_callback,
     std::unique_ptr<KeyShard>&& key_shard,
     dynamic_config::Source dynamic_config_source,
-    ConnectionMode mode
+    ConnectionMode mode,
+    std::shared_ptr<ClientSideCache> client_side_cache
 )
     : sentinel_obj_(sentinel),
       ev_thread_(sentinel_thread_control),
@@ -82,6 +82,7 @@ SentinelImpl::SentinelImpl(
       cluster_mode_failed_(false),
       key_shard_(std::move(key_shard)),
       connection_mode_(mode),
+      client_side_cache_(std::move(client_side_cache)),
       slot_info_(IsInClusterMode() ? std::make_unique<SlotInfo>() : nullptr),
       dynamic_config_source_(dynamic_config_source) {
     for (size_t i = 0; i < init_shards_->size(); ++i) {
@@ -190,6 +191,7 @@ void SentinelImpl::InitShards(
         shard_options.ready_change_callback = [i, shard, ready_callback](bool ready) {
             if (ready_callback) ready_callback(i, shard, ready);
         };
+        shard_options.client_side_cache = client_side_cache_;
         auto object = std::make_shared<Shard>(std::move(shard_options));
         object->SignalInstanceStateChange().connect([this](ServerId, Redis::State state) {
             if (state != Redis::State::kInit) ev_thread_.Send(watch_state_);
@@ -363,7 +365,7 @@ void SentinelImpl::AsyncCommandToSentinel(CommandPtr command) {
 size_t SentinelImpl::ShardByKey(const std::string& key) const {
     UASSERT(!master_shards_.empty());
     auto key_shard = key_shard_.Get();
-    size_t shard = key_shard ? key_shard->ShardByKey(key) : slot_info_->ShardBySlot(HashSlot(key));
+    size_t shard = key_shard ? key_shard->ShardByKey(key) : slot_info_->ShardBySlot(GetClusterHashSlot(key));
     LOG_TRACE() << "key=" << key << " shard=" << shard;
     return shard;
 }
@@ -893,13 +895,6 @@ size_t SentinelImpl::ParseMovedShard(const std::string& err_string) {
     return shard_info_.GetShard(host, port);
 }
 
-size_t SentinelImpl::HashSlot(const std::string& key) {
-    size_t start = 0;
-    size_t len = 0;
-    GetRedisKey(key, &start, &len);
-    return std::for_each(key.data() + start, key.data() + start + len, boost::crc_optimal<16, 0x1021>())() & 0x3fff;
-}
-
 SentinelImpl::SlotInfo::SlotInfo() {
     for (size_t i = 0; i < kClusterHashSlots; ++i) {
         slot_to_shard_[i] = kUnknownShard;
@@ -106,7 +106,8 @@ public:
         ReadyChangeCallback ready_callback,
         std::unique_ptr<KeyShard>&& key_shard,
         dynamic_config::Source dynamic_config_source,
-        ConnectionMode mode = ConnectionMode::kCommands
+        ConnectionMode mode = ConnectionMode::kCommands,
+        std::shared_ptr<ClientSideCache> client_side_cache = {}
     );
     ~SentinelImpl() override;
 
@@ -228,8 +229,6 @@ private:
         const ReadyChangeCallback& ready_callback
     );
 
-    static size_t HashSlot(const std::string& key);
-
     void ProcessWaitingCommands();
 
     Sentinel& sentinel_obj_;
@@ -265,6 +264,7 @@ private:
     std::atomic<size_t> current_slots_shard_ = 0;
     utils::SwappingSmart<KeyShard> key_shard_;
     ConnectionMode connection_mode_;
+    const std::shared_ptr<ClientSideCache> client_side_cache_;
     std::unique_ptr<SlotInfo> slot_info_;
     SentinelStatisticsInternal statistics_internal_;
     utils::SwappingSmart<KeysForShards> keys_for_shards_;
@@ -53,7 +53,8 @@ Shard::Shard(Options options)
     : shard_name_(std::move(options.shard_name)),
       shard_group_name_(std::move(options.shard_group_name)),
       ready_change_callback_(std::move(options.ready_change_callback)),
-      cluster_mode_(options.cluster_mode) {
+      cluster_mode_(options.cluster_mode),
+      client_side_cache_(std::move(options.client_side_cache)) {
     for (const auto& conn : options.connection_infos) {
         connection_infos_.emplace_back(conn);
     }
@@ -263,7 +264,9 @@ bool Shard::ProcessCreation(const std::shared_ptr<engine::ev::ThreadPool>& redis
     // https://github.com/boostorg/signals2/issues/59
     // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
     for (const auto& id : need_to_create) {
-        const auto redis_settings = RedisCreationSettings{id.GetConnectionSecurity(), cluster_mode_ && id.IsReadOnly()};
+        auto redis_settings =
+            RedisCreationSettings{id.GetConnectionSecurity(), cluster_mode_ && id.IsReadOnly(), client_side_cache_};
+        redis_settings.cluster_mode = cluster_mode_;
         ConnectionStatus entry{
             id,
             std::make_shared<Redis>(
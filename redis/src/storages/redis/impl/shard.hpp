@@ -65,6 +65,7 @@ public:
         bool cluster_mode{false};
         std::function<void(bool ready)> ready_change_callback;
         std::vector<ConnectionInfo> connection_infos;
+        std::shared_ptr<ClientSideCache> client_side_cache;
     };
 
     explicit Shard(Options options);
@@ -131,6 +132,7 @@ private:
 
     bool prev_connected_ = false;
     const bool cluster_mode_ = false;
+    const std::shared_ptr<ClientSideCache> client_side_cache_;
 };
 
 }  // namespace redis
@@ -165,13 +165,13 @@ ParseReplyDataArray(ReplyData&& array_data, [[maybe_unused]] const std::string&
         if (elem.IsString()) {
             geo_point.member = std::move(elem.GetString());
         } else if (elem.IsArray()) {
-            auto additional_infos = elem.GetArray();
+            auto& additional_infos = elem.GetArray();
             if (additional_infos.empty()) {
                 throw USERVER_NAMESPACE::redis::ParseReplyException(
                     "Can't parse value from reply to '" + request_description + ", additional_info item is empty array"
                 );
             }
-            geo_point.member = additional_infos[0].GetString();
+            geo_point.member = std::move(additional_infos[0].GetString());
 
             for (size_t i = 1; i < additional_infos.size(); ++i) {
                 const auto& sub_elem = additional_infos[i];
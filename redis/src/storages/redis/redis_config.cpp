@@ -79,6 +79,7 @@ Parse(const formats::json::Value& elem, formats::parse::To<USERVER_NAMESPACE::re
     result.commands_buffering_threshold = elem["commands_buffering_threshold"].As<size_t>(0);
     result.watch_command_timer_interval =
         std::chrono::microseconds(elem["watch_command_timer_interval_us"].As<size_t>());
+    result.max_merged_gets = elem["max_merged_gets"].As<size_t>(0);
     return result;
 }
 
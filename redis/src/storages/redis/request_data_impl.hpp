@@ -1,8 +1,12 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
+#include <vector>
 
+#include <userver/storages/redis/exception.hpp>
 #include <userver/storages/redis/impl/base.hpp>
 #include <userver/storages/redis/impl/request.hpp>
 #include <userver/utils/assert.hpp>
@@ -11,6 +15,8 @@
 #include <userver/storages/redis/parse_reply.hpp>
 #include <userver/storages/redis/request_data_base.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
+
 #include "client_impl.hpp"
 #include "scan_reply.hpp"
 
@@ -82,6 +88,48 @@ public:
     }
 };
 
+/// Stores the string or nil reply of GET or HGET in the client side cache
+template <typename Result, typename ReplyType>
+class CachingRequestDataImpl final : public RequestDataImplBase, public RequestDataBase<ReplyType> {
+public:
+    CachingRequestDataImpl(
+        USERVER_NAMESPACE::redis::Request&& request,
+        USERVER_NAMESPACE::redis::ClientSideCache::FillToken&& fill_token
+    )
+        : RequestDataImplBase(std::move(request)), fill_token_(std::move(fill_token)) {}
+
+    void Wait() override { impl::Wait(GetRequest()); }
+
+    ReplyType Get(const std::string& request_description) override {
+        auto reply = GetReply();
+        Fill(reply);
+        return ParseReply<Result, ReplyType>(std::move(reply), request_description);
+    }
+
+    ReplyPtr GetRaw() override {
+        auto reply = GetReply();
+        Fill(reply);
+        return reply;
+    }
+
+    engine::impl::ContextAccessor* TryGetContextAccessor() noexcept override {
+        return GetRequest().TryGetContextAccessor();
+    }
+
+private:
+    void Fill(const ReplyPtr& reply) {
+        if (!fill_token_ || !reply || !reply->IsOk()) return;
+        if (reply->data.IsString()) {
+            std::move(*fill_token_).Store(reply->data.GetString());
+        } else if (reply->data.IsNil()) {
+            std::move(*fill_token_).Store(std::nullopt);
+        }
+        fill_token_.reset();
+    }
+
+    std::optional<USERVER_NAMESPACE::redis::ClientSideCache::FillToken> fill_token_;
+};
+
 template <typename Result, typename ReplyType>
 class AggregateRequestDataImpl final : public RequestDataBase<ReplyType> {
     using RequestDataPtr = std::unique_ptr<RequestDataBase<ReplyType>>;
@@ -118,6 +166,67 @@ private:
     std::vector<RequestDataPtr> requests_;
 };
 
+/// Sub-requests of a multi-key command split by the hash slots of a redis
+/// cluster. The sub-requests are in flight concurrently, the replies are
+/// merged back in the order of the keys of the original command.
+template <typename Result, typename ReplyType>
+class SplitRequestDataImpl final : public RequestDataBase<ReplyType> {
+    using RequestDataPtr = std::unique_ptr<RequestDataBase<ReplyType>>;
+
+public:
+    // positions[i] are the indices of the keys of requests[i] in the original command
+    SplitRequestDataImpl(std::vector<RequestDataPtr>&& requests, std::vector<std::vector<size_t>>&& positions)
+        : requests_(std::move(requests)), positions_(std::move(positions)) {
+        UASSERT(requests_.size() == positions_.size());
+    }
+
+    void Wait() override {
+        for (auto& request : requests_) {
+            request->Wait();
+        }
+    }
+
+    ReplyType Get(const std::string& request_description) override {
+        if constexpr (std::is_void_v<ReplyType>) {
+            for (auto& request : requests_) request->Get(request_description);
+        } else if constexpr (std::is_arithmetic_v<ReplyType>) {
+            ReplyType result{};
+            for (auto& request : requests_) result += request->Get(request_description);
+            return result;
+        } else {
+            size_t size = 0;
+            for (const auto& positions : positions_) size += positions.size();
+
+            ReplyType result(size);
+            for (size_t i = 0; i < requests_.size(); ++i) {
+                auto data = requests_[i]->Get(request_description);
+                if (data.size() != positions_[i].size()) {
+                    throw USERVER_NAMESPACE::redis::ParseReplyException(
+                        "Unexpected reply to '" + request_description + "': expected " +
+                        std::to_string(positions_[i].size()) + " elements, got " + std::to_string(data.size())
+                    );
+                }
+                for (size_t j = 0; j < data.size(); ++j) result[positions_[i][j]] = std::move(data[j]);
+            }
+            return result;
+        }
+    }
+
+    ReplyPtr GetRaw() override {
+        UASSERT_MSG(false, "Unsupported");
+        return {};
+    }
+
+    engine::impl::ContextAccessor* TryGetContextAccessor() noexcept override {
+        UASSERT_MSG(false, "Not implemented");
+        return nullptr;
+    }
+
+private:
+    std::vector<RequestDataPtr> requests_;
+    std::vector<std::vector<size_t>> positions_;
+};
+
 template <typename Result, typename ReplyType>
 class DummyRequestDataImpl final : public RequestDataBase<ReplyType> {
 public:
@@ -17,6 +17,17 @@ CreateRequest(USERVER_NAMESPACE::redis::Request&& request, Request<Result, Reply
     return Request<Result, ReplyType>(std::make_unique<RequestDataImpl<Result, ReplyType>>(std::move(request)));
 }
 
+template <typename Result, typename ReplyType = Result>
+Request<Result, ReplyType> CreateCachingRequest(
+    USERVER_NAMESPACE::redis::Request&& request,
+    USERVER_NAMESPACE::redis::ClientSideCache::FillToken&& fill_token,
+    Request<Result, ReplyType>* /* for ADL */
+) {
+    return Request<Result, ReplyType>(
+        std::make_unique<CachingRequestDataImpl<Result, ReplyType>>(std::move(request), std::move(fill_token))
+    );
+}
+
 template <typename Result, typename ReplyType = Result>
 Request<Result, ReplyType> CreateAggregateRequest(
     std::vector<USERVER_NAMESPACE::redis::Request>&& requests,
@@ -31,6 +42,22 @@ Request<Result, ReplyType> CreateAggregateRequest(
     );
 }
 
+template <typename Result, typename ReplyType = Result>
+Request<Result, ReplyType> CreateSplitRequest(
+    std::vector<USERVER_NAMESPACE::redis::Request>&& requests,
+    std::vector<std::vector<size_t>>&& positions,
+    Request<Result, ReplyType>* /* for ADL */
+) {
+    std::vector<std::unique_ptr<RequestDataBase<ReplyType>>> req_data;
+    req_data.reserve(requests.size());
+    for (auto& request : requests) {
+        req_data.push_back(std::make_unique<RequestDataImpl<Result, ReplyType>>(std::move(request)));
+    }
+    return Request<Result, ReplyType>(
+        std::make_unique<SplitRequestDataImpl<Result, ReplyType>>(std::move(req_data), std::move(positions))
+    );
+}
+
 template <typename Result, typename ReplyType = Result>
 Request<Result, ReplyType> CreateDummyRequest(ReplyPtr&& reply, Request<Result, ReplyType>* /* for ADL */) {
     return Request<Result, ReplyType>(std::make_unique<DummyRequestDataImpl<Result, ReplyType>>(std::move(reply)));
@@ -44,12 +71,30 @@ Request CreateRequest(USERVER_NAMESPACE::redis::Request&& request) {
     return impl::CreateRequest(std::move(request), tmp);
 }
 
+template <typename Request>
+Request CreateCachingRequest(
+    USERVER_NAMESPACE::redis::Request&& request,
+    USERVER_NAMESPACE::redis::ClientSideCache::FillToken&& fill_token
+) {
+    Request* tmp = nullptr;
+    return impl::CreateCachingRequest(std::move(request), std::move(fill_token), tmp);
+}
+
 template <typename Request>
 Request CreateAggregateRequest(std::vector<USERVER_NAMESPACE::redis::Request>&& requests) {
     Request* tmp = nullptr;
     return impl::CreateAggregateRequest(std::move(requests), tmp);
 }
 
+template <typename Request>
+Request CreateSplitRequest(
+    std::vector<USERVER_NAMESPACE::redis::Request>&& requests,
+    std::vector<std::vector<size_t>>&& positions
+) {
+    Request* tmp = nullptr;
+    return impl::CreateSplitRequest(std::move(requests), std::move(positions), tmp);
+}
+
 template <typename Request>
 Request CreateDummyRequest(ReplyPtr reply) {
     Request* tmp = nullptr;
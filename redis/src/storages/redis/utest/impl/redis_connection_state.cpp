@@ -8,6 +8,7 @@
 #include <userver/storages/redis/impl/secdist_redis.hpp>
 #include <userver/utils/text.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/keyshard_impl.hpp>
 #include <storages/redis/redis_secdist.hpp>
 
@@ -146,6 +147,34 @@ RedisConnectionState::RedisConnectionState() {
     subscribe_client_ = std::make_shared<SubscribeClientImpl>(subscribe_sentinel_);
 }
 
+RedisConnectionState::RedisConnectionState(WithClientSideCache) {
+    thread_pools_ = std::make_shared<ThreadPools>(
+        USERVER_NAMESPACE::redis::kDefaultSentinelThreadPoolSize, USERVER_NAMESPACE::redis::kDefaultRedisThreadPoolSize
+    );
+
+    USERVER_NAMESPACE::redis::ClientSideCacheSettings cache_settings;
+    cache_settings.enabled = true;
+    sentinel_ = Sentinel::CreateSentinel(
+        thread_pools_,
+        GetRedisSettings(),
+        "none",
+        dynamic_config::GetDefaultSource(),
+        "pub",
+        KeyShardFactory{""},
+        {},
+        {},
+        std::make_shared<USERVER_NAMESPACE::redis::ClientSideCache>(std::move(cache_settings))
+    );
+    sentinel_->WaitConnectedDebug();
+    client_ = std::make_shared<ClientImpl>(sentinel_);
+
+    subscribe_sentinel_ = SubscribeSentinel::Create(
+        thread_pools_, GetRedisSettings(), "none", dynamic_config::GetDefaultSource(), "pub", false, {}, {}
+    );
+    subscribe_sentinel_->WaitConnectedDebug();
+    subscribe_client_ = std::make_shared<SubscribeClientImpl>(subscribe_sentinel_);
+}
+
 RedisConnectionState::RedisConnectionState(InClusterMode) {
     auto configs_source = GetClusterDynamicConfigSource();
 
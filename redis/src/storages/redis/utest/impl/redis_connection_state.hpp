@@ -23,6 +23,9 @@ protected:
     class InClusterMode {};
     explicit RedisConnectionState(InClusterMode);
 
+    class WithClientSideCache {};
+    explicit RedisConnectionState(WithClientSideCache);
+
     std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> GetSentinel() const { return sentinel_; }
 
 private:
@@ -37,6 +40,10 @@ struct RedisClusterConnectionState : public RedisConnectionState {
     RedisClusterConnectionState() : RedisConnectionState(InClusterMode{}) {}
 };
 
+struct RedisClientSideCacheConnectionState : public RedisConnectionState {
+    RedisClientSideCacheConnectionState() : RedisConnectionState(WithClientSideCache{}) {}
+};
+
 }  // namespace storages::redis::utest::impl
 
 USERVER_NAMESPACE_END
@@ -62,4 +62,7 @@ using BaseRedisClientTest = BaseRedisClientTestEx<storages::redis::utest::impl::
 
 using BaseRedisClusterClientTest = BaseRedisClientTestEx<storages::redis::utest::impl::RedisClusterConnectionState>;
 
+using BaseRedisClientSideCacheTest =
+    BaseRedisClientTestEx<storages::redis::utest::impl::RedisClientSideCacheConnectionState>;
+
 USERVER_NAMESPACE_END
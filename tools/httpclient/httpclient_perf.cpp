@@ -27,6 +27,8 @@ struct Config {
     size_t io_threads = 1;
     long timeout_ms = 1000;
     bool multiplexing = false;
+    bool destination_affinity = false;
+    bool ssl_session_sharing = false;
     size_t max_host_connections = 0;
     USERVER_NAMESPACE::http::HttpVersion http_version = USERVER_NAMESPACE::http::HttpVersion::k11;
     std::string url_file;
@@ -40,6 +42,9 @@ struct WorkerContext {
     http::Client& http_client;
     const Config& config;
     const std::vector<std::string>& urls;
+
+    std::atomic<uint64_t> sockets_opened{0};
+    std::atomic<uint64_t> connections_reused{0};
 };
 
 Config ParseConfig(int argc, char* argv[]) {
@@ -61,6 +66,8 @@ Config ParseConfig(int argc, char* argv[]) {
         "io-threads", po::value(&config.io_threads)->default_value(config.io_threads), "io thread count"
     )("timeout,t", po::value(&config.timeout_ms)->default_value(config.timeout_ms), "request timeout in ms")(
         "multiplexing", "enable HTTP/2 multiplexing"
+    )("destination-affinity", "perform the requests to the same destination on the same io thread")(
+        "ssl-session-sharing", "share the TLS session cache between the io threads"
     )("http-version,V", po::value<std::string>(), "http version, possible values: 1.0, 1.1, 2.0-prior"
     )("max-host-connections",
       po::value(&config.max_host_connections)->default_value(config.max_host_connections),
@@ -76,6 +83,8 @@ Config ParseConfig(int argc, char* argv[]) {
     }
 
     if (vm.count("multiplexing")) config.multiplexing = true;
+    if (vm.count("destination-affinity")) config.destination_affinity = true;
+    if (vm.count("ssl-session-sharing")) config.ssl_session_sharing = true;
     if (vm.count("http-version")) {
         auto value = vm["http-version"].as<std::string>();
         if (value == "1.0")
@@ -146,6 +155,9 @@ void Worker(WorkerContext& context) {
 
             auto response = request.perform();
             context.response_len += response->body().size();
+            const auto sockets = response->GetStats().open_socket_count;
+            context.sockets_opened += sockets;
+            if (sockets == 0) ++context.connections_reused;
             LOG_DEBUG() << "Got response body_size=" << response->body().size();
             auto ts3 = std::chrono::system_clock::now();
             LOG_INFO() << "timings create=" << std::chrono::duration_cast<std::chrono::microseconds>(ts2 - ts1).count()
@@ -165,7 +177,10 @@ void DoWork(const Config& config, const std::vector<std::string>& urls) {
     LOG_INFO() << "Starting thread " << std::this_thread::get_id();
 
     auto& tp = engine::current_task::GetTaskProcessor();
-    http::Client http_client{{"", config.io_threads}, tp, std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+    http::ClientSettings settings{"", config.io_threads};
+    settings.destination_affinity_enabled = config.destination_affinity;
+    settings.ssl_session_sharing_enabled = config.ssl_session_sharing;
+    http::Client http_client{std::move(settings), tp, std::vector<utils::NotNull<clients::http::Plugin*>>{}};
     LOG_INFO() << "Client created";
 
     http_client.SetMultiplexingEnabled(config.multiplexing);
@@ -189,7 +204,9 @@ void DoWork(const Config& config, const std::vector<std::string>& urls) {
 
     std::cerr << std::endl;
     LOG_CRITICAL() << "counter = " << worker_context.counter.load()
-                   << " sum response body size = " << worker_context.response_len << " average RPS = " << rps;
+                   << " sum response body size = " << worker_context.response_len << " average RPS = " << rps
+                   << " sockets opened = " << worker_context.sockets_opened.load()
+                   << " connections reused = " << worker_context.connections_reused.load();
 }
 
 }  // namespace
@@ -209,7 +226,9 @@ int main(int argc, char* argv[]) {
     LOG_WARNING() << "Starting using requests=" << config.count << " coroutines=" << config.coroutines
                   << " timeout=" << config.timeout_ms << "ms";
     LOG_WARNING() << "multiplexing =" << (config.multiplexing ? "enabled" : "disabled")
-                  << " max_host_connections=" << config.max_host_connections;
+                  << " max_host_connections=" << config.max_host_connections
+                  << " destination_affinity=" << (config.destination_affinity ? "enabled" : "disabled")
+                  << " ssl_session_sharing=" << (config.ssl_session_sharing ? "enabled" : "disabled");
 
     const std::vector<std::string> urls = ReadUrls(config);
 
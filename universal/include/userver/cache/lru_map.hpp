@@ -58,6 +58,11 @@ public:
     /// @warning Returned pointer may be freed on the next map access!
     U* GetLeastUsed() { return impl_.GetLeastUsedValue(); }
 
+    /// Returns pointer to the least recently used key;
+    /// returns nullptr if LRU is empty.
+    /// @warning Returned pointer may be freed on the next map access!
+    const T* GetLeastUsedKey() const { return impl_.GetLeastUsedKey(); }
+
     /// Sets the max size of the LRU, truncates values if new_max_size < GetSize()
     void SetMaxSize(size_t new_max_size) { return impl_.SetMaxSize(new_max_size); }
 
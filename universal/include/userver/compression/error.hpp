@@ -24,6 +24,11 @@ public:
     explicit ErrWithCode(const char* errName) : DecompressionError(fmt::format("Decompression failed: {}", errName)) {}
 };
 
+/// Base class for compression errors
+class CompressionError : public std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
 }  // namespace compression
 
 USERVER_NAMESPACE_END
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <string>
 #include <string_view>
 
 #include <userver/compression/error.hpp>
+#include <userver/utils/fast_pimpl.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -12,6 +14,36 @@ namespace compression::zstd {
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Default compression level of the zstd library
+inline constexpr int kDefaultCompressionLevel = 3;
+
+/// Compresses the string into a single zstd frame.
+/// @throws CompressionError
+std::string Compress(std::string_view data, int level = kDefaultCompressionLevel);
+
+/// @brief Compresses a stream of chunks into a single zstd frame.
+///
+/// Output of each Compress() call is flushed, so that the peer is able to
+/// decompress the data received so far.
+class StreamCompressor final {
+public:
+    explicit StreamCompressor(int level = kDefaultCompressionLevel);
+    StreamCompressor(StreamCompressor&&) noexcept;
+    StreamCompressor& operator=(StreamCompressor&&) noexcept;
+    ~StreamCompressor();
+
+    /// @throws CompressionError
+    std::string Compress(std::string_view chunk);
+
+    /// Ends the frame, the compressor must not be used afterwards.
+    /// @throws CompressionError
+    std::string Finish();
+
+private:
+    struct Impl;
+    utils::FastPimpl<Impl, 8, 8> impl_;
+};
+
 }  // namespace compression::zstd
 
 USERVER_NAMESPACE_END
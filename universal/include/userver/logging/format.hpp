@@ -10,7 +10,13 @@ USERVER_NAMESPACE_BEGIN
 namespace logging {
 
 /// Log formats
-enum class Format { kTskv, kLtsv, kRaw };
+enum class Format {
+    kTskv,
+    kLtsv,
+    kRaw,
+    /// JSON lines: an object with string values per record
+    kJson,
+};
 
 /// Parse Format enum from string
 Format FormatFromString(std::string_view format_str);
@@ -10,6 +10,7 @@ USERVER_NAMESPACE_BEGIN
 namespace logging::impl {
 
 class TagWriter;
+struct StructuredRecord;
 
 /// Base logger class
 class LoggerBase {
@@ -28,12 +29,18 @@ public:
 
     virtual void Trace(Level level, std::string_view msg);
 
+    /// Receives the records from LogHelper if IsStructured(). Formats the
+    /// record and calls Log or Trace by default.
+    virtual void LogStructured(StructuredRecord&& record);
+
     virtual void Flush();
 
     virtual void PrependCommonTags(TagWriter writer) const;
 
     Format GetFormat() const noexcept;
 
+    bool IsStructured() const noexcept;
+
     virtual void SetLevel(Level level);
     Level GetLevel() const noexcept;
     bool ShouldLog(Level level) const noexcept;
@@ -46,10 +53,13 @@ public:
 protected:
     virtual bool DoShouldLog(Level level) const noexcept;
 
+    void SetStructured(bool structured) noexcept;
+
 private:
     const Format format_;
     std::atomic<Level> level_{Level::kNone};
     std::atomic<Level> flush_level_{Level::kWarning};
+    std::atomic<bool> is_structured_{false};
 };
 
 bool ShouldLogNoSpan(const LoggerBase& logger, Level level) noexcept;
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include <userver/logging/format.hpp>
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// @brief A log record with unformatted keys and values.
+///
+/// LogHelper builds such records instead of the text for the loggers with
+/// LoggerBase::IsStructured(), so that the timestamp formatting and escaping
+/// are done by the logger, e.g. on its consumer task.
+struct StructuredRecord final {
+    using EntrySize = std::uint32_t;
+
+    Level level{Level::kNone};
+    bool is_trace{false};
+    std::chrono::system_clock::time_point time{};
+    /// The entries in the order of the text formats. An entry is
+    /// `[key size][key][value size][value]`, the sizes are native-endian
+    /// EntrySize, nothing is escaped.
+    std::string entries;
+};
+
+/// Calls `func(key, value)` for every entry of the record
+template <typename Func>
+void ForEachEntry(const StructuredRecord& record, Func&& func) {
+    std::string_view data = record.entries;
+    const auto read = [&data] {
+        StructuredRecord::EntrySize size{};
+        std::memcpy(&size, data.data(), sizeof(size));
+        const auto result = data.substr(sizeof(size), size);
+        data.remove_prefix(sizeof(size) + size);
+        return result;
+    };
+    while (!data.empty()) {
+        const auto key = read();
+        const auto value = read();
+        func(key, value);
+    }
+}
+
+/// Formats the record exactly as LogHelper does for the text loggers,
+/// including the trailing newline
+std::string ToText(const StructuredRecord& record, Format format);
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
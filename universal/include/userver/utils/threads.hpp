@@ -4,6 +4,9 @@
 /// @brief Functions to work with OS threads.
 /// @ingroup userver_universal
 
+#include <cstddef>
+#include <vector>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils {
@@ -19,6 +22,17 @@ void SetCurrentThreadIdleScheduling();
 /// @throws std::system_error
 void SetCurrentThreadLowPriorityScheduling();
 
+/// @brief Pin the OS thread to the specified CPUs
+/// @note Does nothing on platforms other than Linux
+/// @throws std::system_error
+void SetCurrentThreadCpuAffinity(const std::vector<std::size_t>& cpus);
+
+/// @brief Prefer the specified NUMA node for the memory allocated by the OS
+/// thread. If the node runs out of free memory, other nodes are used.
+/// @note Does nothing on platforms other than Linux
+/// @throws std::system_error
+void SetCurrentThreadPreferredNumaNode(std::size_t numa_node);
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -80,5 +80,78 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
     return decompressed;
 }
 
+namespace {
+
+struct CStreamDeleter {
+    void operator()(ZSTD_CStream* stream) const noexcept { ZSTD_freeCStream(stream); }
+};
+
+using CStreamPtr = std::unique_ptr<ZSTD_CStream, CStreamDeleter>;
+
+void CheckCompressionResult(size_t ret) {
+    if (ZSTD_isError(ret)) {
+        throw CompressionError(fmt::format("Compression failed: {}", ZSTD_getErrorName(ret)));
+    }
+}
+
+// Feeds `input` to the stream with the given directive, appends the output
+void CompressStreamTo(ZSTD_CStream* stream, std::string_view input, ZSTD_EndDirective directive, std::string& output) {
+    ZSTD_inBuffer in_buffer{input.data(), input.size(), 0};
+    while (true) {
+        const auto old_size = output.size();
+        output.resize(old_size + ZSTD_CStreamOutSize());
+        ZSTD_outBuffer out_buffer{output.data() + old_size, output.size() - old_size, 0};
+
+        const auto remaining = ZSTD_compressStream2(stream, &out_buffer, &in_buffer, directive);
+        CheckCompressionResult(remaining);
+        output.resize(old_size + out_buffer.pos);
+
+        if (remaining == 0 && in_buffer.pos == in_buffer.size) {
+            return;
+        }
+    }
+}
+
+}  // namespace
+
+std::string Compress(std::string_view data, int level) {
+    std::string compressed(ZSTD_compressBound(data.size()), '\0');
+    const auto compressed_size = ZSTD_compress(compressed.data(), compressed.size(), data.data(), data.size(), level);
+    CheckCompressionResult(compressed_size);
+    compressed.resize(compressed_size);
+    return compressed;
+}
+
+struct StreamCompressor::Impl {
+    explicit Impl(CStreamPtr stream) : stream(std::move(stream)) {}
+
+    CStreamPtr stream;
+};
+
+StreamCompressor::StreamCompressor(int level) : impl_{CStreamPtr{ZSTD_createCStream()}} {
+    if (!impl_->stream) {
+        throw CompressionError("Couldn't create ZSTD compression stream");
+    }
+    CheckCompressionResult(ZSTD_CCtx_setParameter(impl_->stream.get(), ZSTD_c_compressionLevel, level));
+}
+
+StreamCompressor::StreamCompressor(StreamCompressor&&) noexcept = default;
+
+StreamCompressor& StreamCompressor::operator=(StreamCompressor&&) noexcept = default;
+
+StreamCompressor::~StreamCompressor() = default;
+
+std::string StreamCompressor::Compress(std::string_view chunk) {
+    std::string output;
+    CompressStreamTo(impl_->stream.get(), chunk, ZSTD_e_flush, output);
+    return output;
+}
+
+std::string StreamCompressor::Finish() {
+    std::string output;
+    CompressStreamTo(impl_->stream.get(), {}, ZSTD_e_end, output);
+    return output;
+}
+
 }  // namespace compression::zstd
 USERVER_NAMESPACE_END
@@ -60,4 +60,30 @@ TEST(Zstd, TestOverflow) {
     );
 }
 
+TEST(Zstd, CompressRoundTrip) {
+    const std::string str(16'000, 'a');
+
+    const auto compressed = compression::zstd::Compress(str);
+    EXPECT_LT(compressed.size(), str.size());
+    EXPECT_EQ(compression::zstd::Decompress(compressed, str.size()), str);
+}
+
+TEST(Zstd, StreamCompress) {
+    compression::zstd::StreamCompressor compressor;
+
+    std::string compressed;
+    std::string expected;
+    for (int i = 0; i < 10; ++i) {
+        const std::string chunk(1000, static_cast<char>('a' + i));
+        compressed += compressor.Compress(chunk);
+        expected += chunk;
+
+        // Every chunk is flushed and could be decompressed right away
+        EXPECT_EQ(compression::zstd::Decompress(compressed, expected.size()), expected);
+    }
+    compressed += compressor.Finish();
+
+    EXPECT_EQ(compression::zstd::Decompress(compressed, expected.size()), expected);
+}
+
 USERVER_NAMESPACE_END
@@ -23,7 +23,13 @@ Format FormatFromString(std::string_view format_str) {
         return Format::kRaw;
     }
 
-    UINVARIANT(false, fmt::format("Unknown logging format '{}' (must be one of 'tskv', 'ltsv')", format_str));
+    if (format_str == "json") {
+        return Format::kJson;
+    }
+
+    UINVARIANT(
+        false, fmt::format("Unknown logging format '{}' (must be one of 'tskv', 'ltsv', 'raw', 'json')", format_str)
+    );
 }
 
 }  // namespace logging
@@ -1,5 +1,6 @@
 #include <userver/logging/impl/logger_base.hpp>
 
+#include <userver/logging/impl/structured_record.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -12,12 +13,25 @@ LoggerBase::~LoggerBase() = default;
 
 void LoggerBase::Trace(Level level, std::string_view msg) { Log(level, msg); }
 
+void LoggerBase::LogStructured(StructuredRecord&& record) {
+    const auto text = ToText(record, GetFormat());
+    if (record.is_trace) {
+        Trace(record.level, text);
+    } else {
+        Log(record.level, text);
+    }
+}
+
 void LoggerBase::Flush() {}
 
 void LoggerBase::PrependCommonTags(TagWriter /*writer*/) const {}
 
 Format LoggerBase::GetFormat() const noexcept { return format_; }
 
+bool LoggerBase::IsStructured() const noexcept { return is_structured_.load(std::memory_order_relaxed); }
+
+void LoggerBase::SetStructured(bool structured) noexcept { is_structured_.store(structured); }
+
 void LoggerBase::SetLevel(Level level) { level_ = level; }
 
 Level LoggerBase::GetLevel() const noexcept { return level_; }
@@ -0,0 +1,28 @@
+#include <userver/logging/impl/structured_record.hpp>
+
+#include <logging/log_helper_impl.hpp>
+#include <userver/utils/encoding/tskv.hpp>
+#include <utils/encoding/json_string.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+std::string ToText(const StructuredRecord& record, Format format) {
+    LogBuffer buffer;
+    PutMessageBegin(buffer, format, record.level, record.time);
+    ForEachEntry(record, [&buffer, format](std::string_view key, std::string_view value) {
+        PutKey(buffer, format, key);
+        if (format == Format::kJson) {
+            utils::encoding::EncodeJsonString(buffer, value);
+        } else {
+            utils::encoding::EncodeTskv(buffer, value, utils::encoding::EncodeTskvMode::kValue);
+        }
+    });
+    PutMessageEnd(buffer, format);
+    return std::string(buffer.data(), buffer.size());
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
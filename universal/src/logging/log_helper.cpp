@@ -120,7 +120,22 @@ struct LogHelper::Module final {
         static constexpr std::string_view kDelimiter2 = ":";
         static constexpr std::string_view kDelimiter3 = " ) ";
 
-        auto& buffer = lh.pimpl_->GetBufferForRawValuePart();
+        auto& impl = *lh.pimpl_;
+        if (impl.IsRawValuePartEscaped()) {
+            // Function names and file paths may contain quotes and backslashes
+            for (const auto part :
+                 {location.GetFunctionName(),
+                  kDelimiter1,
+                  location.GetFileName(),
+                  kDelimiter2,
+                  location.GetLineString(),
+                  kDelimiter3}) {
+                impl.PutRawValuePart(part);
+            }
+            return;
+        }
+
+        auto& buffer = impl.GetBufferForRawValuePart();
 
         const auto module_size = location.GetFunctionName().size() + kDelimiter1.size() +
                                  location.GetFileName().size() + kDelimiter2.size() + location.GetLineString().size() +
@@ -371,9 +386,7 @@ void LogHelper::Put(std::string_view value) { pimpl_->PutValuePart(value); }
 
 void LogHelper::Put(char value) { pimpl_->PutValuePart(value); }
 
-void LogHelper::PutRaw(std::string_view value_needs_no_escaping) {
-    pimpl_->GetBufferForRawValuePart().append(value_needs_no_escaping);
-}
+void LogHelper::PutRaw(std::string_view value_needs_no_escaping) { pimpl_->PutRawValuePart(value_needs_no_escaping); }
 
 void LogHelper::PutException(const std::exception& ex) {
     if (!impl::ShouldLogStacktrace()) {
@@ -1,6 +1,7 @@
 #include "log_helper_impl.hpp"
 
 #include <array>
+#include <cstring>
 
 #include <fmt/chrono.h>
 #include <fmt/compile.h>
@@ -9,8 +10,10 @@
 #include <userver/compiler/impl/constexpr.hpp>
 #include <userver/compiler/thread_local.hpp>
 #include <userver/logging/impl/logger_base.hpp>
+#include <userver/logging/impl/structured_record.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/tskv.hpp>
+#include <utils/encoding/json_string.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,12 +21,13 @@ namespace logging {
 
 namespace {
 
-char GetSeparatorFromLogger(LoggerRef logger) {
-    switch (logger.GetFormat()) {
+char GetSeparator(Format format) {
+    switch (format) {
         case Format::kTskv:
         case Format::kRaw:
             return '=';
         case Format::kLtsv:
+        case Format::kJson:
             return ':';
     }
 
@@ -81,7 +85,8 @@ std::streamsize LogHelper::Impl::BufferStd::xsputn(const char_type* s, std::stre
 LogHelper::Impl::Impl(LoggerRef logger, Level level) noexcept
     : logger_(&logger),
       level_(std::max(level, logger_->GetLevel())),
-      key_value_separator_(GetSeparatorFromLogger(*logger_)) {
+      format_(logger_->GetFormat()),
+      is_structured_(logger_->IsStructured()) {
     static_assert(
         sizeof(LogHelper::Impl) < 4096,
         "Structures with size more than 4096 would consume at least "
@@ -92,17 +97,17 @@ LogHelper::Impl::Impl(LoggerRef logger, Level level) noexcept
     }
 }
 
-void LogHelper::Impl::PutMessageBegin() {
-    UASSERT(msg_.size() == 0);
+namespace impl {
 
-    switch (logger_->GetFormat()) {
+void PutMessageBegin(LogBuffer& buffer, Format format, Level level, std::chrono::system_clock::time_point now) {
+    switch (format) {
         case Format::kTskv: {
             constexpr std::string_view kTemplate = "tskv\ttimestamp=0000-00-00T00:00:00.000000\tlevel=";
-            const auto now = TimePoint::clock::now();
-            const auto level_string = logging::ToUpperCaseString(level_);
-            msg_.resize(kTemplate.size() + level_string.size());
+            const auto level_string = logging::ToUpperCaseString(level);
+            const auto old_size = buffer.size();
+            buffer.resize(old_size + kTemplate.size() + level_string.size());
             fmt::format_to(
-                msg_.data(),
+                buffer.data() + old_size,
                 FMT_COMPILE("tskv\ttimestamp={}.{:06}\tlevel={}"),
                 GetCurrentTimeString(now).ToStringView(),
                 FractionalMicroseconds(now),
@@ -112,11 +117,11 @@ void LogHelper::Impl::PutMessageBegin() {
         }
         case Format::kLtsv: {
             constexpr std::string_view kTemplate = "timestamp:0000-00-00T00:00:00.000000\tlevel:";
-            const auto now = TimePoint::clock::now();
-            const auto level_string = logging::ToUpperCaseString(level_);
-            msg_.resize(kTemplate.size() + level_string.size());
+            const auto level_string = logging::ToUpperCaseString(level);
+            const auto old_size = buffer.size();
+            buffer.resize(old_size + kTemplate.size() + level_string.size());
             fmt::format_to(
-                msg_.data(),
+                buffer.data() + old_size,
                 FMT_COMPILE("timestamp:{}.{:06}\tlevel:{}"),
                 GetCurrentTimeString(now).ToStringView(),
                 FractionalMicroseconds(now),
@@ -125,56 +130,167 @@ void LogHelper::Impl::PutMessageBegin() {
             return;
         }
         case Format::kRaw: {
-            msg_.append(std::string_view{"tskv"});
+            buffer.append(std::string_view{"tskv"});
+            return;
+        }
+        case Format::kJson: {
+            // The value of "level" is closed by the next key or by PutMessageEnd
+            constexpr std::string_view kTemplate = R"({"timestamp":"0000-00-00T00:00:00.000000","level":")";
+            const auto level_string = logging::ToUpperCaseString(level);
+            const auto old_size = buffer.size();
+            buffer.resize(old_size + kTemplate.size() + level_string.size());
+            fmt::format_to(
+                buffer.data() + old_size,
+                FMT_COMPILE(R"({{"timestamp":"{}.{:06}","level":"{})"),
+                GetCurrentTimeString(now).ToStringView(),
+                FractionalMicroseconds(now),
+                level_string
+            );
             return;
         }
     }
     UASSERT_MSG(false, "Invalid value of Format enum");
 }
 
-void LogHelper::Impl::PutMessageEnd() { msg_.push_back('\n'); }
+void PutMessageEnd(LogBuffer& buffer, Format format) {
+    if (format == Format::kJson) {
+        buffer.append(std::string_view{"\"}\n"});
+    } else {
+        buffer.push_back('\n');
+    }
+}
+
+void PutKey(LogBuffer& buffer, Format format, std::string_view escaped_key) {
+    if (format == Format::kJson) {
+        buffer.append(std::string_view{"\",\""});
+        utils::encoding::EncodeJsonString(buffer, escaped_key);
+        buffer.append(std::string_view{"\":\""});
+        return;
+    }
+
+    const auto old_size = buffer.size();
+    buffer.resize(old_size + 1 + escaped_key.size() + 1);
+
+    auto* position = buffer.data() + old_size;
+    *(position++) = utils::encoding::kTskvPairsSeparator;
+    escaped_key.copy(position, escaped_key.size());
+    position += escaped_key.size();
+    *(position++) = GetSeparator(format);
+}
+
+}  // namespace impl
+
+void LogHelper::Impl::PutMessageBegin() {
+    UASSERT(msg_.size() == 0);
+
+    const auto now = TimePoint::clock::now();
+    if (is_structured_) {
+        time_ = now;
+        return;
+    }
+    impl::PutMessageBegin(msg_, format_, level_, now);
+}
+
+void LogHelper::Impl::PutMessageEnd() {
+    if (!is_structured_) {
+        impl::PutMessageEnd(msg_, format_);
+    }
+}
 
 void LogHelper::Impl::PutKey(std::string_view key) {
     if (!utils::encoding::ShouldKeyBeEscaped(key)) {
         PutRawKey(key);
-    } else {
+    } else if (is_structured_) {
+        // The keys are stored escaped, as they are written in the text formats
         UASSERT(!std::exchange(is_within_value_, true));
         CheckRepeatedKeys(key);
-        msg_.push_back(utils::encoding::kTskvPairsSeparator);
+        const auto key_size_pos = msg_.size();
+        PutEntrySize(0);
         utils::encoding::EncodeTskv(msg_, key, utils::encoding::EncodeTskvMode::kKeyReplacePeriod);
-        msg_.push_back(key_value_separator_);
+        SetEntrySize(key_size_pos);
+        value_size_pos_ = msg_.size();
+        PutEntrySize(0);
+    } else {
+        UASSERT(!std::exchange(is_within_value_, true));
+        CheckRepeatedKeys(key);
+        fmt::basic_memory_buffer<char, 64> escaped_key;
+        utils::encoding::EncodeTskv(escaped_key, key, utils::encoding::EncodeTskvMode::kKeyReplacePeriod);
+        impl::PutKey(msg_, format_, std::string_view(escaped_key.data(), escaped_key.size()));
     }
 }
 
 void LogHelper::Impl::PutRawKey(std::string_view key) {
     UASSERT(!std::exchange(is_within_value_, true));
     CheckRepeatedKeys(key);
-    const auto old_size = msg_.size();
-    msg_.resize(old_size + 1 + key.size() + 1);
-
-    auto* position = msg_.data() + old_size;
-    *(position++) = utils::encoding::kTskvPairsSeparator;
-    key.copy(position, key.size());
-    position += key.size();
-    *(position++) = key_value_separator_;
+    if (is_structured_) {
+        PutEntrySize(key.size());
+        msg_.append(key);
+        value_size_pos_ = msg_.size();
+        PutEntrySize(0);
+        return;
+    }
+    impl::PutKey(msg_, format_, key);
 }
 
 void LogHelper::Impl::PutValuePart(std::string_view value) {
     UASSERT(is_within_value_);
+    if (is_structured_) {
+        msg_.append(value);
+        return;
+    }
+    if (format_ == Format::kJson) {
+        utils::encoding::EncodeJsonString(msg_, value);
+        return;
+    }
     utils::encoding::EncodeTskv(msg_, value, utils::encoding::EncodeTskvMode::kValue);
 }
 
 void LogHelper::Impl::PutValuePart(char text_part) {
     UASSERT(is_within_value_);
+    if (is_structured_) {
+        msg_.push_back(text_part);
+        return;
+    }
+    if (format_ == Format::kJson) {
+        utils::encoding::EncodeJsonString(msg_, std::string_view(&text_part, 1));
+        return;
+    }
     utils::encoding::EncodeTskv(fmt::appender(msg_), text_part, utils::encoding::EncodeTskvMode::kValue);
 }
 
+void LogHelper::Impl::PutRawValuePart(std::string_view value) {
+    UASSERT(is_within_value_);
+    if (IsRawValuePartEscaped()) {
+        utils::encoding::EncodeJsonString(msg_, value);
+        return;
+    }
+    msg_.append(value);
+}
+
 LogBuffer& LogHelper::Impl::GetBufferForRawValuePart() noexcept {
     UASSERT(is_within_value_);
     return msg_;
 }
 
-void LogHelper::Impl::MarkValueEnd() noexcept { UASSERT(std::exchange(is_within_value_, false)); }
+void LogHelper::Impl::MarkValueEnd() noexcept {
+    UASSERT(std::exchange(is_within_value_, false));
+    if (is_structured_) {
+        SetEntrySize(value_size_pos_);
+    }
+}
+
+void LogHelper::Impl::PutEntrySize(std::size_t size) {
+    const auto entry_size = static_cast<impl::StructuredRecord::EntrySize>(size);
+    const auto old_size = msg_.size();
+    msg_.resize(old_size + sizeof(entry_size));
+    std::memcpy(msg_.data() + old_size, &entry_size, sizeof(entry_size));
+}
+
+void LogHelper::Impl::SetEntrySize(std::size_t size_pos) noexcept {
+    using EntrySize = impl::StructuredRecord::EntrySize;
+    const auto entry_size = static_cast<EntrySize>(msg_.size() - size_pos - sizeof(EntrySize));
+    std::memcpy(msg_.data() + size_pos, &entry_size, sizeof(entry_size));
+}
 
 void LogHelper::Impl::MarkAsTrace() noexcept { is_trace_ = true; }
 
@@ -197,6 +313,11 @@ void LogHelper::Impl::LogTheMessage() const {
     }
 
     UASSERT(logger_);
+    if (is_structured_) {
+        logger_->LogStructured(impl::StructuredRecord{level_, is_trace_, time_, std::string(msg_.data(), msg_.size())});
+        return;
+    }
+
     const std::string_view message(msg_.data(), msg_.size());
     if (is_trace_)
         logger_->Trace(level_, message);
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <chrono>
 #include <optional>
 #include <ostream>
 #include <unordered_set>
 
 #include <fmt/format.h>
 
+#include <userver/logging/format.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/log_extra.hpp>
@@ -17,6 +19,21 @@ namespace logging {
 inline constexpr std::size_t kInitialLogBufferSize = 1500;
 using LogBuffer = fmt::basic_memory_buffer<char, kInitialLogBufferSize>;
 
+namespace impl {
+
+// Puts the timestamp and the level, or the "tskv" prefix for Format::kRaw.
+// For Format::kJson the value of the last pair is left open.
+void PutMessageBegin(LogBuffer& buffer, Format format, Level level, std::chrono::system_clock::time_point now);
+
+// Closes the last value and the object for Format::kJson, puts the newline
+void PutMessageEnd(LogBuffer& buffer, Format format);
+
+// Puts the pairs separator, the key and the key-value separator of the format.
+// The key is TSKV-escaped, Format::kJson additionally escapes it as a string.
+void PutKey(LogBuffer& buffer, Format format, std::string_view escaped_key);
+
+}  // namespace impl
+
 struct LogHelper::InternalTag final {};
 
 class LogHelper::Impl final {
@@ -35,7 +52,13 @@ public:
 
     void PutValuePart(std::string_view value);
     void PutValuePart(char text_part);
+    // For the value parts that need no TSKV escaping, they are still escaped
+    // in the JSON format
+    void PutRawValuePart(std::string_view value);
+    // For the value parts that need no escaping in any format, e.g. numbers
     LogBuffer& GetBufferForRawValuePart() noexcept;
+    // Whether PutRawValuePart escapes the values
+    bool IsRawValuePartEscaped() const noexcept { return format_ == Format::kJson && !is_structured_; }
 
     bool IsWithinValue() const noexcept { return is_within_value_; }
     void MarkValueEnd() noexcept;
@@ -79,14 +102,20 @@ private:
     LazyInitedStream& GetLazyInitedStream();
 
     void CheckRepeatedKeys(std::string_view raw_key);
+    void PutEntrySize(std::size_t size);
+    void SetEntrySize(std::size_t size_pos) noexcept;
 
     impl::LoggerBase* logger_;
     const Level level_;
-    const char key_value_separator_;
+    const Format format_;
+    // The entries of impl::StructuredRecord are put into msg_ instead of text
+    const bool is_structured_;
     LogBuffer msg_;
     std::optional<LazyInitedStream> lazy_stream_;
     LogExtra extra_;
     std::size_t initial_length_{0};
+    std::chrono::system_clock::time_point time_{};
+    std::size_t value_size_pos_{0};
     bool is_within_value_{false};
     bool is_trace_{false};
     std::optional<std::unordered_set<std::string>> debug_tag_keys_;
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <string_view>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::encoding {
+
+namespace impl::json {
+
+constexpr std::string_view kHexDigits = "0123456789abcdef";
+
+// '"', '\\' and the control characters must be escaped in JSON strings,
+// RFC 8259 7. Everything else, including UTF-8 sequences, is copied as is.
+constexpr auto kNeedsEscaping = [] {
+    std::array<bool, 256> table{};
+    for (std::size_t i = 0; i < 0x20; ++i) table[i] = true;
+    table[static_cast<unsigned char>('"')] = true;
+    table[static_cast<unsigned char>('\\')] = true;
+    return table;
+}();
+
+inline bool NeedsEscaping(char c) noexcept { return kNeedsEscaping[static_cast<unsigned char>(c)]; }
+
+// Returns the first character in [begin, end) that needs escaping or `end`
+inline const char* FindNeedsEscaping(const char* begin, const char* end) noexcept {
+#ifdef __SSE2__
+    const auto max_control = _mm_set1_epi8(0x1f);
+    const auto quote = _mm_set1_epi8('"');
+    const auto backslash = _mm_set1_epi8('\\');
+    for (; end - begin >= 16; begin += 16) {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+        // there is no unsigned comparison in SSE2, min(x, 0x1f) == x is x <= 0x1f
+        const auto is_control = _mm_cmpeq_epi8(_mm_min_epu8(chunk, max_control), chunk);
+        const auto needs_escaping = _mm_or_si128(
+            is_control, _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash))
+        );
+        const auto mask = _mm_movemask_epi8(needs_escaping);
+        if (mask != 0) {
+            return begin + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+    }
+#endif
+    for (; begin != end; ++begin) {
+        if (NeedsEscaping(*begin)) {
+            return begin;
+        }
+    }
+    return end;
+}
+
+// The longest escape sequence is \u00XX
+constexpr std::size_t kMaxEscapedSize = 6;
+
+// Returns the number of chars written to `destination`
+inline std::size_t WriteEscaped(char* destination, char c) noexcept {
+    const auto write_pair = [destination](char second) {
+        destination[0] = '\\';
+        destination[1] = second;
+        return std::size_t{2};
+    };
+    switch (c) {
+        case '"':
+        case '\\':
+            return write_pair(c);
+        case '\b':
+            return write_pair('b');
+        case '\f':
+            return write_pair('f');
+        case '\n':
+            return write_pair('n');
+        case '\r':
+            return write_pair('r');
+        case '\t':
+            return write_pair('t');
+        default: {
+            const auto byte = static_cast<unsigned char>(c);
+            const char escaped[kMaxEscapedSize] = {'\\', 'u', '0', '0', kHexDigits[byte >> 4], kHexDigits[byte & 0xf]};
+            std::memcpy(destination, escaped, kMaxEscapedSize);
+            return kMaxEscapedSize;
+        }
+    }
+}
+
+}  // namespace impl::json
+
+/// @brief Escapes `str` as the contents of a JSON string, without the
+/// surrounding quotes.
+/// @note New contents are appended at the end of `container`. The runs of
+/// characters that need no escaping are searched with SIMD and copied at once.
+/// @tparam Container must be continuous and support at least the following
+/// operations: 1) `c.data()` 2) `c.size()` 3) `c.resize(new_size)`
+template <typename Container>
+void EncodeJsonString(Container& container, std::string_view str) {
+    const char* position = str.data();
+    const char* const end = str.data() + str.size();
+    std::size_t size = container.size();
+
+    // The container always has room for the rest of `str` unescaped and for
+    // one escape sequence, so it is resized only when something is escaped
+    container.resize(size + str.size() + impl::json::kMaxEscapedSize);
+    while (true) {
+        const char* const special = impl::json::FindNeedsEscaping(position, end);
+        const auto count = static_cast<std::size_t>(special - position);
+        if (count != 0) {
+            std::memcpy(container.data() + size, position, count);
+            size += count;
+        }
+        if (special == end) {
+            break;
+        }
+
+        size += impl::json::WriteEscaped(container.data() + size, *special);
+        position = special + 1;
+        const auto required_size = size + static_cast<std::size_t>(end - position) + impl::json::kMaxEscapedSize;
+        if (container.size() < required_size) {
+            container.resize(required_size);
+        }
+    }
+    container.resize(size);
+}
+
+}  // namespace utils::encoding
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <fmt/format.h>
+
+#include <userver/utils/encoding/tskv.hpp>
+#include <utils/encoding/json_string.hpp>
+
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// The buffer of the same type as in LogHelper
+using Buffer = fmt::basic_memory_buffer<char, 1500>;
+
+constexpr std::string_view kAsciiText = "Request to /v1/profile?id=12345 finished, status=200 \"OK\"\n";
+constexpr std::string_view kUtf8Text =
+    "\xd0\x97\xd0\xb0\xd0\xbf\xd1\x80\xd0\xbe\xd1\x81 \xd0\xb2\xd1\x8b\xd0\xbf\xd0\xbe\xd0\xbb\xd0\xbd\xd0\xb5\xd0"
+    "\xbd \xe2\x9c\x93 \xe4\xbd\xa0\xe5\xa5\xbd\xe4\xb8\x96\xe7\x95\x8c\t";
+
+// `state.range(0)` bytes of ASCII-heavy or UTF-8-heavy text, depending on
+// `state.range(1)`
+std::string GenerateSource(const benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto pattern = state.range(1) == 0 ? kAsciiText : kUtf8Text;
+    std::string source;
+    source.reserve(size + pattern.size());
+    while (source.size() < size) {
+        source += pattern;
+    }
+    source.resize(size);
+    return source;
+}
+
+}  // namespace
+
+void encode_tskv_value(benchmark::State& state) {
+    const auto source = GenerateSource(state);
+    Buffer buffer;
+
+    for ([[maybe_unused]] auto _ : state) {
+        buffer.clear();
+        utils::encoding::EncodeTskv(buffer, source, utils::encoding::EncodeTskvMode::kValue);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(source.size() * state.iterations()));
+}
+BENCHMARK(encode_tskv_value)->Ranges({{16, 8 << 10}, {0, 1}});
+
+void encode_json_string(benchmark::State& state) {
+    const auto source = GenerateSource(state);
+    Buffer buffer;
+
+    for ([[maybe_unused]] auto _ : state) {
+        buffer.clear();
+        utils::encoding::EncodeJsonString(buffer, source);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(source.size() * state.iterations()));
+}
+BENCHMARK(encode_json_string)->Ranges({{16, 8 << 10}, {0, 1}});
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,88 @@
+#include <utils/encoding/json_string.hpp>
+
+#include <string>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Escapes byte by byte, the reference for the SIMD implementation
+std::string EncodeJsonStringSlow(std::string_view str) {
+    std::string result;
+    for (const char c : str) {
+        switch (c) {
+            case '"':
+                result += "\\\"";
+                break;
+            case '\\':
+                result += "\\\\";
+                break;
+            case '\b':
+                result += "\\b";
+                break;
+            case '\f':
+                result += "\\f";
+                break;
+            case '\n':
+                result += "\\n";
+                break;
+            case '\r':
+                result += "\\r";
+                break;
+            case '\t':
+                result += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    result += fmt::format("\\u{:04x}", static_cast<unsigned>(c));
+                } else {
+                    result += c;
+                }
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(JsonString, Basic) {
+    std::string result;
+    utils::encoding::EncodeJsonString(result, R"(say "hi" \o/)");
+    EXPECT_EQ(result, R"(say \"hi\" \\o/)");
+
+    result.clear();
+    utils::encoding::EncodeJsonString(result, std::string_view{"\0\x1f\x7f", 3});
+    EXPECT_EQ(result, "\\u0000\\u001f\x7f");
+
+    result.clear();
+    utils::encoding::EncodeJsonString(result, "\xd1\x82\xd0\xb5\xd0\xba\xd1\x81\xd1\x82 \xe2\x9c\x93");
+    EXPECT_EQ(result, "\xd1\x82\xd0\xb5\xd0\xba\xd1\x81\xd1\x82 \xe2\x9c\x93");
+}
+
+TEST(JsonString, Appends) {
+    std::string result = "prefix ";
+    utils::encoding::EncodeJsonString(result, "\"");
+    EXPECT_EQ(result, "prefix \\\"");
+}
+
+TEST(JsonString, AllBytesAtAllPositions) {
+    // Every byte value at every position of a SIMD block and of the tail
+    for (std::size_t size = 1; size <= 40; ++size) {
+        for (std::size_t position = 0; position < size; ++position) {
+            for (int byte = 0; byte < 256; ++byte) {
+                std::string source(size, 'a');
+                source[position] = static_cast<char>(byte);
+
+                std::string result;
+                utils::encoding::EncodeJsonString(result, source);
+                ASSERT_EQ(result, EncodeJsonStringSlow(source)) << "size=" << size << " position=" << position
+                                                                << " byte=" << byte;
+            }
+        }
+    }
+}
+
+USERVER_NAMESPACE_END
@@ -11,14 +11,18 @@
 #include <sys/time.h>
 #include <unistd.h>
 #else
+#include <linux/mempolicy.h>
 #include <sys/syscall.h>
 #include <sys/types.h>
 #include <unistd.h>
 #endif
 
 #include <algorithm>
+#include <climits>
+#include <system_error>
 
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 
 #include <utils/check_syscall.hpp>
 
@@ -74,6 +78,48 @@ void SetCurrentThreadLowPriorityScheduling() {
     utils::CheckSyscall(::setpriority(PRIO_PROCESS, 0, kLowPriority), "setting thread scheduling parameters");
 }
 
+void SetCurrentThreadCpuAffinity(const std::vector<std::size_t>& cpus) {
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const auto cpu : cpus) {
+        if (cpu >= CPU_SETSIZE) {
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument), fmt::format("CPU {} is out of cpu_set_t range", cpu)
+            );
+        }
+        CPU_SET(cpu, &cpu_set);
+    }
+
+    static constexpr ::pid_t kThisThreadPid = 0;
+    utils::CheckSyscall(
+        ::sched_setaffinity(kThisThreadPid, sizeof(cpu_set), &cpu_set),
+        "setting thread CPU affinity to {}",
+        fmt::join(cpus, ",")
+    );
+#else
+    (void)cpus;
+#endif
+}
+
+void SetCurrentThreadPreferredNumaNode(std::size_t numa_node) {
+#ifdef __linux__
+    static constexpr std::size_t kBitsPerWord = sizeof(unsigned long) * CHAR_BIT;
+    std::vector<unsigned long> node_mask(numa_node / kBitsPerWord + 1, 0);
+    node_mask[numa_node / kBitsPerWord] |= 1UL << (numa_node % kBitsPerWord);
+
+    // set_mempolicy(2) drops the last bit of maxnode, pass one more bit like libnuma does
+    const auto max_node = node_mask.size() * kBitsPerWord + 1;
+    utils::CheckSyscall(
+        ::syscall(SYS_set_mempolicy, MPOL_PREFERRED, node_mask.data(), max_node),
+        "setting preferred NUMA node {}",
+        numa_node
+    );
+#else
+    (void)numa_node;
+#endif
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
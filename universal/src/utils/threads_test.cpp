@@ -1,5 +1,6 @@
 #include <userver/utils/threads.hpp>
 
+#include <sched.h>
 #include <sys/resource.h>
 #include <thread>
 
@@ -28,4 +29,28 @@ TEST(Threads, NotMainThreadLowPriority) {
     EXPECT_EQ(main_priority, ::getpriority(PRIO_PROCESS, 0));
 }
 
+#ifdef __linux__
+TEST(Threads, CpuAffinity) {
+    cpu_set_t initial_set;
+    ASSERT_EQ(::sched_getaffinity(0, sizeof(initial_set), &initial_set), 0);
+
+    std::size_t allowed_cpu = 0;
+    while (!CPU_ISSET(allowed_cpu, &initial_set)) ++allowed_cpu;
+
+    std::thread another_thread([allowed_cpu] {
+        utils::SetCurrentThreadCpuAffinity({allowed_cpu});
+
+        cpu_set_t set;
+        ASSERT_EQ(::sched_getaffinity(0, sizeof(set), &set), 0);
+        EXPECT_EQ(CPU_COUNT(&set), 1);
+        EXPECT_TRUE(CPU_ISSET(allowed_cpu, &set));
+    });
+    another_thread.join();
+
+    cpu_set_t main_set;
+    ASSERT_EQ(::sched_getaffinity(0, sizeof(main_set), &main_set), 0);
+    EXPECT_TRUE(CPU_EQUAL(&main_set, &initial_set));
+}
+#endif
+
 USERVER_NAMESPACE_END